@@ -64,13 +64,56 @@ typedef std::pair<int, float> PredictionIdx;
 
 	virtual void InitLexicon(const char* lexicon_file = 0, bool is_wcs = false) = 0;
 	virtual std::string GetOutputFeatureMapByLexicon(const cv::Mat& img) = 0;
+
+	//lines wider than window_width are recognized as a batch of overlapping windows,
+	//window_width <= 0 disables tiling
+	virtual void SetTiling(int window_width, int overlap) = 0;
+
+	//Classify(pJPGBuffer) decodes large JPEGs at 1/2, 1/4 or 1/8 scale straight to
+	//the input size and channels of the net; faster, but the pixels differ slightly
+	//from a full decode. Off by default
+	virtual void SetReducedDecode(bool reduced_decode) = 0;
+
+	//blobs whose lifetimes do not overlap share memory, only the output, the ctc input
+	//and keep_blobs stay readable after a forward pass; reports activation bytes before/after
+	virtual void ShareActivationMemory(const std::vector<std::string>& keep_blobs,
+		size_t* unshared_bytes = 0, size_t* shared_bytes = 0) = 0;
 };
 
+ //statistics of the cascade predictor
+ struct CascadeStats
+ {
+	 int lines;			//lines recognized
+	 int escalated;		//lines re-recognized by the heavy model
+	 double fast_ms;	//total time spent in the fast model
+	 double heavy_ms;	//total time spent in the heavy model
+
+	 float EscalationRate() const { return lines ? (float)escalated / lines : 0; }
+	 float EffectiveLatency() const { return lines ? (float)((fast_ms + heavy_ms) / lines) : 0; }
+ };
+
+ //two-stage ocr: a fast model recognizes every line, lines whose greedy path
+ //confidence is below the threshold are recognized again by the heavy model
+ interface ICNNCascadePredict
+ {
+	 //returns (text, confidence) for each line
+	 virtual std::vector<Prediction> Recognize(const std::vector<cv::Mat>& imgs) = 0;
+	 virtual void SetThreshold(float threshold) = 0;
+	 virtual float GetThreshold() = 0;
+	 virtual CascadeStats GetStats() = 0;
+	 virtual void ResetStats() = 0;
+	 virtual void Release() = 0;
+ };
+
  typedef unsigned char byte;
 
  extern "C" 
  {
 	 EXPORT ICNNPredict* CreatePredictInstance(const char* model_folder, bool use_gpu, int gpu_no);
+	 // fold_bn: merge BatchNorm/Scale/ReLU into the preceding layers while loading
+	 EXPORT ICNNPredict* CreatePredictInstanceEx(const char* model_folder, bool use_gpu, int gpu_no, bool fold_bn);
+	 EXPORT ICNNCascadePredict* CreateCascadePredictInstance(const char* fast_model_folder, const char* heavy_model_folder,
+		 bool use_gpu, int gpu_no, float threshold);
 	 EXPORT void ICNNPredict_InitLexicon(ICNNPredict* pcnn, const char* lexicon_file, bool is_wcs) {
 		 pcnn->InitLexicon(lexicon_file, is_wcs);
 	 }
@@ -96,6 +139,9 @@ typedef std::pair<int, float> PredictionIdx;
 		 }
 		 return num;
 	 }
+	 EXPORT void ICNNPredict_SetTiling(ICNNPredict* pcnn, int window_width, int overlap) {
+		 pcnn->SetTiling(window_width, overlap);
+	 }
 	 EXPORT const char* ICNNPredict_GetOutputFeatureMapByLexicon(ICNNPredict* pcnn, int rows, int cols, int channels, byte* data) {
 		 int size[3] = { rows, cols, channels };
 		 const cv::Mat img = cv::Mat(rows, cols, CV_8UC3, data);
@@ -0,0 +1,166 @@
+#include "cascade_classifier.hpp"
+
+#include "caffe/util/benchmark.hpp"
+
+
+extern "C" EXPORT ICNNCascadePredict* CreateCascadePredictInstance(const char* fast_model_folder,
+	const char* heavy_model_folder, bool use_gpu, int gpu_no, float threshold)
+{
+	CascadeClassifier* p = new CascadeClassifier();
+
+	if (!p->Init(fast_model_folder, heavy_model_folder, use_gpu, gpu_no, threshold))
+	{
+		delete p;
+		p = NULL;
+	}
+	return p;
+}
+
+CascadeClassifier::CascadeClassifier()
+	: fast_(NULL), heavy_(NULL), threshold_(0.9f)
+{
+	ResetStats();
+}
+
+CascadeClassifier::~CascadeClassifier()
+{
+	delete fast_;
+	delete heavy_;
+}
+
+bool CascadeClassifier::Init(const string& fast_model_path, const string& heavy_model_path,
+	bool gpu_mode, int gpu_no, float threshold)
+{
+	threshold_ = threshold;
+
+	fast_ = new Classifier();
+	if (!fast_->Init(fast_model_path, gpu_mode, gpu_no))
+		return false;
+
+	heavy_ = new Classifier();
+	if (!heavy_->Init(heavy_model_path, gpu_mode, gpu_no))
+		return false;
+
+	return true;
+}
+
+void CascadeClassifier::ResetStats()
+{
+	stats_.lines = 0;
+	stats_.escalated = 0;
+	stats_.fast_ms = 0;
+	stats_.heavy_ms = 0;
+}
+
+static bool SizeIdxLess(const std::pair<cv::Size, int>& a, const std::pair<cv::Size, int>& b)
+{
+	return a.first.height < b.first.height
+		|| (a.first.height == b.first.height && a.first.width < b.first.width);
+}
+
+void CascadeClassifier::RecognizeBatched(Classifier* model, const std::vector<cv::Mat>& imgs,
+	std::vector< std::vector<int> >& seqs, std::vector<float>& confidences)
+{
+	seqs.assign(imgs.size(), std::vector<int>());
+	confidences.assign(imgs.size(), 0);
+
+	//resize to the input height of the model, keeping the aspect ratio
+	int wstd = 0, hstd = 0;
+	model->GetInputImageSize(wstd, hstd);
+	std::vector<cv::Mat> resized(imgs.size());
+	for (size_t i = 0; i < imgs.size(); i++)
+	{
+		const cv::Mat& img = imgs[i];
+		int w1 = std::max(1, hstd*img.cols / std::max(1, img.rows));
+		if (img.rows != hstd)
+			cv::resize(img, resized[i], cv::Size(w1, hstd));
+		else
+			resized[i] = img;
+	}
+
+	//group lines by size, each group is one forward
+	std::vector<std::pair<cv::Size, int> > order(imgs.size());
+	for (size_t i = 0; i < imgs.size(); i++)
+		order[i] = std::make_pair(resized[i].size(), (int)i);
+	std::stable_sort(order.begin(), order.end(), SizeIdxLess);
+
+	size_t start = 0;
+	while (start < order.size())
+	{
+		size_t end = start + 1;
+		while (end < order.size() && order[end].first == order[start].first)
+			end++;
+
+		std::vector<cv::Mat> batch;
+		for (size_t k = start; k < end; k++)
+			batch.push_back(resized[order[k].second]);
+
+		std::vector< std::vector<int> > batch_seqs;
+		std::vector<float> batch_confs;
+		model->BatchRecognize(batch, batch_seqs, batch_confs);
+		for (size_t k = start; k < end; k++)
+		{
+			seqs[order[k].second] = batch_seqs[k - start];
+			confidences[order[k].second] = batch_confs[k - start];
+		}
+		start = end;
+	}
+}
+
+string CascadeClassifier::SequenceToString(Classifier* model, const std::vector<int>& seq)
+{
+	const std::vector<string> labels = model->GetLabels();
+	string str;
+	for (size_t i = 0; i < seq.size(); i++)
+	{
+		if (seq[i] >= 0 && seq[i] < (int)labels.size())
+			str += labels[seq[i]];
+	}
+	return str;
+}
+
+std::vector<Prediction> CascadeClassifier::Recognize(const std::vector<cv::Mat>& imgs)
+{
+	std::vector<Prediction> results(imgs.size());
+	if (imgs.size() == 0)
+		return results;
+
+	CPUTimer timer;
+
+	//stage 1: fast model on every line
+	timer.Start();
+	std::vector< std::vector<int> > seqs;
+	std::vector<float> confs;
+	RecognizeBatched(fast_, imgs, seqs, confs);
+	timer.Stop();
+	stats_.fast_ms += timer.MilliSeconds();
+
+	std::vector<int> uncertain;
+	for (size_t i = 0; i < imgs.size(); i++)
+	{
+		results[i] = std::make_pair(SequenceToString(fast_, seqs[i]), confs[i]);
+		if (confs[i] < threshold_)
+			uncertain.push_back((int)i);
+	}
+
+	//stage 2: heavy model on the uncertain lines only
+	if (uncertain.size() > 0)
+	{
+		std::vector<cv::Mat> hard_imgs;
+		for (size_t k = 0; k < uncertain.size(); k++)
+			hard_imgs.push_back(imgs[uncertain[k]]);
+
+		timer.Start();
+		RecognizeBatched(heavy_, hard_imgs, seqs, confs);
+		timer.Stop();
+		stats_.heavy_ms += timer.MilliSeconds();
+
+		for (size_t k = 0; k < uncertain.size(); k++)
+			results[uncertain[k]] = std::make_pair(SequenceToString(heavy_, seqs[k]), confs[k]);
+	}
+
+	stats_.lines += (int)imgs.size();
+	stats_.escalated += (int)uncertain.size();
+
+	return results;
+}
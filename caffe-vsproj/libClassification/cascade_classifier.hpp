@@ -0,0 +1,40 @@
+#ifndef __CASCADE_CLASSIFIER__
+#define __CASCADE_CLASSIFIER__
+
+#include "classification.hpp"
+
+
+//confidence-gated cascade of two ocr models, e.g. densenet-no-blstm (fast) and
+//densenet-sum-blstm-full-res-blstm (heavy)
+class EXPORT CascadeClassifier : public ICNNCascadePredict
+{
+public:
+	CascadeClassifier();
+	~CascadeClassifier();
+
+	bool Init(const string& fast_model_path, const string& heavy_model_path,
+		bool gpu_mode = true, int gpu_no = 0, float threshold = 0.9f);
+	void Release() { delete this; }
+
+	std::vector<Prediction> Recognize(const std::vector<cv::Mat>& imgs);
+
+	void SetThreshold(float threshold) { threshold_ = threshold; }
+	float GetThreshold() { return threshold_; }
+	CascadeStats GetStats() { return stats_; }
+	void ResetStats();
+
+private:
+	//recognize lines with one model, lines with the same size are forwarded as one batch
+	void RecognizeBatched(Classifier* model, const std::vector<cv::Mat>& imgs,
+		std::vector< std::vector<int> >& seqs, std::vector<float>& confidences);
+	string SequenceToString(Classifier* model, const std::vector<int>& seq);
+
+private:
+	Classifier* fast_;
+	Classifier* heavy_;
+	float threshold_;
+	CascadeStats stats_;
+};
+
+
+#endif
@@ -45,9 +45,21 @@ extern "C" EXPORT ICNNPredict* CreatePredictInstance(const char* model_folder, b
 	return p;
 }
 
+extern "C" EXPORT ICNNPredict* CreatePredictInstanceEx(const char* model_folder, bool use_gpu, int gpu_no, bool fold_bn)
+{
+	Classifier* p = new Classifier();
+
+	if (!p->Init(model_folder, use_gpu, gpu_no, fold_bn))
+	{
+		delete p;
+		p = NULL;
+	}
+	return p;
+}
+
 Classifier::Classifier(){  }
 
-bool Classifier::Init(const string& model_path, bool gpu_mode, int gpu_no) {
+bool Classifier::Init(const string& model_path, bool gpu_mode, int gpu_no, bool fold_bn) {
 
 
 	const string trained_file = model_path + "/model.caffemodel";
@@ -67,8 +79,23 @@ bool Classifier::Init(const string& model_path, bool gpu_mode, int gpu_no) {
 	}
 
 	/* Load the network. */
-	net_.reset(new Net<float>(model_file, TEST));
-	net_->CopyTrainedLayersFrom(trained_file);
+	if (fold_bn)
+	{
+		// merge BatchNorm/Scale/ReLU into the preceding Convolution/InnerProduct
+		NetParameter param, weights, folded_param, folded_weights;
+		ReadNetParamsFromTextFileOrDie(model_file, &param);
+		param.mutable_state()->set_phase(TEST);
+		ReadNetParamsFromBinaryFileOrDie(trained_file, &weights);
+		int removed = FoldBatchNorm(param, weights, &folded_param, &folded_weights);
+		LOG(INFO) << "Folded " << removed << " layers of " << model_file;
+		net_.reset(new Net<float>(folded_param));
+		net_->CopyTrainedLayersFrom(folded_weights);
+	}
+	else
+	{
+		net_.reset(new Net<float>(model_file, TEST));
+		net_->CopyTrainedLayersFrom(trained_file);
+	}
 	//net_->set_debug_info(true);
 
 	CHECK_EQ(net_->num_inputs(), 1) << "Network should have exactly one input.";
@@ -229,9 +256,18 @@ std::vector<Prediction> Classifier::Classify(const string& file, int N) {
 
 std::vector<Prediction> Classifier::Classify(const unsigned char* pJPGBuffer, int len, int N /*= 5*/)
 {
-	vector<uchar> jpg(len);
-	memcpy(&jpg[0], pJPGBuffer, len);
+	if (reduced_decode_) {
+		// Decode straight to the input size and channels of the net, letting
+		// libjpeg scale large images down while decoding.
+		cv::Mat img = DecodeBufferToCVMat(reinterpret_cast<const char*>(pJPGBuffer),
+			len, input_geometry_.height, input_geometry_.width, num_channels_ == 3,
+			true);
+		return Classify(img, N);
+	}
 
+	// A full decode by default, so predictions do not change. The buffer is
+	// wrapped rather than copied.
+	cv::Mat jpg(1, len, CV_8UC1, const_cast<unsigned char*>(pJPGBuffer));
 	cv::Mat img = cv::imdecode(jpg, CV_LOAD_IMAGE_COLOR);
 
 	return Classify(img, N);
@@ -985,8 +1021,86 @@ void Classifier::PrepareBatchInputs(const vector<cv::Mat>& imgs)
 	}
 }
 
+//greedy ctc decoding of sequence n in TxNxC activations, returns the log posterior of the greedy path
+static double GreedyDecode(const float* data, int T, int N, int n, int C, int blank, bool is_prob,
+	std::vector<int>& seq)
+{
+	double logp = 0;
+	int prev = -1;
+	for (int t = 0; t < T; t++)
+	{
+		const float* p = data + (t*N + n)*C;
+		int maxidx = 0;
+		float maxv = p[0];
+		for (int c = 1; c < C; c++)
+		{
+			if (p[c] > maxv)
+			{
+				maxv = p[c];
+				maxidx = c;
+			}
+		}
+		if (is_prob)
+			logp += log(std::max(maxv, 1e-20f));
+		else
+		{
+			//log of the softmax probability of the max activation
+			double sum = 0;
+			for (int c = 0; c < C; c++)
+				sum += exp(p[c] - maxv);
+			logp -= log(sum);
+		}
+
+		if (maxidx != blank && maxidx != prev)
+			seq.push_back(maxidx);
+		prev = maxidx;
+	}
+	return logp;
+}
+
+//posterior of class c in one frame of activations
+static float FrameProb(const float* p, int C, int c, bool is_prob)
+{
+	if (is_prob)
+		return p[c];
+	float maxv = *std::max_element(p, p + C);
+	double sum = 0;
+	for (int k = 0; k < C; k++)
+		sum += exp(p[k] - maxv);
+	return (float)(exp(p[c] - maxv) / sum);
+}
+
 std::vector<float> Classifier::GetOutputFeatureMap(const cv::Mat& img, std::vector<int>& outshape)
 {
+	last_tiled_ = false;
+	if (tile_width_ > 0 && img.cols > tile_width_)
+	{
+		int timesteps = 0, alphabet_size = 0;
+		ForwardTiled(img, tiled_acts_, timesteps, alphabet_size);
+		tiled_shape_.resize(3);
+		tiled_shape_[0] = timesteps;
+		tiled_shape_[1] = 1;
+		tiled_shape_[2] = alphabet_size;
+		last_tiled_ = true;
+
+		bool is_prob = false;
+		int blank = 0;
+		GetCTCInputBlob(&is_prob, &blank);
+		vector<int> seq;
+		GreedyDecode(tiled_acts_.data(), timesteps, 1, 0, alphabet_size, blank, is_prob, seq);
+
+		//same layout as the CTCGreedyDecoder output: N x T, padded with -1
+		std::vector<float> pred(timesteps, -1);
+		for (size_t i = 0; i < seq.size(); i++)
+			pred[i] = (float)seq[i];
+		outshape.resize(4);
+		outshape[0] = 1;
+		outshape[1] = timesteps;
+		outshape[2] = 1;
+		outshape[3] = 1;
+		return pred;
+	}
+
 	PrepareInput(img);
 
 	net_->Forward();
@@ -1000,6 +1114,176 @@ std::vector<float> Classifier::GetOutputFeatureMap(const cv::Mat& img, std::vect
 	return std::vector<float>(begin, end);
 }
 
+//the ocr deploy nets end with a CTCGreedyDecoder layer, whose bottom holds the TxNxC activations
+const Blob<float>* Classifier::GetCTCInputBlob(bool* is_prob, int* blank_index)
+{
+	const vector<shared_ptr<Layer<float> > >& layers = net_->layers();
+	int last = (int)layers.size() - 1;
+	const Blob<float>* blob = net_->output_blobs()[0];
+	*blank_index = 0;
+	if (strcmp(layers[last]->type(), "CTCGreedyDecoder") == 0)
+	{
+		blob = net_->bottom_vecs()[last][0];
+		*blank_index = layers[last]->layer_param().ctc_decoder_param().blank_index();
+	}
+	if (*blank_index < 0)
+		*blank_index = blob->shape(2) - 1;
+
+	//softmax already applied in the net?
+	*is_prob = false;
+	for (int i = last; i >= 0; i--)
+	{
+		const vector<Blob<float>*>& tops = net_->top_vecs()[i];
+		if (std::find(tops.begin(), tops.end(), blob) != tops.end())
+		{
+			*is_prob = (strcmp(layers[i]->type(), "Softmax") == 0);
+			break;
+		}
+	}
+	return blob;
+}
+
+void Classifier::BatchRecognize(const std::vector<cv::Mat>& imgs, std::vector< std::vector<int> >& seqs,
+	std::vector<float>& confidences)
+{
+	seqs.clear();
+	confidences.clear();
+	if (imgs.size() == 0)
+		return;
+
+	PrepareBatchInputs(imgs);
+	net_->Forward();
+
+	bool is_prob = false;
+	int blank = 0;
+	const Blob<float>* acts = GetCTCInputBlob(&is_prob, &blank);
+	CHECK_EQ(acts->num_axes(), 3) << "ctc input should be TxNxC";
+	const int T = acts->shape(0), N = acts->shape(1), C = acts->shape(2);
+	const float* data = acts->cpu_data();
+
+	seqs.resize(N);
+	confidences.resize(N);
+	for (int n = 0; n < N; n++)
+		confidences[n] = (float)exp(GreedyDecode(data, T, N, n, C, blank, is_prob, seqs[n]));
+}
+
+void Classifier::ShareActivationMemory(const std::vector<std::string>& keep_blobs,
+	size_t* unshared_bytes, size_t* shared_bytes)
+{
+	//lexicon rescoring and tiling read the ctc input (e.g. fc1x) after forward
+	vector<string> keep(keep_blobs);
+	bool is_prob = false;
+	int blank = 0;
+	const Blob<float>* acts = GetCTCInputBlob(&is_prob, &blank);
+	const vector<shared_ptr<Blob<float> > >& blobs = net_->blobs();
+	for (size_t i = 0; i < blobs.size(); i++)
+	{
+		if (blobs[i].get() == acts)
+			keep.push_back(net_->blob_names()[i]);
+	}
+	net_->ShareActivationMemory(keep);
+	if (unshared_bytes)
+		*unshared_bytes = net_->activation_bytes();
+	if (shared_bytes)
+		*shared_bytes = net_->shared_activation_bytes();
+}
+
+void Classifier::SetTiling(int window_width, int overlap)
+{
+	if (window_width > 0)
+		CHECK(overlap >= 0 && overlap < window_width) << "overlap should be in [0, window_width)";
+	tile_width_ = window_width;
+	tile_overlap_ = overlap;
+}
+
+void Classifier::ForwardTiled(const cv::Mat& img, std::vector<float>& acts, int& timesteps, int& alphabet_size)
+{
+	const int W = img.cols;
+	const int stride = tile_width_ - tile_overlap_;
+
+	//window positions, the last window is aligned to the right border
+	vector<int> starts;
+	for (int x = 0;; x += stride)
+	{
+		if (x + tile_width_ >= W)
+		{
+			x = W - tile_width_;
+			if (starts.empty() || starts.back() != x)
+				starts.push_back(x);
+			break;
+		}
+		starts.push_back(x);
+	}
+
+	vector<cv::Mat> windows(starts.size());
+	for (size_t k = 0; k < starts.size(); k++)
+		windows[k] = img(cv::Rect(starts[k], 0, tile_width_, img.rows));
+
+	//all windows have the same size, one forward for the whole line
+	PrepareBatchInputs(windows);
+	net_->Forward();
+
+	bool is_prob = false;
+	int blank = 0;
+	const Blob<float>* blob = GetCTCInputBlob(&is_prob, &blank);
+	CHECK_EQ(blob->num_axes(), 3) << "ctc input should be TxNxC";
+	const int T = blob->shape(0), N = blob->shape(1), C = blob->shape(2);
+	const float* data = blob->cpu_data();
+	const float pw = (float)tile_width_ / T;	//pixels per frame
+
+	//frames [from[k], to[k]) of window k are kept
+	vector<int> from(N, 0), to(N, T);
+	for (int k = 0; k + 1 < N; k++)
+	{
+		//cut the overlap at the frame where both windows are most confident of a blank,
+		//so that no character is split or emitted twice
+		const int ov0 = starts[k + 1], ov1 = starts[k] + tile_width_;
+		const float mid = 0.5f*(ov0 + ov1);
+		int best_t = -1, best_t1 = 0;
+		float best_score = -1, best_dist = 0;
+		for (int t = from[k]; t < T; t++)
+		{
+			float center = starts[k] + (t + 0.5f)*pw;
+			if (center < ov0 || center >= ov1)
+				continue;
+			int t1 = std::min(T - 1, (int)((center - starts[k + 1]) / pw));
+			float score = std::min(FrameProb(data + (t*N + k)*C, C, blank, is_prob),
+				FrameProb(data + (t1*N + k + 1)*C, C, blank, is_prob));
+			float dist = fabs(center - mid);
+			if (score > best_score + 1e-3f || (fabs(score - best_score) <= 1e-3f && dist < best_dist))
+			{
+				best_score = score;
+				best_dist = dist;
+				best_t = t;
+				best_t1 = t1;
+			}
+		}
+		if (best_t < 0)//overlap narrower than one frame
+		{
+			best_t = std::max(from[k], std::min(T, (int)((mid - starts[k]) / pw + 0.5f)));
+			best_t1 = std::max(0, std::min(T, (int)((mid - starts[k + 1]) / pw + 0.5f)));
+		}
+		to[k] = best_t;
+		from[k + 1] = best_t1;
+	}
+
+	timesteps = 0;
+	for (int k = 0; k < N; k++)
+		timesteps += std::max(0, to[k] - from[k]);
+	alphabet_size = C;
+
+	acts.resize(timesteps*C);
+	float* dst = acts.data();
+	for (int k = 0; k < N; k++)
+	{
+		for (int t = from[k]; t < to[k]; t++)
+		{
+			memcpy(dst, data + (t*N + k)*C, C*sizeof(float));
+			dst += C;
+		}
+	}
+}
+
 
 std::wstring string2wstring(const string& str, bool bSrcIsUTF8 = true)
 {
@@ -1288,7 +1572,14 @@ string Classifier::GetOutputFeatureMapByLexicon(const cv::Mat& img) {
 	}
 
 	float min_ctc_loss = 1000;
-	vector<float> activitas = GetLayerFeatureMaps("fc1x", outshape);
+	vector<float> activitas;
+	if (last_tiled_)
+	{
+		activitas = tiled_acts_;
+		outshape = tiled_shape_;
+	}
+	else
+		activitas = GetLayerFeatureMaps("fc1x", outshape);
 	// һminibatch
 	vector<float> activitas_set;
 	for (size_t i = 0; i < ress.size(); i++) {
@@ -9,6 +9,7 @@
 // #include <opencv2/imgproc/imgproc.hpp>
 
 #include "ICNNPredict.h"
+#include "caffe/util/fold_batchnorm.hpp"
 #include "bktree.h"
 #include "levenshtein.h"
 
@@ -28,7 +29,7 @@ class EXPORT Classifier : public ICNNPredict
 public:
 	Classifier();
 
-	bool Init(const string& model_path, bool gpu_mode = true, int gpu_no = 0);
+	bool Init(const string& model_path, bool gpu_mode = true, int gpu_no = 0, bool fold_bn = false);
 	bool Init(const string& trained_file, const string& model_file,
 		const string&mean_file, const string&label_file,
 		bool gpu_mode);
@@ -76,6 +77,16 @@ public:
 
 	void InitLexicon(const char* lexicon_file = 0, bool is_wcs = false);
 	string GetOutputFeatureMapByLexicon(const cv::Mat& img);
+
+	//greedy ctc decoding of a batch of text lines with the same size,
+	//confidence is the posterior of the greedy path (product of the per-frame max probabilities)
+	void BatchRecognize(const std::vector<cv::Mat>& imgs, std::vector< std::vector<int> >& seqs,
+		std::vector<float>& confidences);
+
+	void SetTiling(int window_width, int overlap);
+	void SetReducedDecode(bool reduced_decode) { reduced_decode_ = reduced_decode; }
+	void ShareActivationMemory(const std::vector<std::string>& keep_blobs,
+		size_t* unshared_bytes = 0, size_t* shared_bytes = 0);
 	
 private:
 	void Forward(const cv::Mat& img, const string& lastLayerName);
@@ -99,6 +110,10 @@ private:
 
 	int FindMaxChannelLayer();
 	int FindLayerIndex(const string& strLayerName);
+	const Blob<float>* GetCTCInputBlob(bool* is_prob, int* blank_index);
+	//recognize a long line as a batch of overlapping windows and stitch the
+	//ctc activations of the windows into one TxC sequence
+	void ForwardTiled(const cv::Mat& img, std::vector<float>& acts, int& timesteps, int& alphabet_size);
 
 	BKTree* pBKtree;
 	int idxBlank = 0;
@@ -106,6 +121,15 @@ private:
 
 	bool is_wcs_ = false;
 	shared_ptr<SyncedMemory> workspace_;
+
+	int tile_width_ = 0;
+	int tile_overlap_ = 0;
+	//stitched activations (Tx1xC) of the last tiled forward, used by lexicon rescoring
+	bool last_tiled_ = false;
+	std::vector<float> tiled_acts_;
+	std::vector<int> tiled_shape_;
+
+	bool reduced_decode_ = false;
 };
 
 
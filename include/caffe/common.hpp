@@ -166,6 +166,11 @@ class Caffe {
   inline static bool multiprocess() { return Get().multiprocess_; }
   inline static void set_multiprocess(bool val) { Get().multiprocess_ = val; }
   inline static bool root_solver() { return Get().solver_rank_ == 0; }
+  // Thread budget of parallel_for in CPU layers. Like the mode it is per
+  // thread, so every predictor thread can get its own budget; all of them
+  // share one pool of workers.
+  inline static int cpu_threads() { return Get().cpu_threads_; }
+  static void set_cpu_threads(const int num_threads);
 
  protected:
 #ifndef CPU_ONLY
@@ -180,6 +185,7 @@ class Caffe {
   int solver_count_;
   int solver_rank_;
   bool multiprocess_;
+  int cpu_threads_;
 
  private:
   // The private constructor to avoid duplicate instantiation.
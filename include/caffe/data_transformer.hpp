@@ -6,6 +6,7 @@
 #include "caffe/blob.hpp"
 #include "caffe/common.hpp"
 #include "caffe/proto/caffe.pb.h"
+#include "caffe/util/datum_view.hpp"
 
 namespace caffe {
 
@@ -24,6 +25,11 @@ class DataTransformer {
    *    transformation.
    */
   void InitRand();
+  /**
+   * @brief Same as InitRand(), but seeds the generator with seed, so that
+   *    transformers running on different threads give reproducible results.
+   */
+  void InitRand(unsigned int seed);
 
   /**
    * @brief Applies the transformation defined in the data layer's
@@ -36,6 +42,11 @@ class DataTransformer {
    *    set_cpu_data() is used. See data_layer.cpp for an example.
    */
   void Transform(const Datum& datum, Blob<Dtype>* transformed_blob);
+  /**
+   * @brief Same as Transform(const Datum&, Blob<Dtype>*), for a datum read
+   *    in place, e.g. straight from an LMDB page.
+   */
+  void Transform(const DatumView& datum, Blob<Dtype>* transformed_blob);
 
   /**
    * @brief Applies the transformation defined in the data layer's
@@ -75,6 +86,12 @@ class DataTransformer {
    *    set_cpu_data() is used. See image_data_layer.cpp for an example.
    */
   void Transform(const cv::Mat& cv_img, Blob<Dtype>* transformed_blob);
+
+  /**
+   * @brief Decodes an encoded datum the way Transform does, honouring
+   *    force_color, force_gray and the decode_* parameters.
+   */
+  cv::Mat Decode(const DatumView& datum);
 #endif  // USE_OPENCV
 
   /**
@@ -98,6 +115,7 @@ class DataTransformer {
    *    Datum containing the data to be transformed.
    */
   vector<int> InferBlobShape(const Datum& datum);
+  vector<int> InferBlobShape(const DatumView& datum);
   /**
    * @brief Infers the shape of transformed_blob will have when
    *    the transformation is applied to the data.
@@ -138,7 +156,7 @@ class DataTransformer {
    */
   virtual int Rand(int n);
 
-  void Transform(const Datum& datum, Dtype* transformed_data);
+  void Transform(const DatumView& datum, Dtype* transformed_data);
   // Tranformation parameters
   TransformationParameter param_;
 
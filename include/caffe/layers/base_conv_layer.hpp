@@ -30,11 +30,14 @@ class BaseConvolutionLayer : public Layer<Dtype> {
 
  protected:
   // Helper functions that abstract away the column buffer and gemm arguments.
-  // The last argument in forward_cpu_gemm is so that we can skip the im2col if
-  // we just called weight_cpu_gemm with the same input.
+  // The skip_im2col argument in forward_cpu_gemm is so that we can skip the
+  // im2col if we just called weight_cpu_gemm with the same input. col_buff
+  // replaces col_buffer_ for callers running several images concurrently.
   void forward_cpu_gemm(const Dtype* input, const Dtype* weights,
-      Dtype* output, bool skip_im2col = false);
+      Dtype* output, bool skip_im2col = false, Dtype* col_buff = NULL);
   void forward_cpu_bias(Dtype* output, const Dtype* bias);
+  /// @brief The size of a column buffer that forward_cpu_gemm can use.
+  inline int col_buffer_count() const { return col_buffer_.count(); }
   void backward_cpu_gemm(const Dtype* input, const Dtype* weights,
       Dtype* output);
   void weight_cpu_gemm(const Dtype* input, const Dtype* output, Dtype*
@@ -92,6 +95,7 @@ class BaseConvolutionLayer : public Layer<Dtype> {
   bool bias_term_;
   bool is_1x1_;
   bool force_nd_im2col_;
+  bool fused_relu_;
 
  private:
   // wrap im2col/col2im so we don't have to remember the (long) argument lists
@@ -1,6 +1,7 @@
 #ifndef CAFFE_DATA_LAYERS_HPP_
 #define CAFFE_DATA_LAYERS_HPP_
 
+#include <string>
 #include <vector>
 
 #include "caffe/blob.hpp"
@@ -9,6 +10,7 @@
 #include "caffe/layer.hpp"
 #include "caffe/proto/caffe.pb.h"
 #include "caffe/util/blocking_queue.hpp"
+#include "caffe/util/sample_cache.hpp"
 
 namespace caffe {
 
@@ -48,7 +50,30 @@ class BaseDataLayer : public Layer<Dtype> {
 template <typename Dtype>
 class Batch {
  public:
+  Batch() : read_us_(0), transform_us_(0), load_us_(0) {}
   Blob<Dtype> data_, label_;
+  // Valid length of each sample, for layers with a third top.
+  Blob<Dtype> length_;
+  // Time load_batch spent reading, decoding and transforming, and in total.
+  double read_us_, transform_us_, load_us_;
+};
+
+/// @brief Load times of the batches a prefetching layer has handed out, and
+///        how long Forward waited for them.
+struct PrefetchTimings {
+  PrefetchTimings()
+      : batches(0), read_us(0), transform_us(0), load_us(0), waits(0),
+        wait_us(0), queued(0) {}
+  int batches;
+  double read_us;
+  double transform_us;
+  double load_us;
+  // Number of Forwards that found no batch ready, and the time Forward spent
+  // waiting for its batch.
+  int waits;
+  double wait_us;
+  // Sum over Forwards of the batches that were ready when it was called.
+  double queued;
 };
 
 template <typename Dtype>
@@ -67,14 +92,40 @@ class BasePrefetchingDataLayer :
   virtual void Forward_gpu(const vector<Blob<Dtype>*>& bottom,
       const vector<Blob<Dtype>*>& top);
 
+  /// @brief Sums of the load times of the batches used by Forward so far.
+  const PrefetchTimings& timings() const { return timings_; }
+  void ResetTimings() { timings_ = PrefetchTimings(); }
+  /// @brief Number of prefetch batches; grows with data_param.adaptive_prefetch.
+  int prefetch_depth() const { return prefetch_.size(); }
+  /// @brief The decoded samples kept by data_param.sample_cache_bytes, or
+  ///        NULL.
+  const SampleCache* sample_cache() const { return sample_cache_.get(); }
+
  protected:
   virtual void InternalThreadEntry();
   virtual void load_batch(Batch<Dtype>* batch) = 0;
+  // Called by Forward: recycles the previous batch and waits for the next
+  // one, recording the timings.
+  Batch<Dtype>* NextBatch();
+  // Adds a prefetch batch shaped like current, unless that would exceed
+  // data_param.prefetch_max_bytes.
+  void GrowPrefetch(const Batch<Dtype>& current);
+#ifdef USE_OPENCV
+  // Looks a decoded (and resized) image up in the sample cache, which the
+  // prefetch workers may share; always false without a cache.
+  bool CachedSample(const string& key, cv::Mat* cv_img);
+  void CacheSample(const string& key, const cv::Mat& cv_img);
+#endif  // USE_OPENCV
 
   vector<shared_ptr<Batch<Dtype> > > prefetch_;
   BlockingQueue<Batch<Dtype>*> prefetch_free_;
   BlockingQueue<Batch<Dtype>*> prefetch_full_;
   Batch<Dtype>* prefetch_current_;
+  PrefetchTimings timings_;
+  // Forwards and waits since adaptive_prefetch last considered growing.
+  int window_batches_;
+  int window_waits_;
+  shared_ptr<SampleCache> sample_cache_;
 
   Blob<Dtype> transformed_data_;
 };
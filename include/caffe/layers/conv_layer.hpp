@@ -77,6 +77,9 @@ class ConvolutionLayer : public BaseConvolutionLayer<Dtype> {
       const vector<bool>& propagate_down, const vector<Blob<Dtype>*>& bottom);
   virtual inline bool reverse_dimensions() { return false; }
   virtual void compute_output_shape();
+
+  /// One column buffer per range of images that Forward_cpu runs at once.
+  Blob<Dtype> thread_col_buffers_;
 };
 
 }  // namespace caffe
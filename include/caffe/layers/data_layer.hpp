@@ -1,6 +1,7 @@
 #ifndef CAFFE_DATA_LAYER_HPP_
 #define CAFFE_DATA_LAYER_HPP_
 
+#include <string>
 #include <vector>
 
 #include "caffe/blob.hpp"
@@ -9,6 +10,7 @@
 #include "caffe/layer.hpp"
 #include "caffe/layers/base_data_layer.hpp"
 #include "caffe/proto/caffe.pb.h"
+#include "caffe/util/datum_view.hpp"
 #include "caffe/util/db.hpp"
 
 namespace caffe {
@@ -25,7 +27,9 @@ class DataLayer : public BasePrefetchingDataLayer<Dtype> {
   virtual inline const char* type() const { return "Data"; }
   virtual inline int ExactNumBottomBlobs() const { return 0; }
   virtual inline int MinTopBlobs() const { return 1; }
-  virtual inline int MaxTopBlobs() const { return 2; }
+  // The optional third top holds the valid width of each sample; it is only
+  // available with width buckets (data_param.bucket_width).
+  virtual inline int MaxTopBlobs() const { return 3; }
 
   vector< std::pair<std::string, vector<int> > > lines_;
   int line_id_;
@@ -33,13 +37,84 @@ class DataLayer : public BasePrefetchingDataLayer<Dtype> {
  protected:
   void Next();
   bool Skip();
+  // The current record, valid until Next() is called.
+  const char* Value(size_t* size);
+  // Steps through the DB in order, wrapping around at its end.
+  void NextRecord();
+  bool SkipRecord();
+  // Shuffled reads (data_param.shuffle).
+  void BuildKeyIndex();
+  bool LoadKeyIndex(const string& filename);
+  void SaveKeyIndex(const string& filename) const;
+  string Key(uint32_t index) const;
+  void NextKey();
+  void SeekKey();
+  void FillShuffleBuffer();
+  int ShuffleRand(int n);
   virtual void load_batch(Batch<Dtype>* batch);
+  // Decodes and transforms the items read into values_ on num_workers threads.
+  void TransformItems(Batch<Dtype>* batch);
+  // The DB key of the current record for the sample cache, or "" when there
+  // is no cache or the record comes out of the shuffle buffer.
+  string CacheKey();
+  // Like the DataTransformer methods, but encoded datums with a cache key are
+  // decoded through the sample cache.
+  vector<int> InferItemShape(const string& key, const DatumView& datum,
+      DataTransformer<Dtype>* transformer);
+  void TransformItem(const string& key, const DatumView& datum,
+      DataTransformer<Dtype>* transformer, Blob<Dtype>* blob);
+#ifdef USE_OPENCV
+  cv::Mat DecodeCached(const string& key, const DatumView& datum,
+      DataTransformer<Dtype>* transformer);
+#endif  // USE_OPENCV
+  // Width buckets: reads samples until bucket_window of them are pending, and
+  // builds a batch out of the samples of one bucket.
+  int BucketOf(int width) const;
+  void FillBucketWindow();
+  void LoadBucketedBatch(Batch<Dtype>* batch);
 
   shared_ptr<db::DB> db_;
   shared_ptr<db::Cursor> cursor_;
   uint64_t offset_;
 
   unsigned int rand_skip_num_;
+
+  // Used with data_param.shuffle: either all keys of the DB in one string,
+  // and the positions of this solver's keys in the order of the epoch, or
+  // shuffle_buffer records read in order and handed out at random.
+  string key_pool_;
+  vector<uint64_t> key_offsets_;
+  vector<uint32_t> key_order_;
+  int key_id_;
+  vector<string> shuffle_buffer_;
+  int buffer_slot_;
+  shared_ptr<Caffe::RNG> shuffle_rng_;
+  // With shuffled keys and num_workers > 1 every worker looks up the keys of
+  // its items with its own cursor.
+  vector<shared_ptr<db::Cursor> > worker_cursors_;
+  vector<uint32_t> item_keys_;
+
+  // Used when data_param.num_workers > 1: one transformer and output view
+  // per worker, and the values, parsed datums and random seeds of the batch
+  // items (datums_ only holds the items that cannot be parsed in place).
+  // cache_keys_ holds their CacheKey().
+  vector<shared_ptr<DataTransformer<Dtype> > > worker_transformers_;
+  vector<shared_ptr<Blob<Dtype> > > worker_data_;
+  vector<string> values_;
+  vector<string> cache_keys_;
+  vector<Datum> datums_;
+  vector<DatumView> views_;
+  vector<unsigned int> seeds_;
+
+  // Used with width buckets: the pending (decoded) samples of each bucket,
+  // the last bucket taking the samples wider than every boundary.
+  vector<vector<Datum> > buckets_;
+  int window_size_;
+  shared_ptr<DataTransformer<Dtype> > bucket_transformer_;
+  Blob<Dtype> bucket_item_;
+  vector<int> bucket_batches_;
+  uint64_t valid_pixels_;
+  uint64_t padded_pixels_;
 };
 
 }  // namespace caffe
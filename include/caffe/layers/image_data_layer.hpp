@@ -11,6 +11,7 @@
 #include "caffe/layer.hpp"
 #include "caffe/layers/base_data_layer.hpp"
 #include "caffe/proto/caffe.pb.h"
+#include "caffe/util/image_list.hpp"
 
 namespace caffe {
 
@@ -37,8 +38,9 @@ class ImageDataLayer : public BasePrefetchingDataLayer<Dtype> {
   virtual void ShuffleImages();
   virtual void load_batch(Batch<Dtype>* batch);
 
-  vector<std::pair<std::string, std::vector<int> > > lines_;
-  vector<std::pair<std::string, std::vector<float> > > regression_lines_;
+  ImageList list_;
+  // Shuffling permutes these indices into list_ instead of its lines.
+  vector<uint32_t> order_;
   int lines_id_;
 };
 
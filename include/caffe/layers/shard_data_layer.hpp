@@ -0,0 +1,55 @@
+#ifndef CAFFE_SHARD_DATA_LAYER_HPP_
+#define CAFFE_SHARD_DATA_LAYER_HPP_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "caffe/layer.hpp"
+#include "caffe/layers/base_data_layer.hpp"
+#include "caffe/proto/caffe.pb.h"
+#include "caffe/util/shard.hpp"
+
+namespace caffe {
+
+/**
+ * @brief Provides data to the Net from memory mapped sample shards.
+ *
+ * Pixels are converted straight from the mapping into the batch; only
+ * transform_param.scale and mean_value are applied. Samples are visited
+ * through a permutation of their indices that is redrawn every epoch.
+ */
+template <typename Dtype>
+class ShardDataLayer : public BasePrefetchingDataLayer<Dtype> {
+ public:
+  explicit ShardDataLayer(const LayerParameter& param)
+      : BasePrefetchingDataLayer<Dtype>(param) {}
+  virtual ~ShardDataLayer();
+  virtual void DataLayerSetUp(const vector<Blob<Dtype>*>& bottom,
+      const vector<Blob<Dtype>*>& top);
+
+  virtual inline const char* type() const { return "ShardData"; }
+  virtual inline int ExactNumBottomBlobs() const { return 0; }
+  virtual inline int MinTopBlobs() const { return 1; }
+  virtual inline int MaxTopBlobs() const { return 2; }
+
+ protected:
+  virtual void load_batch(Batch<Dtype>* batch);
+  void ShuffleSamples();
+  // Finds the shard and record of a sample.
+  void Locate(uint32_t sample, int* shard, int* record) const;
+
+  vector<shared_ptr<ShardReader> > shards_;
+  // First sample of each shard, plus the total.
+  vector<uint32_t> shard_begin_;
+  vector<uint32_t> order_;
+  int order_id_;
+  int max_width_;
+  shared_ptr<Caffe::RNG> prefetch_rng_;
+  vector<Dtype> mean_values_;
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_SHARD_DATA_LAYER_HPP_
@@ -88,6 +88,9 @@ class WarpCTCLossLayer : public LossLayer<Dtype> {
   // blank index of input sequence, set to -1 for last
   // if set to 0, the 'real' labels must start at 1
   int blank_index_;
+  // If > 0, bottom[2] holds sample widths and a time step covers this many
+  // pixels of them.
+  int input_stride_;
 
   vector<int> flat_labels_;
   vector<int> label_lengths_;
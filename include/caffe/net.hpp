@@ -83,6 +83,26 @@ class Net {
    */
   void Reshape();
 
+  /**
+   * @brief Lets activation blobs whose lifetimes do not overlap share backing
+   *        memory (TEST phase only).
+   *
+   * Each blob lives from the first layer writing it to the last layer reading
+   * it; blobs with disjoint lifetimes are placed in the same buffer. The net
+   * inputs, outputs and the blobs named in keep_blobs keep their own memory
+   * and stay readable after Forward; the contents of any other blob are
+   * undefined once Forward returns. The plan is redone whenever a Reshape
+   * makes a blob outgrow its buffer. Caffe::mode() must not change afterwards.
+   */
+  void ShareActivationMemory(const vector<string>& keep_blobs);
+  /// @brief Keeps the named blob readable after Forward when sharing memory.
+  void KeepBlob(const string& blob_name);
+  /// @brief Activation bytes with a buffer per blob, and with sharing enabled.
+  inline size_t activation_bytes() const { return activation_bytes_; }
+  inline size_t shared_activation_bytes() const {
+    return shared_activation_bytes_;
+  }
+
   Dtype ForwardBackward() {
     Dtype loss;
     Forward(&loss);
@@ -92,6 +112,26 @@ class Net {
 
   /// @brief Updates the network weights based on the diff values computed.
   void Update();
+  /**
+   * @brief Moves the learnable params, and their diffs, into one contiguous
+   *        buffer each, in the order of learnable_params().
+   *
+   * Solvers can then update all params in a few passes over the whole buffer
+   * instead of several calls per blob. The buffers live in the memory of the
+   * current Caffe::mode(); Params such as GPUParams may take them over as
+   * long as they keep the same layout.
+   */
+  void FlattenParams();
+  /// @brief Whether the params are contiguous in the current mode.
+  inline bool params_flat() const {
+    return params_flat_ && Caffe::mode() == flat_mode_;
+  }
+  /// @brief The total count of the learnable params.
+  inline size_t flat_params_count() const { return flat_params_count_; }
+  /// @brief The flat params and diffs in the current mode; params_flat() must
+  ///        hold. Marks every param as modified, like mutable_cpu_data.
+  Dtype* mutable_flat_data();
+  Dtype* mutable_flat_diff();
   /**
    * @brief Shares weight data of owner blobs with shared blobs.
    *
@@ -112,6 +152,9 @@ class Net {
    *        another Net.
    */
   void CopyTrainedLayersFrom(const NetParameter& param);
+  /// @brief Copies the weights of the layers of other, by layer name, so
+  ///        that other can keep training while this net uses them.
+  void CopyTrainedLayersFrom(const Net* other);
   void CopyTrainedLayersFrom(const string trained_filename);
   void CopyTrainedLayersFromBinaryProto(const string trained_filename);
   void CopyTrainedLayersFromHDF5(const string trained_filename);
@@ -119,6 +162,8 @@ class Net {
   void ToProto(NetParameter* param, bool write_diff = false) const;
   /// @brief Writes the net to an HDF5 file.
   void ToHDF5(const string& filename, bool write_diff = false) const;
+  /// @brief Writes the net as ToHDF5 does, into an in-memory file image.
+  void ToHDF5Image(string* image, bool write_diff = false) const;
 
   /// @brief returns the network name.
   inline const string& name() const { return name_; }
@@ -248,12 +293,20 @@ class Net {
   void AppendParam(const NetParameter& param, const int layer_id,
                    const int param_id);
 
+  /// @brief Helper for ShareTrainedLayersWith and CopyTrainedLayersFrom.
+  void TransferTrainedLayers(const Net* other, bool copy);
+  /// @brief Helper for ToHDF5 and ToHDF5Image: writes to filename unless
+  ///        image is set.
+  void WriteHDF5(const string& filename, bool write_diff, string* image) const;
   /// @brief Helper for displaying debug info in Forward.
   void ForwardDebugInfo(const int layer_id);
   /// @brief Helper for displaying debug info in Backward.
   void BackwardDebugInfo(const int layer_id);
   /// @brief Helper for displaying debug info in Update.
   void UpdateDebugInfo(const int param_id);
+  /// @brief Assigns activation buffers, see ShareActivationMemory. Unless
+  ///        force is set, only replans if a blob changed its memory.
+  void PlanActivationMemory(bool force);
 
   /// @brief The network name
   string name_;
@@ -308,10 +361,25 @@ class Net {
   /// the weight decay multipliers for learnable_params_
   vector<float> params_weight_decay_;
   vector<bool> has_params_decay_;
+  /// Contiguous params, see FlattenParams.
+  bool params_flat_;
+  Caffe::Brew flat_mode_;
+  size_t flat_params_count_;
+  shared_ptr<SyncedMemory> flat_data_;
+  shared_ptr<SyncedMemory> flat_diff_;
   /// The bytes of memory used by this net
   size_t memory_used_;
   /// Whether to compute and display debug info for the net.
   bool debug_info_;
+  /// Activation memory sharing, see ShareActivationMemory.
+  bool share_activations_;
+  set<string> keep_blobs_;
+  vector<shared_ptr<SyncedMemory> > activation_slabs_;
+  vector<SyncedMemory*> planned_memory_;
+  set<SyncedMemory*> slab_backed_;
+  Caffe::Brew planned_mode_;
+  size_t activation_bytes_;
+  size_t shared_activation_bytes_;
   /// The root net that actually holds the shared layers in data parallelism
   const Net* const root_net_;
   DISABLE_COPY_AND_ASSIGN(Net);
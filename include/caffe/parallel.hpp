@@ -2,7 +2,9 @@
 #define CAFFE_PARALLEL_HPP_
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <stdint.h>
 
+#include <string>
 #include <vector>
 
 #include "caffe/blob.hpp"
@@ -12,6 +14,7 @@
 #include "caffe/proto/caffe.pb.h"
 #include "caffe/solver.hpp"
 #include "caffe/syncedmem.hpp"
+#include "caffe/util/benchmark.hpp"
 #include "caffe/util/blocking_queue.hpp"
 
 namespace caffe {
@@ -116,6 +119,107 @@ class P2PSync : public GPUParams<Dtype>, public Solver<Dtype>::Callback,
   using Params<Dtype>::diff_;
 };
 
+// Synchronous data parallelism between CPU solver processes on one machine.
+// The parameters are kept once, in shared memory, next to one gradient
+// buffer per process. After backward every process sums its share of the
+// gradient buffers into the root's buffer, and only the root updates.
+// Data layers read every solver_count-th record, as with P2PSync.
+template<typename Dtype>
+class ShmSync : public Params<Dtype>, public Solver<Dtype>::Callback {
+ public:
+  // Caffe::solver_count() and solver_rank() must be set. The root (rank 0)
+  // creates the shared memory called name from its current parameters and
+  // iteration; the other processes open it, so start them afterwards.
+  ShmSync(shared_ptr<Solver<Dtype> > solver, const string& name);
+  virtual ~ShmSync();
+
+  inline const shared_ptr<Solver<Dtype> >& solver() const {
+    return solver_;
+  }
+  // Trains until max_iter: Solve on the root, Step on the other processes.
+  // They stop with the root when it stops early.
+  void Run();
+
+ protected:
+  void on_start();
+  void on_gradients_ready();
+  // Waits for all processes; false once the root has stopped.
+  bool Wait();
+  SolverAction::Enum RequestedAction();
+  void DisplayStats();
+
+  class Shm;
+  struct Header;
+  shared_ptr<Shm> shm_;
+  Header* header_;
+  Dtype* grads_;
+  shared_ptr<Solver<Dtype> > solver_;
+  bool stopped_;
+  // Time this process spent in forward/backward and waiting for the others.
+  CPUTimer timer_;
+  double compute_us_;
+  double sync_us_;
+  // Root only: totals over all processes at the last display.
+  CPUTimer display_timer_;
+  int display_iter_;
+  double display_compute_us_;
+  double display_sync_us_;
+
+  using Params<Dtype>::size_;
+  using Params<Dtype>::data_;
+  using Params<Dtype>::diff_;
+};
+
+// Asynchronous data parallelism between CPU threads (Hogwild). Every thread
+// runs its own solver, of the root's type, on a net whose parameter data is
+// the root's; activations, diffs and solver history are private. Each thread
+// applies its updates straight to the shared parameters, without locks.
+// Data layers read every solver_count-th record, as with ShmSync, and every
+// thread runs up to max_iter iterations of its own.
+template<typename Dtype>
+class HogwildSync : public Solver<Dtype>::Callback, public InternalThread {
+ public:
+  // Caffe::solver_count() is the number of threads, and must already have
+  // been set when the root solver was created.
+  explicit HogwildSync(shared_ptr<Solver<Dtype> > root_solver);
+  virtual ~HogwildSync();
+
+  inline const shared_ptr<Solver<Dtype> >& solver() const {
+    return solver_;
+  }
+  // Restores the solvers of the other threads; the root restores its own.
+  void Restore(const char* state_file);
+  // Trains until the root is done: Solve on the calling thread, Step on the
+  // others.
+  void Run();
+
+ protected:
+  HogwildSync(HogwildSync<Dtype>* root, int rank);
+  void on_start();
+  void on_gradients_ready() {}
+  void InternalThreadEntry();
+  // Waits for all threads still running; false once the root has stopped.
+  bool Wait();
+  // Leaves the barrier once this thread is done.
+  void Leave();
+  SolverAction::Enum RequestedAction();
+  void DisplayStats();
+
+  class Sync;
+  HogwildSync<Dtype>* root_;
+  // Root only: the other threads and their shared state.
+  vector<shared_ptr<HogwildSync<Dtype> > > workers_;
+  shared_ptr<Sync> sync_;
+  shared_ptr<Solver<Dtype> > solver_;
+  const int rank_;
+  const int cpu_threads_;
+  int start_iter_;
+  bool stopped_;
+  // Root only: iterations of all threads and time at the last display.
+  CPUTimer display_timer_;
+  int64_t display_iters_;
+};
+
 }  // namespace caffe
 
 #endif
@@ -8,6 +8,21 @@
 
 namespace caffe {
 
+/**
+ * @brief Gradient of one element as seen by the fused CPU updates: the
+ *        accumulated diff scaled by 1 / iter_size plus the L2 (l2 * w) or
+ *        L1 (l1 * sign(w)) weight decay term. The unused decay is zero, so
+ *        the loops stay branch free and vectorize.
+ */
+template <typename Dtype>
+struct FusedGradient {
+  Dtype scale, l2, l1;
+  inline Dtype operator()(Dtype g, Dtype w) const {
+    return scale * g + l2 * w
+        + l1 * (Dtype(Dtype(0) < w) - Dtype(w < Dtype(0)));
+  }
+};
+
 /**
  * @brief Optimizes the parameters of a Net using
  *        stochastic gradient descent (SGD) with momentum.
@@ -28,7 +43,14 @@ class SGDSolver : public Solver<Dtype> {
   Dtype GetLearningRate();
   virtual void ApplyUpdate();
   virtual void Normalize(int param_id);
+  // Normalizes all diffs at once when the params are flat.
+  void NormalizeFlat();
   virtual void Regularize(int param_id);
+  // Normalization and weight decay of param_id for the fused CPU updates.
+  FusedGradient<Dtype> GetFusedGradient(int param_id);
+  // On the GPU, turns the diff of param_id into the update. On the CPU the
+  // update is fused: it also normalizes and regularizes the diff and steps
+  // the weights, all in one pass over the param.
   virtual void ComputeUpdateValue(int param_id, Dtype rate);
   virtual void ClipGradients();
   virtual void SnapshotSolverState(const string& model_filename);
@@ -9,6 +9,8 @@
 
 namespace caffe {
 
+class SnapshotWriter;
+
 /**
   * @brief Enumeration of actions that a client of the Solver may request by
   * implementing the Solver's action request function, which a
@@ -66,6 +68,8 @@ class Solver {
   // function that produces a SolverState protocol buffer that needs to be
   // written to disk together with the learned net.
   void Snapshot();
+  // Blocks until the snapshots written in the background are on disk.
+  void WaitForSnapshots();
   virtual ~Solver() {}
   inline const SolverParameter& param() const { return param_; }
   inline shared_ptr<Net<Dtype> > net() { return net_; }
@@ -100,13 +104,26 @@ class Solver {
   string SnapshotFilename(const string extension);
   string SnapshotToBinaryProto();
   string SnapshotToHDF5();
+  // Writes a snapshot file atomically, on the snapshot thread if
+  // snapshot_async is set; proto and contents must not change anymore.
+  void WriteSnapshotFile(const string& filename,
+      const shared_ptr<const google::protobuf::Message>& proto);
+  void WriteSnapshotFile(const string& filename,
+      const shared_ptr<const string>& contents);
   // The test routine
   void TestAll();
   void Test(const int test_net_id = 0);
+  class TestThread;
+  // Runs and logs test_iter batches of a test net. Without a thread, this
+  // also handles the requested actions; with one, it only stops early when
+  // that thread is stopped.
+  void Evaluate(const int test_net_id, TestThread* thread);
   virtual void SnapshotSolverState(const string& model_filename) = 0;
   virtual void RestoreSolverStateFromHDF5(const string& state_file) = 0;
   virtual void RestoreSolverStateFromBinaryProto(const string& state_file) = 0;
   void DisplayOutputBlobs(const int net_id);
+  // Logs and resets the prefetch timings of the data layers of the train net.
+  void DisplayDataStats();
   void UpdateSmoothedLoss(Dtype loss, int start_iter, int average_loss);
 
   SolverParameter param_;
@@ -129,6 +146,11 @@ class Solver {
   // True iff a request to stop early was received.
   bool requested_early_exit_;
 
+  // Writes the snapshots in the background when snapshot_async is set.
+  shared_ptr<SnapshotWriter> snapshot_writer_;
+  // Evaluates the test nets in the background when test_async is set.
+  shared_ptr<TestThread> test_thread_;
+
   DISABLE_COPY_AND_ASSIGN(Solver);
 };
 
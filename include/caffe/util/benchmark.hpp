@@ -3,6 +3,10 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include "caffe/util/device_alternate.hpp"
 
 namespace caffe {
@@ -47,6 +51,40 @@ class CPUTimer : public Timer {
   virtual float MicroSeconds();
 };
 
+/**
+ * @brief Returns the p-th percentile (0 <= p <= 100) of samples,
+ *        interpolating linearly between the closest ranks, or 0 for no
+ *        samples.
+ */
+double Percentile(std::vector<double> samples, double p);
+
+/// The mean and percentiles of a set of timings; all 0 for no samples.
+struct PercentileSummary {
+  double mean;
+  double min;
+  double p50;
+  double p90;
+  double p99;
+};
+
+PercentileSummary Summarize(const std::vector<double>& samples);
+
+/// Returns Summarize(samples) as a JSON object with the keys mean, min,
+/// p50, p90 and p99, for the reports of the benchmark tools.
+std::string JsonPercentiles(const std::vector<double>& samples);
+
+/// Returns value as a quoted JSON string, escaping quotes, backslashes and
+/// control characters.
+std::string JsonString(const std::string& value);
+
+/// Parses a list of positive integers separated by ',', such as the
+/// -batch_sizes=1,8,64 of the benchmark tools; dies on anything else.
+std::vector<int> ParseIntList(const std::string& list);
+
+/// Returns the peak resident memory of this process in bytes, or 0 where
+/// it is not available.
+size_t PeakMemoryBytes();
+
 }  // namespace caffe
 
 #endif   // CAFFE_UTIL_BENCHMARK_H_
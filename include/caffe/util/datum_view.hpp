@@ -0,0 +1,46 @@
+#ifndef CAFFE_UTIL_DATUM_VIEW_HPP_
+#define CAFFE_UTIL_DATUM_VIEW_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "caffe/common.hpp"
+#include "caffe/proto/caffe.pb.h"
+
+namespace caffe {
+
+/**
+ * @brief A Datum whose data bytes are not owned: they point into the buffer
+ *        it was parsed from (e.g. an LMDB page) or into a Datum.
+ *
+ * Reading through a view skips the copy of the value into a string and the
+ * copy of the pixels or encoded image into Datum::data.
+ */
+struct DatumView {
+  DatumView()
+      : channels(0), height(0), width(0), encoded(false),
+        data(NULL), data_size(0), float_data(NULL) {}
+  explicit DatumView(const Datum& datum);
+
+  int channels;
+  int height;
+  int width;
+  bool encoded;
+  // Pixels (c, h, w order) or the encoded image.
+  const char* data;
+  size_t data_size;
+  // channels * height * width values when the datum holds float data.
+  const float* float_data;
+  vector<int> labels;
+};
+
+/**
+ * @brief Parses a serialized Datum in place. Returns false if the record
+ *        holds float data, which is not stored contiguously; parse it into
+ *        a Datum instead.
+ */
+bool ParseDatumView(const char* buffer, size_t size, DatumView* view);
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_DATUM_VIEW_HPP_
@@ -18,7 +18,18 @@ class Cursor {
   virtual void Next() = 0;
   virtual string key() = 0;
   virtual string value() = 0;
+  // The value without copying it; only valid until the cursor moves.
+  virtual const char* value_data(size_t* size) {
+    value_ = value();
+    *size = value_.size();
+    return value_.data();
+  }
   virtual bool valid() = 0;
+  // Moves to the record with this key; returns false if there is none.
+  virtual bool Seek(const string& key) = 0;
+
+ private:
+  string value_;
 
   DISABLE_COPY_AND_ASSIGN(Cursor);
 };
@@ -20,7 +20,15 @@ class LevelDBCursor : public Cursor {
   virtual void Next() { iter_->Next(); }
   virtual string key() { return iter_->key().ToString(); }
   virtual string value() { return iter_->value().ToString(); }
+  virtual const char* value_data(size_t* size) {
+    *size = iter_->value().size();
+    return iter_->value().data();
+  }
   virtual bool valid() { return iter_->Valid(); }
+  virtual bool Seek(const string& key) {
+    iter_->Seek(key);
+    return iter_->Valid() && iter_->key() == key;
+  }
 
  private:
   leveldb::Iterator* iter_;
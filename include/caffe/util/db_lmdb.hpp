@@ -34,7 +34,28 @@ class LMDBCursor : public Cursor {
     return string(static_cast<const char*>(mdb_value_.mv_data),
         mdb_value_.mv_size);
   }
+  // Points into the memory map, which stays valid as long as the read-only
+  // transaction of the cursor is open.
+  virtual const char* value_data(size_t* size) {
+    *size = mdb_value_.mv_size;
+    return static_cast<const char*>(mdb_value_.mv_data);
+  }
   virtual bool valid() { return valid_; }
+  // A point lookup in the memory map, like mdb_get, that also leaves the
+  // cursor on the record.
+  virtual bool Seek(const string& key) {
+    mdb_key_.mv_size = key.size();
+    mdb_key_.mv_data = const_cast<char*>(key.data());
+    int mdb_status = mdb_cursor_get(mdb_cursor_, &mdb_key_, &mdb_value_,
+        MDB_SET_KEY);
+    if (mdb_status == MDB_NOTFOUND) {
+      valid_ = false;
+    } else {
+      MDB_CHECK(mdb_status);
+      valid_ = true;
+    }
+    return valid_;
+  }
 
  private:
   void Seek(MDB_cursor_op op) {
@@ -0,0 +1,19 @@
+#ifndef CAFFE_UTIL_FOLD_BATCHNORM_HPP_
+#define CAFFE_UTIL_FOLD_BATCHNORM_HPP_
+
+#include "caffe/proto/caffe.pb.h"
+
+namespace caffe {
+
+// Fold BatchNorm (and a following Scale) layers that directly follow a
+// Convolution or InnerProduct layer into its weights and bias, and fuse a
+// ReLU that follows a Convolution into its output (fused_relu). The
+// architecture is taken from param (filtered for TEST) and the trained blobs
+// from weights (a .caffemodel); the results are written to folded_param and
+// folded_weights. Returns the number of folded layers.
+int FoldBatchNorm(const NetParameter& param, const NetParameter& weights,
+    NetParameter* folded_param, NetParameter* folded_weights);
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_FOLD_BATCHNORM_HPP_
@@ -31,6 +31,11 @@ string hdf5_load_string(hid_t loc_id, const string& dataset_name);
 void hdf5_save_string(hid_t loc_id, const string& dataset_name,
                       const string& s);
 
+// Creates an HDF5 file that lives in memory only; see hdf5_file_image.
+hid_t hdf5_create_in_memory();
+// Returns the bytes of file_id as they would be written to disk.
+string hdf5_file_image(hid_t file_id);
+
 int hdf5_get_num_links(hid_t loc_id);
 string hdf5_get_name_by_idx(hid_t loc_id, int idx);
 
@@ -0,0 +1,96 @@
+#ifndef CAFFE_UTIL_IMAGE_LIST_HPP_
+#define CAFFE_UTIL_IMAGE_LIST_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "caffe/common.hpp"
+
+namespace boost { namespace interprocess {
+class file_mapping;
+class mapped_region;
+} }
+
+namespace caffe {
+
+/**
+ * @brief Header of a binary image list index, the parsed form of a list
+ *        file of "filename label..." lines.
+ *
+ * The header is followed by num_images uint64 name offsets into the name
+ * pool, num_images + 1 uint64 offsets into the labels, num_labels int32 (or
+ * float for regression lists) labels and the pool of NUL terminated names.
+ * source_size and source_mtime identify the list file it was built from.
+ */
+struct ImageListHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t regression;
+  uint64_t source_size;
+  int64_t source_mtime;
+  uint64_t num_images;
+  uint64_t num_labels;
+  uint64_t pool_size;
+};
+
+/**
+ * @brief The images and labels of a list file, stored flat: one pool for
+ *        all the names and one array for all the labels.
+ *
+ * A classification line is "filename label..." where the filename ends at
+ * the first blank after its extension, so it may contain spaces. A
+ * regression line is "filename value..." with a filename without spaces.
+ */
+class ImageList {
+ public:
+  ImageList();
+  ~ImageList();
+  /**
+   * Parses source. With an index filename, maps the index instead when it
+   * was built from the same source, and (re)builds it otherwise.
+   */
+  void Load(const string& source, bool regression, const string& index);
+
+  inline int size() const { return num_images_; }
+  inline const char* name(int i) const { return pool_ + name_offsets_[i]; }
+  inline int label_count(int i) const {
+    return label_offsets_[i + 1] - label_offsets_[i];
+  }
+  /// Integer labels of a classification list.
+  inline const int32_t* labels(int i) const {
+    return reinterpret_cast<const int32_t*>(labels_) + label_offsets_[i];
+  }
+  /// Float values of a regression list.
+  inline const float* values(int i) const {
+    return reinterpret_cast<const float*>(labels_) + label_offsets_[i];
+  }
+
+ private:
+  void Parse(const string& source, bool regression);
+  bool Map(const string& index, const ImageListHeader& expected);
+  void Write(const string& index, const ImageListHeader& header) const;
+  void Clear();
+
+  int num_images_;
+  const uint64_t* name_offsets_;
+  const uint64_t* label_offsets_;
+  const void* labels_;
+  const char* pool_;
+
+  // Backing store of a parsed list.
+  vector<uint64_t> parsed_name_offsets_;
+  vector<uint64_t> parsed_label_offsets_;
+  vector<int32_t> parsed_labels_;
+  vector<char> parsed_pool_;
+  // Backing store of a mapped index.
+  shared_ptr<boost::interprocess::file_mapping> mapping_;
+  shared_ptr<boost::interprocess::mapped_region> region_;
+
+  DISABLE_COPY_AND_ASSIGN(ImageList);
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_IMAGE_LIST_HPP_
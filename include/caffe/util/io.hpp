@@ -90,6 +90,10 @@ inline void WriteProtoToBinaryFile(
   WriteProtoToBinaryFile(proto, filename.c_str());
 }
 
+// Writes contents to a temporary file next to filename, flushes it to disk
+// and renames it over filename, so readers never see a partial file.
+void WriteFileAtomically(const string& contents, const string& filename);
+
 bool ReadFileToDatum(const string& filename, const std::vector<int>& labels, Datum* datum);
 
 inline bool ReadFileToDatum(const string& filename, Datum* datum) {
@@ -130,6 +134,14 @@ bool DecodeDatumNative(Datum* datum);
 bool DecodeDatum(Datum* datum, bool is_color);
 
 #ifdef USE_OPENCV
+// With reduced_decode, JPEGs that are 2, 4 or 8 times as large as the
+// target size are scaled down by that much while they are decoded, so the
+// resize starts from a smaller image. The result is close to, but not
+// exactly, a full decode followed by the resize.
+cv::Mat ReadImageToCVMat(const string& filename,
+    const int height, const int width, const bool is_color,
+    const bool reduced_decode);
+
 cv::Mat ReadImageToCVMat(const string& filename,
     const int height, const int width, const bool is_color);
 
@@ -144,6 +156,16 @@ cv::Mat ReadImageToCVMat(const string& filename);
 cv::Mat DecodeDatumToCVMatNative(const Datum& datum);
 cv::Mat DecodeDatumToCVMat(const Datum& datum, bool is_color);
 
+// Decode an encoded image held in memory without copying it first.
+cv::Mat DecodeBufferToCVMatNative(const char* buffer, size_t size);
+cv::Mat DecodeBufferToCVMat(const char* buffer, size_t size, bool is_color);
+// Decode and resize like ReadImageToCVMat.
+cv::Mat DecodeBufferToCVMatNative(const char* buffer, size_t size,
+    const int height, const int width, const bool reduced_decode);
+cv::Mat DecodeBufferToCVMat(const char* buffer, size_t size,
+    const int height, const int width, const bool is_color,
+    const bool reduced_decode);
+
 void CVMatToDatum(const cv::Mat& cv_img, Datum* datum);
 #endif  // USE_OPENCV
 
@@ -0,0 +1,66 @@
+#ifndef CAFFE_UTIL_SAMPLE_CACHE_HPP_
+#define CAFFE_UTIL_SAMPLE_CACHE_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "caffe/common.hpp"
+
+namespace caffe {
+
+/// @brief Shape of a cached sample: rows x cols pixels of channels uint8.
+struct SampleShape {
+  int rows;
+  int cols;
+  int channels;
+  inline size_t size() const {
+    return static_cast<size_t>(rows) * cols * channels;
+  }
+};
+
+struct SampleCacheStats {
+  SampleCacheStats() : hits(0), misses(0), samples(0), bytes(0) {}
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t samples;
+  // Bytes of the arenas in use.
+  uint64_t bytes;
+};
+
+/**
+ * @brief Keeps decoded samples in memory, by key, until a byte budget is
+ *        spent; samples are never evicted.
+ *
+ * The keys are spread over shards that each own a lock, an index and an
+ * arena of large blocks the samples are appended to, so that workers rarely
+ * wait for each other. Samples can be LZ4 compressed (needs USE_LZ4).
+ */
+class SampleCache {
+ public:
+  SampleCache(uint64_t budget, bool compress);
+  ~SampleCache();
+
+  /// Copies the sample stored under key into pixels; false on a miss.
+  bool Get(const string& key, SampleShape* shape, vector<uint8_t>* pixels);
+  /// Stores a sample unless its key is known or the budget is spent.
+  void Put(const string& key, const SampleShape& shape,
+      const uint8_t* pixels);
+  SampleCacheStats stats() const;
+
+ private:
+  struct Shard;
+  Shard& ShardOf(const string& key);
+  char* Allocate(Shard* shard, size_t size);
+
+  vector<shared_ptr<Shard> > shards_;
+  uint64_t shard_budget_;
+  bool compress_;
+
+  DISABLE_COPY_AND_ASSIGN(SampleCache);
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_SAMPLE_CACHE_HPP_
@@ -0,0 +1,122 @@
+#ifndef CAFFE_UTIL_SHARD_HPP_
+#define CAFFE_UTIL_SHARD_HPP_
+
+#include <stdint.h>
+
+#include <fstream>  // NOLINT(readability/streams)
+#include <string>
+#include <vector>
+
+#include "caffe/common.hpp"
+
+/**
+ Forward declare the boost::interprocess mapping classes instead of
+ including their headers, like internal_thread.hpp does for boost::thread.
+ */
+namespace boost { namespace interprocess {
+class file_mapping;
+class mapped_region;
+} }
+
+namespace caffe {
+
+/**
+ * @brief Header of a sample shard: raw uint8 pixels and uint16 labels of
+ *        samples that share channels, height and label count.
+ *
+ * The header is followed by the records; a record holds label_count uint16
+ * labels and then channels * height * width pixels in (c, h, w) order. When
+ * all samples have the same width (width > 0) the records have a fixed
+ * stride and there is no index. Otherwise index_offset points to
+ * num_records ShardIndexEntry, one per record. Records start at even
+ * offsets. Everything is little endian.
+ */
+struct ShardHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t channels;
+  uint32_t height;
+  uint32_t width;
+  uint32_t label_count;
+  uint32_t reserved;
+  uint64_t num_records;
+  uint64_t index_offset;
+};
+
+struct ShardIndexEntry {
+  uint64_t offset;
+  uint32_t width;
+  uint32_t reserved;
+};
+
+/// Labels are stored as uint16; this value reads back as -1.
+const uint16_t kShardNoLabel = 0xFFFF;
+
+/**
+ * @brief Writes a shard. Pass width 0 to Open for samples of varying width.
+ */
+class ShardWriter {
+ public:
+  ShardWriter() : num_records_(0) {}
+  ~ShardWriter() { Close(); }
+  void Open(const string& filename, int channels, int height, int width,
+      int label_count);
+  /// Appends a sample; labels beyond label_count are an error, missing ones
+  /// are written as kShardNoLabel.
+  void Write(const uint8_t* pixels, int width, const vector<int>& labels);
+  void Close();
+
+ private:
+  std::ofstream file_;
+  ShardHeader header_;
+  uint64_t num_records_;
+  vector<ShardIndexEntry> index_;
+  vector<uint16_t> labels_;
+
+  DISABLE_COPY_AND_ASSIGN(ShardWriter);
+};
+
+/**
+ * @brief Memory maps a shard; record pointers stay valid while it is open.
+ */
+class ShardReader {
+ public:
+  ShardReader();
+  ~ShardReader();
+  void Open(const string& filename);
+
+  inline int num_records() const { return header_.num_records; }
+  inline int channels() const { return header_.channels; }
+  inline int height() const { return header_.height; }
+  inline int label_count() const { return header_.label_count; }
+  /// 0 if the width varies between records.
+  inline int fixed_width() const { return header_.width; }
+  inline int width(int record) const {
+    return header_.width ? header_.width : index_[record].width;
+  }
+  inline const uint16_t* labels(int record) const {
+    return reinterpret_cast<const uint16_t*>(base_ + offset(record));
+  }
+  inline const uint8_t* pixels(int record) const {
+    return base_ + offset(record) + 2 * header_.label_count;
+  }
+
+ private:
+  inline uint64_t offset(int record) const {
+    return header_.width ? sizeof(ShardHeader) + record * stride_ :
+        index_[record].offset;
+  }
+
+  shared_ptr<boost::interprocess::file_mapping> mapping_;
+  shared_ptr<boost::interprocess::mapped_region> region_;
+  const uint8_t* base_;
+  ShardHeader header_;
+  uint64_t stride_;
+  const ShardIndexEntry* index_;
+
+  DISABLE_COPY_AND_ASSIGN(ShardReader);
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_SHARD_HPP_
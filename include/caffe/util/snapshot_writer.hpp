@@ -0,0 +1,55 @@
+#ifndef CAFFE_UTIL_SNAPSHOT_WRITER_HPP_
+#define CAFFE_UTIL_SNAPSHOT_WRITER_HPP_
+
+#include <deque>
+#include <string>
+
+#include "caffe/common.hpp"
+#include "caffe/internal_thread.hpp"
+#include "caffe/proto/caffe.pb.h"
+
+namespace caffe {
+
+/**
+ * @brief Serializes and writes snapshot files on a background thread, so
+ *        that training only pays for copying the state it snapshots.
+ *
+ * Files are written in the order they were queued, each one atomically
+ * (see WriteFileAtomically), and logged once they are on disk.
+ */
+class SnapshotWriter : public InternalThread {
+ public:
+  SnapshotWriter();
+  /// Finishes the queued writes.
+  virtual ~SnapshotWriter();
+
+  /// Queues proto, which must not be changed anymore, to be written.
+  void Write(const string& filename,
+      const shared_ptr<const google::protobuf::Message>& proto);
+  /// Queues raw file contents to be written.
+  void Write(const string& filename, const shared_ptr<const string>& contents);
+  /// Blocks until all queued files are written.
+  void Wait();
+
+ protected:
+  virtual void InternalThreadEntry();
+
+ private:
+  struct Job {
+    string filename;
+    shared_ptr<const google::protobuf::Message> proto;
+    shared_ptr<const string> contents;
+  };
+  void Push(const Job& job);
+
+  class Sync;
+  shared_ptr<Sync> sync_;
+  // Pending jobs; the front one stays queued while it is being written.
+  std::deque<Job> jobs_;
+
+  DISABLE_COPY_AND_ASSIGN(SnapshotWriter);
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_SNAPSHOT_WRITER_HPP_
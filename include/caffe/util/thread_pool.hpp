@@ -0,0 +1,67 @@
+#ifndef CAFFE_UTIL_THREAD_POOL_HPP_
+#define CAFFE_UTIL_THREAD_POOL_HPP_
+
+#include <algorithm>
+
+#include "caffe/common.hpp"
+
+namespace caffe {
+
+/**
+ * @brief Process-wide pool of worker threads behind parallel_for.
+ *
+ * All nets and predictors of a process share the same workers, so running
+ * several predictors with a budget of Caffe::cpu_threads() each does not
+ * start more threads than the largest budget asked for.
+ */
+class ThreadPool {
+ public:
+  /// @brief Makes sure there are enough workers for a budget of num_threads.
+  static void Reserve(int num_threads);
+  /// @brief Number of worker threads, not counting callers of Run.
+  static int num_workers();
+  /**
+   * @brief Calls fn(arg, begin, end) on num_chunks contiguous ranges of
+   *        [0, n) and returns once all of them are done. The calling thread
+   *        runs ranges too.
+   */
+  static void Run(int n, int num_chunks, void (*fn)(void*, int, int),
+      void* arg);
+  /// @brief Whether the current thread is running a range of a Run.
+  static bool InParallelRegion();
+
+ private:
+  ThreadPool() {}
+};
+
+/// Elementwise loops are not split into ranges shorter than this.
+const int kElementwiseGrain = 16384;
+
+template <typename Body>
+void ParallelForRange(void* body, int begin, int end) {
+  (*static_cast<const Body*>(body))(begin, end);
+}
+
+/**
+ * @brief Splits [0, n) into at most Caffe::cpu_threads() ranges of at least
+ *        grain items and calls body(begin, end) on each of them.
+ *
+ * Ranges must write disjoint outputs. Calls made from inside a range run
+ * serially, so nested loops never multiply the thread budget.
+ */
+template <typename Body>
+void parallel_for(int n, const Body& body, int grain = 1) {
+  if (n <= 0) { return; }
+  const int num_chunks = std::min(Caffe::cpu_threads(),
+      n / std::max(grain, 1));
+  if (num_chunks <= 1 || ThreadPool::InParallelRegion()) {
+    body(0, n);
+    return;
+  }
+  ThreadPool::Run(n, num_chunks, &ParallelForRange<Body>,
+      const_cast<Body*>(&body));
+}
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_THREAD_POOL_HPP_
@@ -0,0 +1,82 @@
+#ifndef CAFFE_UTIL_TRACE_HPP_
+#define CAFFE_UTIL_TRACE_HPP_
+
+#include <stdint.h>
+
+#include <atomic>  // NOLINT(build/c++11)
+#include <string>
+
+#include "caffe/common.hpp"
+
+namespace caffe {
+
+/**
+ * @brief Records a timeline of the layers, data loading, memory transfers
+ *        and solver phases of this process, to be viewed in
+ *        chrome://tracing.
+ *
+ * Each thread records into its own ring buffer without locking, so only the
+ * last events of each thread are kept. While tracing is off, a TraceScope
+ * costs one branch. Names given as char pointers are not copied and must
+ * outlive Write(); string names are copied once per thread.
+ * In GPU mode the events show when work was queued, not when it ran.
+ */
+class Trace {
+ public:
+  /// Starts recording, keeping the last events_per_thread events of each
+  /// thread. Call it while no traced code runs.
+  static void Start(int events_per_thread);
+  static void Stop();
+  /// Writes the recorded events in the Chrome trace-event JSON format.
+  /// Call it after Stop().
+  static void Write(const string& filename);
+
+  /// A relaxed load: a thread may record a few events past Stop() or miss
+  /// the first ones after Start().
+  inline static bool enabled() {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+  /// Nanoseconds since Start().
+  static int64_t Now();
+  static void Record(const char* category, const char* name, int64_t begin,
+      int64_t end);
+  static void Record(const char* category, const string& name, int64_t begin,
+      int64_t end);
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+/// Records the lifetime of the scope as one event while tracing.
+class TraceScope {
+ public:
+  TraceScope(const char* category, const char* name)
+      : category_(category), name_(name), string_name_(NULL),
+        begin_(Trace::enabled() ? Trace::Now() : -1) {}
+  /// For names that may not outlive Write(), e.g. layer names.
+  TraceScope(const char* category, const string& name)
+      : category_(category), name_(NULL), string_name_(&name),
+        begin_(Trace::enabled() ? Trace::Now() : -1) {}
+  ~TraceScope() {
+    if (begin_ < 0) {
+      return;
+    }
+    if (string_name_) {
+      Trace::Record(category_, *string_name_, begin_, Trace::Now());
+    } else {
+      Trace::Record(category_, name_, begin_, Trace::Now());
+    }
+  }
+
+ private:
+  const char* category_;
+  const char* name_;
+  const string* string_name_;
+  int64_t begin_;
+
+  DISABLE_COPY_AND_ASSIGN(TraceScope);
+};
+
+}  // namespace caffe
+
+#endif  // CAFFE_UTIL_TRACE_HPP_
@@ -6,6 +6,7 @@
 
 #include "caffe/common.hpp"
 #include "caffe/util/rng.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 #include <boost/date_time.hpp>
 #include <process.h>
@@ -24,6 +25,12 @@ Caffe& Caffe::Get() {
   return *(thread_instance_.get());
 }
 
+void Caffe::set_cpu_threads(const int num_threads) {
+  CHECK_GE(num_threads, 1) << "At least one CPU thread is needed.";
+  Get().cpu_threads_ = num_threads;
+  ThreadPool::Reserve(num_threads);
+}
+
 // random seeding
 int64_t cluster_seedgen(void) {
   int64_t s, seed, pid;
@@ -82,7 +89,8 @@ void GlobalInit(int* pargc, char*** pargv) {
 
 Caffe::Caffe()
     : random_generator_(), mode_(Caffe::CPU),
-      solver_count_(1), solver_rank_(0), multiprocess_(false) { }
+      solver_count_(1), solver_rank_(0), multiprocess_(false),
+      cpu_threads_(1) { }
 
 Caffe::~Caffe() { }
 
@@ -136,7 +144,8 @@ void* Caffe::RNG::generator() {
 Caffe::Caffe()
     : cublas_handle_(NULL), curand_generator_(NULL), random_generator_(),
     mode_(Caffe::CPU),
-    solver_count_(1), solver_rank_(0), multiprocess_(false) {
+    solver_count_(1), solver_rank_(0), multiprocess_(false),
+    cpu_threads_(1) {
   // Try to create a cublas handler, and report an error if failed (but we will
   // keep the program running as one might just want to run CPU code).
   if (cublasCreate(&cublas_handle_) != CUBLAS_STATUS_SUCCESS) {
@@ -104,8 +104,9 @@ void DataReader::Body::InternalThreadEntry() {
 
 void DataReader::Body::read_one(db::Cursor* cursor, QueuePair* qp) {
   Datum* datum = qp->free_.pop();
-  // TODO deserialize in-place instead of copy?
-  datum->ParseFromString(cursor->value());
+  size_t size;
+  const char* value = cursor->value_data(&size);
+  datum->ParseFromArray(value, size);
   qp->full_.push(datum);
 
   // go to the next iter
@@ -39,20 +39,21 @@ DataTransformer<Dtype>::DataTransformer(const TransformationParameter& param,
 }
 
 template<typename Dtype>
-void DataTransformer<Dtype>::Transform(const Datum& datum,
+void DataTransformer<Dtype>::Transform(const DatumView& datum,
                                        Dtype* transformed_data) {
-  const string& data = datum.data();
-  const int datum_channels = datum.channels();
-  const int datum_height = datum.height();
-  const int datum_width = datum.width();
+  const char* data = datum.data;
+  const int datum_channels = datum.channels;
+  const int datum_height = datum.height;
+  const int datum_width = datum.width;
 
   const int crop_size = param_.crop_size();
   const Dtype scale = param_.scale();
   const bool do_mirror = param_.mirror() && Rand(2);
   const bool has_mean_file = param_.has_mean_file();
-  const bool has_uint8 = data.size() > 0;
+  const bool has_uint8 = datum.data_size > 0;
   const bool has_mean_values = mean_values_.size() > 0;
 
+  CHECK(has_uint8 || datum.float_data) << "Datum holds no data";
   CHECK_GT(datum_channels, 0);
   CHECK_GE(datum_height, crop_size);
   CHECK_GE(datum_width, crop_size);
@@ -108,7 +109,7 @@ void DataTransformer<Dtype>::Transform(const Datum& datum,
           datum_element =
             static_cast<Dtype>(static_cast<uint8_t>(data[data_index]));
         } else {
-          datum_element = datum.float_data(data_index);
+          datum_element = datum.float_data[data_index];
         }
         if (has_mean_file) {
           transformed_data[top_index] =
@@ -130,18 +131,16 @@ void DataTransformer<Dtype>::Transform(const Datum& datum,
 template<typename Dtype>
 void DataTransformer<Dtype>::Transform(const Datum& datum,
                                        Blob<Dtype>* transformed_blob) {
+  Transform(DatumView(datum), transformed_blob);
+}
+
+template<typename Dtype>
+void DataTransformer<Dtype>::Transform(const DatumView& datum,
+                                       Blob<Dtype>* transformed_blob) {
   // If datum is encoded, decoded and transform the cv::image.
-  if (datum.encoded()) {
+  if (datum.encoded) {
 #ifdef USE_OPENCV
-    CHECK(!(param_.force_color() && param_.force_gray()))
-        << "cannot set both force_color and force_gray";
-    cv::Mat cv_img;
-    if (param_.force_color() || param_.force_gray()) {
-    // If force_color then decode in color otherwise decode in gray.
-      cv_img = DecodeDatumToCVMat(datum, param_.force_color());
-    } else {
-      cv_img = DecodeDatumToCVMatNative(datum);
-    }
+    cv::Mat cv_img = Decode(datum);
     // Transform the cv::image into blob.
     return Transform(cv_img, transformed_blob);
 #else
@@ -154,9 +153,9 @@ void DataTransformer<Dtype>::Transform(const Datum& datum,
   }
 
   const int crop_size = param_.crop_size();
-  const int datum_channels = datum.channels();
-  const int datum_height = datum.height();
-  const int datum_width = datum.width();
+  const int datum_channels = datum.channels;
+  const int datum_height = datum.height;
+  const int datum_width = datum.width;
 
   // Check dimensions.
   const int channels = transformed_blob->channels();
@@ -222,6 +221,21 @@ void DataTransformer<Dtype>::Transform(const vector<cv::Mat> & mat_vector,
   }
 }
 
+template<typename Dtype>
+cv::Mat DataTransformer<Dtype>::Decode(const DatumView& datum) {
+  CHECK(!(param_.force_color() && param_.force_gray()))
+      << "cannot set both force_color and force_gray";
+  const int height = param_.decode_height();
+  const int width = param_.decode_width();
+  if (param_.force_color() || param_.force_gray()) {
+    // If force_color then decode in color otherwise decode in gray.
+    return DecodeBufferToCVMat(datum.data, datum.data_size, height, width,
+        param_.force_color(), param_.reduced_decode());
+  }
+  return DecodeBufferToCVMatNative(datum.data, datum.data_size, height,
+      width, param_.reduced_decode());
+}
+
 template<typename Dtype>
 void DataTransformer<Dtype>::Transform(const cv::Mat& cv_img,
                                        Blob<Dtype>* transformed_blob) {
@@ -484,17 +498,14 @@ void DataTransformer<Dtype>::Transform(Blob<Dtype>* input_blob,
 
 template<typename Dtype>
 vector<int> DataTransformer<Dtype>::InferBlobShape(const Datum& datum) {
-  if (datum.encoded()) {
+  return InferBlobShape(DatumView(datum));
+}
+
+template<typename Dtype>
+vector<int> DataTransformer<Dtype>::InferBlobShape(const DatumView& datum) {
+  if (datum.encoded) {
 #ifdef USE_OPENCV
-    CHECK(!(param_.force_color() && param_.force_gray()))
-        << "cannot set both force_color and force_gray";
-    cv::Mat cv_img;
-    if (param_.force_color() || param_.force_gray()) {
-    // If force_color then decode in color otherwise decode in gray.
-      cv_img = DecodeDatumToCVMat(datum, param_.force_color());
-    } else {
-      cv_img = DecodeDatumToCVMatNative(datum);
-    }
+    cv::Mat cv_img = Decode(datum);
     // InferBlobShape using the cv::image.
     return InferBlobShape(cv_img);
 #else
@@ -502,9 +513,9 @@ vector<int> DataTransformer<Dtype>::InferBlobShape(const Datum& datum) {
 #endif  // USE_OPENCV
   }
   const int crop_size = param_.crop_size();
-  const int datum_channels = datum.channels();
-  const int datum_height = datum.height();
-  const int datum_width = datum.width();
+  const int datum_channels = datum.channels;
+  const int datum_height = datum.height;
+  const int datum_width = datum.width;
   // Check dimensions.
   CHECK_GT(datum_channels, 0);
   CHECK_GE(datum_height, crop_size);
@@ -575,6 +586,17 @@ void DataTransformer<Dtype>::InitRand() {
   }
 }
 
+template <typename Dtype>
+void DataTransformer<Dtype>::InitRand(unsigned int seed) {
+  const bool needs_rand = param_.mirror() ||
+      (phase_ == TRAIN && param_.crop_size());
+  if (needs_rand) {
+    rng_.reset(new Caffe::RNG(seed));
+  } else {
+    rng_.reset();
+  }
+}
+
 template <typename Dtype>
 int DataTransformer<Dtype>::Rand(int n) {
   CHECK(rng_);
@@ -5,6 +5,7 @@
 #include "caffe/layers/base_conv_layer.hpp"
 #include "caffe/util/im2col.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -139,6 +140,10 @@ void BaseConvolutionLayer<Dtype>::LayerSetUp(const vector<Blob<Dtype>*>& bottom,
     weight_shape.push_back(kernel_shape_data[i]);
   }
   bias_term_ = this->layer_param_.convolution_param().bias_term();
+  fused_relu_ = this->layer_param_.convolution_param().fused_relu();
+  if (fused_relu_) {
+    CHECK_EQ(this->phase_, TEST) << "fused_relu is only supported for inference.";
+  }
   vector<int> bias_shape(bias_term_, num_output_);
   if (this->blobs_.size() > 0) {
     CHECK_EQ(1 + bias_term_, this->blobs_.size())
@@ -255,18 +260,37 @@ void BaseConvolutionLayer<Dtype>::Reshape(const vector<Blob<Dtype>*>& bottom,
 
 template <typename Dtype>
 void BaseConvolutionLayer<Dtype>::forward_cpu_gemm(const Dtype* input,
-    const Dtype* weights, Dtype* output, bool skip_im2col) {
-  const Dtype* col_buff = input;
+    const Dtype* weights, Dtype* output, bool skip_im2col, Dtype* col_buff) {
+  const Dtype* col_data = input;
   if (!is_1x1_) {
-    if (!skip_im2col) {
-      conv_im2col_cpu(input, col_buffer_.mutable_cpu_data());
+    if (!col_buff) {
+      col_buff = col_buffer_.mutable_cpu_data();
     }
-    col_buff = col_buffer_.cpu_data();
+    if (!skip_im2col && !force_nd_im2col_ && num_spatial_axes_ == 2) {
+      // im2col one range of input channels per thread
+      const int* input_shape = conv_input_shape_.cpu_data();
+      const int* kernel_shape = kernel_shape_.cpu_data();
+      const int* pad = pad_.cpu_data();
+      const int* stride = stride_.cpu_data();
+      const int* dilation = dilation_.cpu_data();
+      const int channel_size = input_shape[1] * input_shape[2];
+      const int col_channel_size =
+          kernel_shape[0] * kernel_shape[1] * conv_out_spatial_dim_;
+      parallel_for(conv_in_channels_, [&](int begin, int end) {
+        im2col_cpu(input + begin * channel_size, end - begin,
+            input_shape[1], input_shape[2], kernel_shape[0], kernel_shape[1],
+            pad[0], pad[1], stride[0], stride[1], dilation[0], dilation[1],
+            col_buff + begin * col_channel_size);
+      });
+    } else if (!skip_im2col) {
+      conv_im2col_cpu(input, col_buff);
+    }
+    col_data = col_buff;
   }
   for (int g = 0; g < group_; ++g) {
     caffe_cpu_gemm<Dtype>(CblasNoTrans, CblasNoTrans, conv_out_channels_ /
         group_, conv_out_spatial_dim_, kernel_dim_,
-        (Dtype)1., weights + weight_offset_ * g, col_buff + col_offset_ * g,
+        (Dtype)1., weights + weight_offset_ * g, col_data + col_offset_ * g,
         (Dtype)0., output + output_offset_ * g);
   }
 }
@@ -1,4 +1,9 @@
+#ifdef USE_OPENCV
+#include <opencv2/core/core.hpp>
+#endif  // USE_OPENCV
 #include <boost/thread.hpp>
+#include <algorithm>
+#include <string>
 #include <vector>
 
 #include "caffe/blob.hpp"
@@ -7,7 +12,9 @@
 #include "caffe/layer.hpp"
 #include "caffe/layers/base_data_layer.hpp"
 #include "caffe/proto/caffe.pb.h"
+#include "caffe/util/benchmark.hpp"
 #include "caffe/util/blocking_queue.hpp"
+#include "caffe/util/trace.hpp"
 
 namespace caffe {
 
@@ -37,11 +44,16 @@ BasePrefetchingDataLayer<Dtype>::BasePrefetchingDataLayer(
     const LayerParameter& param)
     : BaseDataLayer<Dtype>(param),
       prefetch_(param.data_param().prefetch()),
-      prefetch_free_(), prefetch_full_(), prefetch_current_() {
+      prefetch_free_(), prefetch_full_(), prefetch_current_(),
+      window_batches_(0), window_waits_(0) {
   for (int i = 0; i < prefetch_.size(); ++i) {
     prefetch_[i].reset(new Batch<Dtype>());
     prefetch_free_.push(prefetch_[i].get());
   }
+  if (param.data_param().sample_cache_bytes() > 0) {
+    sample_cache_.reset(new SampleCache(param.data_param().sample_cache_bytes(),
+        param.data_param().sample_cache_compress()));
+  }
 }
 
 template <typename Dtype>
@@ -87,13 +99,20 @@ void BasePrefetchingDataLayer<Dtype>::InternalThreadEntry() {
   try {
     while (!must_stop()) {
       Batch<Dtype>* batch = prefetch_free_.pop();
-      load_batch(batch);
+      {
+        TraceScope trace("data", this->layer_param_.name());
+        load_batch(batch);
+      }
 #ifndef CPU_ONLY
       if (Caffe::mode() == Caffe::GPU) {
+        TraceScope trace("memcpy", "prefetch_to_device");
         batch->data_.data().get()->async_gpu_push(stream);
         if (this->output_labels_) {
           batch->label_.data().get()->async_gpu_push(stream);
         }
+        if (batch->length_.count()) {
+          batch->length_.data().get()->async_gpu_push(stream);
+        }
         CUDA_CHECK(cudaStreamSynchronize(stream));
       }
 #endif
@@ -112,10 +131,7 @@ void BasePrefetchingDataLayer<Dtype>::InternalThreadEntry() {
 template <typename Dtype>
 void BasePrefetchingDataLayer<Dtype>::Forward_cpu(
     const vector<Blob<Dtype>*>& bottom, const vector<Blob<Dtype>*>& top) {
-  if (prefetch_current_) {
-    prefetch_free_.push(prefetch_current_);
-  }
-  prefetch_current_ = prefetch_full_.pop("Waiting for data");
+  prefetch_current_ = NextBatch();
   // Reshape to loaded data.
   top[0]->ReshapeLike(prefetch_current_->data_);
   top[0]->set_cpu_data(prefetch_current_->data_.mutable_cpu_data());
@@ -124,7 +140,113 @@ void BasePrefetchingDataLayer<Dtype>::Forward_cpu(
     top[1]->ReshapeLike(prefetch_current_->label_);
     top[1]->set_cpu_data(prefetch_current_->label_.mutable_cpu_data());
   }
+  if (top.size() > 2) {
+    top[2]->ReshapeLike(prefetch_current_->length_);
+    top[2]->set_cpu_data(prefetch_current_->length_.mutable_cpu_data());
+  }
+}
+
+template <typename Dtype>
+Batch<Dtype>* BasePrefetchingDataLayer<Dtype>::NextBatch() {
+  if (prefetch_current_) {
+    prefetch_free_.push(prefetch_current_);
+  }
+  const size_t queued = prefetch_full_.size();
+  CPUTimer timer;
+  timer.Start();
+  Batch<Dtype>* batch = prefetch_full_.pop("Waiting for data");
+  ++timings_.batches;
+  timings_.read_us += batch->read_us_;
+  timings_.transform_us += batch->transform_us_;
+  timings_.load_us += batch->load_us_;
+  timings_.wait_us += timer.MicroSeconds();
+  timings_.queued += queued;
+  if (queued == 0) {
+    ++timings_.waits;
+    ++window_waits_;
+  }
+  if (this->layer_param_.data_param().adaptive_prefetch() &&
+      ++window_batches_ == 20) {
+    if (2 * window_waits_ >= window_batches_) {
+      GrowPrefetch(*batch);
+    }
+    window_batches_ = 0;
+    window_waits_ = 0;
+  }
+  return batch;
+}
+
+template <typename Dtype>
+void BasePrefetchingDataLayer<Dtype>::GrowPrefetch(
+    const Batch<Dtype>& current) {
+  const uint64_t batch_bytes = sizeof(Dtype) * (current.data_.count() +
+      current.label_.count() + current.length_.count());
+  if ((prefetch_.size() + 1) * batch_bytes >
+      this->layer_param_.data_param().prefetch_max_bytes()) {
+    return;
+  }
+  shared_ptr<Batch<Dtype> > batch(new Batch<Dtype>());
+  // Allocate on this thread rather than the prefetch thread, as in
+  // LayerSetUp.
+  batch->data_.ReshapeLike(current.data_);
+  batch->data_.mutable_cpu_data();
+  if (this->output_labels_) {
+    batch->label_.ReshapeLike(current.label_);
+    batch->label_.mutable_cpu_data();
+  }
+  // The valid lengths of a third top, which load_batch only fills in a
+  // batch that already has them.
+  if (current.length_.count() > 0) {
+    batch->length_.ReshapeLike(current.length_);
+    batch->length_.mutable_cpu_data();
+  }
+#ifndef CPU_ONLY
+  if (Caffe::mode() == Caffe::GPU) {
+    batch->data_.mutable_gpu_data();
+    if (this->output_labels_) {
+      batch->label_.mutable_gpu_data();
+    }
+    if (current.length_.count() > 0) {
+      batch->length_.mutable_gpu_data();
+    }
+  }
+#endif
+  prefetch_.push_back(batch);
+  prefetch_free_.push(batch.get());
+  LOG_IF(INFO, Caffe::root_solver()) << this->layer_param_.name()
+      << " waited for data, prefetching " << prefetch_.size() << " batches";
+}
+
+#ifdef USE_OPENCV
+template <typename Dtype>
+bool BasePrefetchingDataLayer<Dtype>::CachedSample(const string& key,
+    cv::Mat* cv_img) {
+  if (!sample_cache_) {
+    return false;
+  }
+  SampleShape shape;
+  vector<uint8_t> pixels;
+  if (!sample_cache_->Get(key, &shape, &pixels)) {
+    return false;
+  }
+  cv::Mat(shape.rows, shape.cols, CV_8UC(shape.channels),
+      pixels.data()).copyTo(*cv_img);
+  return true;
+}
+
+template <typename Dtype>
+void BasePrefetchingDataLayer<Dtype>::CacheSample(const string& key,
+    const cv::Mat& cv_img) {
+  if (!sample_cache_ || !cv_img.data) {
+    return;
+  }
+  CHECK(cv_img.depth() == CV_8U) << "Image data type must be unsigned byte";
+  const cv::Mat continuous = cv_img.isContinuous() ? cv_img : cv_img.clone();
+  const SampleShape shape = { continuous.rows, continuous.cols,
+      continuous.channels() };
+  sample_cache_->Put(key, shape, continuous.data);
 }
+#endif  // USE_OPENCV
 
 #ifdef CPU_ONLY
 STUB_GPU_FORWARD(BasePrefetchingDataLayer, Forward);
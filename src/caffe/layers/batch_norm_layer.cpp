@@ -3,6 +3,7 @@
 
 #include "caffe/layers/batch_norm_layer.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -91,17 +92,38 @@ void BatchNormLayer<Dtype>::Forward_cpu(const vector<Blob<Dtype>*>& bottom,
         this->blobs_[0]->cpu_data(), mean_.mutable_cpu_data());
     caffe_cpu_scale(variance_.count(), scale_factor,
         this->blobs_[1]->cpu_data(), variance_.mutable_cpu_data());
-  } else {
-    // compute mean
-    caffe_cpu_gemv<Dtype>(CblasNoTrans, channels_ * num, spatial_dim,
-        1. / (num * spatial_dim), bottom_data,
-        spatial_sum_multiplier_.cpu_data(), 0.,
-        num_by_chans_.mutable_cpu_data());
-    caffe_cpu_gemv<Dtype>(CblasTrans, num, channels_, 1.,
-        num_by_chans_.cpu_data(), batch_sum_multiplier_.cpu_data(), 0.,
-        mean_.mutable_cpu_data());
+    caffe_add_scalar(variance_.count(), eps_, variance_.mutable_cpu_data());
+    caffe_powx(variance_.count(), variance_.cpu_data(), Dtype(0.5),
+               variance_.mutable_cpu_data());
+    // normalize one (n, c) plane at a time, keeping temp_ and x_norm_ for
+    // Backward
+    const Dtype* mean = mean_.cpu_data();
+    const Dtype* stdev = variance_.cpu_data();
+    Dtype* temp = temp_.mutable_cpu_data();
+    Dtype* x_norm = x_norm_.mutable_cpu_data();
+    parallel_for(num * channels_, [&](int begin, int end) {
+      for (int i = begin; i < end; ++i) {
+        const int c = i % channels_;
+        const int offset = i * spatial_dim;
+        for (int j = offset; j < offset + spatial_dim; ++j) {
+          top_data[j] = (top_data[j] - mean[c]) / stdev[c];
+          temp[j] = stdev[c];
+          x_norm[j] = top_data[j];
+        }
+      }
+    });
+    return;
   }
 
+  // compute mean
+  caffe_cpu_gemv<Dtype>(CblasNoTrans, channels_ * num, spatial_dim,
+      1. / (num * spatial_dim), bottom_data,
+      spatial_sum_multiplier_.cpu_data(), 0.,
+      num_by_chans_.mutable_cpu_data());
+  caffe_cpu_gemv<Dtype>(CblasTrans, num, channels_, 1.,
+      num_by_chans_.cpu_data(), batch_sum_multiplier_.cpu_data(), 0.,
+      mean_.mutable_cpu_data());
+
   // subtract mean
   caffe_cpu_gemm<Dtype>(CblasNoTrans, CblasNoTrans, num, channels_, 1, 1,
       batch_sum_multiplier_.cpu_data(), mean_.cpu_data(), 0.,
@@ -110,29 +132,27 @@ void BatchNormLayer<Dtype>::Forward_cpu(const vector<Blob<Dtype>*>& bottom,
       spatial_dim, 1, -1, num_by_chans_.cpu_data(),
       spatial_sum_multiplier_.cpu_data(), 1., top_data);
 
-  if (!use_global_stats_) {
-    // compute variance using var(X) = E((X-EX)^2)
-    caffe_powx(top[0]->count(), top_data, Dtype(2),
-        temp_.mutable_cpu_data());  // (X-EX)^2
-    caffe_cpu_gemv<Dtype>(CblasNoTrans, channels_ * num, spatial_dim,
-        1. / (num * spatial_dim), temp_.cpu_data(),
-        spatial_sum_multiplier_.cpu_data(), 0.,
-        num_by_chans_.mutable_cpu_data());
-    caffe_cpu_gemv<Dtype>(CblasTrans, num, channels_, 1.,
-        num_by_chans_.cpu_data(), batch_sum_multiplier_.cpu_data(), 0.,
-        variance_.mutable_cpu_data());  // E((X_EX)^2)
-
-    // compute and save moving average
-    this->blobs_[2]->mutable_cpu_data()[0] *= moving_average_fraction_;
-    this->blobs_[2]->mutable_cpu_data()[0] += 1;
-    caffe_cpu_axpby(mean_.count(), Dtype(1), mean_.cpu_data(),
-        moving_average_fraction_, this->blobs_[0]->mutable_cpu_data());
-    int m = bottom[0]->count()/channels_;
-    Dtype bias_correction_factor = m > 1 ? Dtype(m)/(m-1) : 1;
-    caffe_cpu_axpby(variance_.count(), bias_correction_factor,
-        variance_.cpu_data(), moving_average_fraction_,
-        this->blobs_[1]->mutable_cpu_data());
-  }
+  // compute variance using var(X) = E((X-EX)^2)
+  caffe_powx(top[0]->count(), top_data, Dtype(2),
+      temp_.mutable_cpu_data());  // (X-EX)^2
+  caffe_cpu_gemv<Dtype>(CblasNoTrans, channels_ * num, spatial_dim,
+      1. / (num * spatial_dim), temp_.cpu_data(),
+      spatial_sum_multiplier_.cpu_data(), 0.,
+      num_by_chans_.mutable_cpu_data());
+  caffe_cpu_gemv<Dtype>(CblasTrans, num, channels_, 1.,
+      num_by_chans_.cpu_data(), batch_sum_multiplier_.cpu_data(), 0.,
+      variance_.mutable_cpu_data());  // E((X_EX)^2)
+
+  // compute and save moving average
+  this->blobs_[2]->mutable_cpu_data()[0] *= moving_average_fraction_;
+  this->blobs_[2]->mutable_cpu_data()[0] += 1;
+  caffe_cpu_axpby(mean_.count(), Dtype(1), mean_.cpu_data(),
+      moving_average_fraction_, this->blobs_[0]->mutable_cpu_data());
+  int m = bottom[0]->count()/channels_;
+  Dtype bias_correction_factor = m > 1 ? Dtype(m)/(m-1) : 1;
+  caffe_cpu_axpby(variance_.count(), bias_correction_factor,
+      variance_.cpu_data(), moving_average_fraction_,
+      this->blobs_[1]->mutable_cpu_data());
 
   // normalize variance
   caffe_add_scalar(variance_.count(), eps_, variance_.mutable_cpu_data());
@@ -2,6 +2,7 @@
 
 #include "caffe/layers/concat_layer.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -58,19 +59,27 @@ void ConcatLayer<Dtype>::Forward_cpu(const vector<Blob<Dtype>*>& bottom,
       const vector<Blob<Dtype>*>& top) {
   if (bottom.size() == 1) { return; }
   Dtype* top_data = top[0]->mutable_cpu_data();
-  int offset_concat_axis = 0;
   const int top_concat_axis = top[0]->shape(concat_axis_);
+  // one copy per (bottom, n) pair
+  vector<const Dtype*> bottom_data(bottom.size());
+  vector<int> offset_concat_axis(bottom.size() + 1, 0);
   for (int i = 0; i < bottom.size(); ++i) {
-    const Dtype* bottom_data = bottom[i]->cpu_data();
-    const int bottom_concat_axis = bottom[i]->shape(concat_axis_);
-    for (int n = 0; n < num_concats_; ++n) {
+    bottom_data[i] = bottom[i]->cpu_data();
+    offset_concat_axis[i + 1] =
+        offset_concat_axis[i] + bottom[i]->shape(concat_axis_);
+  }
+  parallel_for(bottom.size() * num_concats_, [&](int begin, int end) {
+    for (int k = begin; k < end; ++k) {
+      const int i = k / num_concats_;
+      const int n = k % num_concats_;
+      const int bottom_concat_axis =
+          offset_concat_axis[i + 1] - offset_concat_axis[i];
       caffe_copy(bottom_concat_axis * concat_input_size_,
-          bottom_data + n * bottom_concat_axis * concat_input_size_,
-          top_data + (n * top_concat_axis + offset_concat_axis)
+          bottom_data[i] + n * bottom_concat_axis * concat_input_size_,
+          top_data + (n * top_concat_axis + offset_concat_axis[i])
               * concat_input_size_);
     }
-    offset_concat_axis += bottom_concat_axis;
-  }
+  });
 }
 
 template <typename Dtype>
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <vector>
 
 #include "caffe/layers/conv_layer.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -25,17 +27,43 @@ template <typename Dtype>
 void ConvolutionLayer<Dtype>::Forward_cpu(const vector<Blob<Dtype>*>& bottom,
       const vector<Blob<Dtype>*>& top) {
   const Dtype* weight = this->blobs_[0]->cpu_data();
+  const Dtype* bias = this->bias_term_ ? this->blobs_[1]->cpu_data() : NULL;
+  // Images run concurrently when the thread budget allows; every range of
+  // images then needs its own column buffer.
+  const bool concurrent = this->num_ > 1 && Caffe::cpu_threads() > 1 &&
+      !this->is_1x1_;
+  const int num_chunks = concurrent ?
+      std::min(Caffe::cpu_threads(), this->num_) : 1;
+  Dtype* col_buffers = NULL;
+  if (concurrent) {
+    thread_col_buffers_.Reshape(
+        vector<int>(1, num_chunks * this->col_buffer_count()));
+    col_buffers = thread_col_buffers_.mutable_cpu_data();
+  }
   for (int i = 0; i < bottom.size(); ++i) {
     const Dtype* bottom_data = bottom[i]->cpu_data();
     Dtype* top_data = top[i]->mutable_cpu_data();
-    for (int n = 0; n < this->num_; ++n) {
-      this->forward_cpu_gemm(bottom_data + n * this->bottom_dim_, weight,
-          top_data + n * this->top_dim_);
-      if (this->bias_term_) {
-        const Dtype* bias = this->blobs_[1]->cpu_data();
-        this->forward_cpu_bias(top_data + n * this->top_dim_, bias);
+    parallel_for(num_chunks, [&](int chunk_begin, int chunk_end) {
+      for (int chunk = chunk_begin; chunk < chunk_end; ++chunk) {
+        Dtype* col_buff = concurrent ?
+            col_buffers + chunk * this->col_buffer_count() : NULL;
+        const int begin = this->num_ * chunk / num_chunks;
+        const int end = this->num_ * (chunk + 1) / num_chunks;
+        for (int n = begin; n < end; ++n) {
+          this->forward_cpu_gemm(bottom_data + n * this->bottom_dim_, weight,
+              top_data + n * this->top_dim_, false, col_buff);
+          if (this->bias_term_) {
+            this->forward_cpu_bias(top_data + n * this->top_dim_, bias);
+          }
+          if (this->fused_relu_) {
+            Dtype* out = top_data + n * this->top_dim_;
+            for (int j = 0; j < this->top_dim_; ++j) {
+              out[j] = std::max(out[j], Dtype(0));
+            }
+          }
+        }
       }
-    }
+    });
   }
 }
 
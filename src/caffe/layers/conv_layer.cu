@@ -4,6 +4,13 @@
 
 namespace caffe {
 
+template <typename Dtype>
+__global__ void FusedReLUForward(const int n, Dtype* out) {
+  CUDA_KERNEL_LOOP(index, n) {
+    out[index] = out[index] > 0 ? out[index] : 0;
+  }
+}
+
 template <typename Dtype>
 void ConvolutionLayer<Dtype>::Forward_gpu(const vector<Blob<Dtype>*>& bottom,
       const vector<Blob<Dtype>*>& top) {
@@ -19,6 +26,13 @@ void ConvolutionLayer<Dtype>::Forward_gpu(const vector<Blob<Dtype>*>& bottom,
         this->forward_gpu_bias(top_data + n * this->top_dim_, bias);
       }
     }
+    if (this->fused_relu_) {
+      const int count = top[i]->count();
+      // NOLINT_NEXT_LINE(whitespace/operators)
+      FusedReLUForward<Dtype><<<CAFFE_GET_BLOCKS(count),
+          CAFFE_CUDA_NUM_THREADS>>>(count, top_data);
+      CUDA_POST_KERNEL_CHECK;
+    }
   }
 }
 
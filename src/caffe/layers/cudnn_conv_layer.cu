@@ -7,6 +7,13 @@ namespace caffe {
 
 __global__ void sync_conv_groups() { }
 
+template <typename Dtype>
+__global__ void FusedReLUForward(const int n, Dtype* out) {
+  CUDA_KERNEL_LOOP(index, n) {
+    out[index] = out[index] > 0 ? out[index] : 0;
+  }
+}
+
 template <typename Dtype>
 void CuDNNConvolutionLayer<Dtype>::Forward_gpu(
     const vector<Blob<Dtype>*>& bottom, const vector<Blob<Dtype>*>& top) {
@@ -42,6 +49,14 @@ void CuDNNConvolutionLayer<Dtype>::Forward_gpu(
     // stream, by launching an empty kernel into the default (null) stream.
     // NOLINT_NEXT_LINE(whitespace/operators)
     sync_conv_groups<<<1, 1>>>();
+
+    if (this->fused_relu_) {
+      const int count = top[i]->count();
+      // NOLINT_NEXT_LINE(whitespace/operators)
+      FusedReLUForward<Dtype><<<CAFFE_GET_BLOCKS(count),
+          CAFFE_CUDA_NUM_THREADS>>>(count, top_data);
+      CUDA_POST_KERNEL_CHECK;
+    }
   }
 }
 
@@ -3,22 +3,46 @@
 #endif  // USE_OPENCV
 #include <stdint.h>
 
+#include <algorithm>
+#include <fstream>  // NOLINT(readability/streams)
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "caffe/data_transformer.hpp"
 #include "caffe/layers/data_layer.hpp"
 #include "caffe/util/benchmark.hpp"
+#include "caffe/util/io.hpp"
+#include "caffe/util/math_functions.hpp"
+#include "caffe/util/rng.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
+namespace {
+
+// Parses a DB value in place when it can; datum holds the records that
+// cannot be viewed, such as float data.
+void ParseValue(const char* value, size_t size, Datum* datum,
+    DatumView* view) {
+  if (!ParseDatumView(value, size, view)) {
+    datum->ParseFromArray(value, size);
+    *view = DatumView(*datum);
+  }
+}
+
+}  // namespace
+
 template <typename Dtype>
 DataLayer<Dtype>::DataLayer(const LayerParameter& param)
   : BasePrefetchingDataLayer<Dtype>(param),
-    offset_() {
+    offset_(), key_id_(0), buffer_slot_(0), window_size_(0), valid_pixels_(0),
+    padded_pixels_(0) {
   db_.reset(db::GetDB(param.data_param().backend()));
   db_->Open(param.data_param().source(), db::READ);
   cursor_.reset(db_->NewCursor());
-  rand_skip_num_ = param.data_param().rand_skip();
+  rand_skip_num_ = param.data_param().shuffle() ? 0 :
+      param.data_param().rand_skip();
 }
 
 template <typename Dtype>
@@ -30,15 +54,49 @@ template <typename Dtype>
 void DataLayer<Dtype>::DataLayerSetUp(const vector<Blob<Dtype>*>& bottom,
       const vector<Blob<Dtype>*>& top) {
   const int batch_size = this->layer_param_.data_param().batch_size();
+  if (this->layer_param_.data_param().shuffle()) {
+    shuffle_rng_.reset(new Caffe::RNG(caffe_rng_rand()));
+    if (this->layer_param_.data_param().shuffle_buffer() > 0) {
+      FillShuffleBuffer();
+    } else {
+      BuildKeyIndex();
+    }
+  }
   // Read a data point, and use it to initialize the top blob.
   Datum datum;
-  datum.ParseFromString(cursor_->value());
+  size_t size;
+  const char* value = Value(&size);
+  datum.ParseFromArray(value, size);
 
   // Use data_transformer to infer the expected blob shape from datum.
   vector<int> top_shape = this->data_transformer_->InferBlobShape(datum);
   this->transformed_data_.Reshape(top_shape);
   // Reshape top[0] and prefetch_data according to the batch_size.
   top_shape[0] = batch_size;
+  const DataParameter& data_param = this->layer_param_.data_param();
+  const int num_buckets = data_param.bucket_width_size();
+  if (num_buckets > 0) {
+    CHECK_EQ(this->transform_param_.crop_size(), 0)
+        << "Width buckets do not support crop_size";
+    CHECK(!this->transform_param_.has_mean_file())
+        << "Width buckets need mean_value instead of mean_file";
+    for (int i = 1; i < num_buckets; ++i) {
+      CHECK_LT(data_param.bucket_width(i - 1), data_param.bucket_width(i))
+          << "bucket_width must be ascending";
+    }
+    CHECK_GE(data_param.bucket_window(), batch_size);
+    buckets_.resize(num_buckets + 1);
+    bucket_batches_.resize(num_buckets + 1);
+    // Samples are decoded when they enter the window, so force_color and
+    // force_gray are already applied when they are transformed.
+    TransformationParameter bucket_param = this->transform_param_;
+    bucket_param.clear_force_color();
+    bucket_param.clear_force_gray();
+    bucket_transformer_.reset(
+        new DataTransformer<Dtype>(bucket_param, this->phase_));
+    bucket_transformer_->InitRand();
+    top_shape[3] = data_param.bucket_width(num_buckets - 1);
+  }
   top[0]->Reshape(top_shape);
   for (int i = 0; i < this->prefetch_.size(); ++i) {
     this->prefetch_[i]->data_.Reshape(top_shape);
@@ -59,10 +117,184 @@ void DataLayer<Dtype>::DataLayerSetUp(const vector<Blob<Dtype>*>& bottom,
       this->prefetch_[i]->label_.Reshape(label_shape);
     }
   }
+  if (top.size() > 2) {
+    CHECK_GT(num_buckets, 0)
+        << "The valid width top needs data_param.bucket_width";
+    const vector<int> length_shape(1, batch_size);
+    top[2]->Reshape(length_shape);
+    for (int i = 0; i < this->prefetch_.size(); ++i) {
+      this->prefetch_[i]->length_.Reshape(length_shape);
+    }
+  }
+  const int num_workers = data_param.num_workers();
+  if (num_workers > 1 && num_buckets == 0) {
+    for (int i = 0; i < num_workers; ++i) {
+      worker_transformers_.push_back(shared_ptr<DataTransformer<Dtype> >(
+          new DataTransformer<Dtype>(this->transform_param_, this->phase_)));
+      worker_data_.push_back(shared_ptr<Blob<Dtype> >(new Blob<Dtype>()));
+    }
+    values_.resize(batch_size);
+    cache_keys_.resize(batch_size);
+    datums_.resize(batch_size);
+    views_.resize(batch_size);
+    seeds_.resize(batch_size);
+    if (!key_order_.empty()) {
+      for (int i = 0; i < num_workers; ++i) {
+        worker_cursors_.push_back(shared_ptr<db::Cursor>(db_->NewCursor()));
+      }
+      item_keys_.resize(batch_size);
+    }
+    LOG_IF(INFO, Caffe::root_solver())
+        << "Decoding batches on " << num_workers << " threads";
+  }
+}
+
+template <typename Dtype>
+void DataLayer<Dtype>::BuildKeyIndex() {
+  const DataParameter& data_param = this->layer_param_.data_param();
+  CPUTimer timer;
+  timer.Start();
+  if (!LoadKeyIndex(data_param.key_index())) {
+    key_pool_.clear();
+    key_offsets_.assign(1, 0);
+    for (cursor_->SeekToFirst(); cursor_->valid(); cursor_->Next()) {
+      key_pool_ += cursor_->key();
+      key_offsets_.push_back(key_pool_.size());
+    }
+    if (data_param.has_key_index()) {
+      SaveKeyIndex(data_param.key_index());
+    }
+  }
+  const int num_keys = key_offsets_.size() - 1;
+  CHECK_GT(num_keys, 0) << "No records in " << data_param.source();
+  // Each solver visits its own share of the records; in test mode only
+  // rank 0 runs.
+  const int size = Caffe::solver_count();
+  const int rank = Caffe::solver_rank();
+  const bool all = this->layer_param_.phase() == TEST;
+  key_order_.clear();
+  for (int i = 0; i < num_keys; ++i) {
+    if (all || i % size == rank) {
+      key_order_.push_back(i);
+    }
+  }
+  LOG_IF(INFO, Caffe::root_solver()) << "Indexed " << num_keys
+      << " keys in " << timer.MilliSeconds() << " ms";
+  caffe::rng_t* rng = static_cast<caffe::rng_t*>(shuffle_rng_->generator());
+  shuffle(key_order_.begin(), key_order_.end(), rng);
+  key_id_ = 0;
+  SeekKey();
+}
+
+// The index file holds the number of keys as uint64, then every key as a
+// uint32 size followed by its bytes.
+template <typename Dtype>
+bool DataLayer<Dtype>::LoadKeyIndex(const string& filename) {
+  if (filename.empty()) {
+    return false;
+  }
+  std::ifstream file(filename.c_str(), ios::in | ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+  uint64_t num_keys = 0;
+  file.read(reinterpret_cast<char*>(&num_keys), sizeof(num_keys));
+  key_pool_.clear();
+  key_offsets_.assign(1, 0);
+  for (uint64_t i = 0; i < num_keys && file.good(); ++i) {
+    uint32_t key_size = 0;
+    file.read(reinterpret_cast<char*>(&key_size), sizeof(key_size));
+    key_pool_.resize(key_pool_.size() + key_size);
+    file.read(&key_pool_[key_offsets_.back()], key_size);
+    key_offsets_.push_back(key_pool_.size());
+  }
+  CHECK(file.good()) << "Truncated key index " << filename;
+  LOG_IF(INFO, Caffe::root_solver()) << "Loaded key index " << filename;
+  return true;
+}
+
+template <typename Dtype>
+void DataLayer<Dtype>::SaveKeyIndex(const string& filename) const {
+  std::ofstream file(filename.c_str(), ios::out | ios::binary);
+  const uint64_t num_keys = key_offsets_.size() - 1;
+  file.write(reinterpret_cast<const char*>(&num_keys), sizeof(num_keys));
+  for (uint64_t i = 0; i < num_keys; ++i) {
+    const uint32_t key_size = key_offsets_[i + 1] - key_offsets_[i];
+    file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    file.write(key_pool_.data() + key_offsets_[i], key_size);
+  }
+  if (!file.good()) {
+    LOG(WARNING) << "Failed to write key index " << filename;
+  }
+}
+
+template <typename Dtype>
+string DataLayer<Dtype>::Key(uint32_t index) const {
+  return key_pool_.substr(key_offsets_[index],
+      key_offsets_[index + 1] - key_offsets_[index]);
+}
+
+template <typename Dtype>
+void DataLayer<Dtype>::NextKey() {
+  if (++key_id_ == static_cast<int>(key_order_.size())) {
+    LOG_IF(INFO, Caffe::root_solver())
+        << "Restarting data prefetching from start.";
+    key_id_ = 0;
+    caffe::rng_t* rng = static_cast<caffe::rng_t*>(shuffle_rng_->generator());
+    shuffle(key_order_.begin(), key_order_.end(), rng);
+  }
+}
+
+template <typename Dtype>
+void DataLayer<Dtype>::SeekKey() {
+  CHECK(cursor_->Seek(Key(key_order_[key_id_])))
+      << "Key index does not match "
+      << this->layer_param_.data_param().source();
+}
+
+template <typename Dtype>
+void DataLayer<Dtype>::FillShuffleBuffer() {
+  const int buffer_size = this->layer_param_.data_param().shuffle_buffer();
+  shuffle_buffer_.resize(buffer_size);
+  for (int i = 0; i < buffer_size; ++i) {
+    while (SkipRecord()) {
+      NextRecord();
+    }
+    size_t size;
+    const char* value = cursor_->value_data(&size);
+    shuffle_buffer_[i].assign(value, size);
+    NextRecord();
+  }
+  buffer_slot_ = ShuffleRand(buffer_size);
+}
+
+template <typename Dtype>
+int DataLayer<Dtype>::ShuffleRand(int n) {
+  caffe::rng_t* rng = static_cast<caffe::rng_t*>(shuffle_rng_->generator());
+  return ((*rng)() % n);
+}
+
+template <typename Dtype>
+const char* DataLayer<Dtype>::Value(size_t* size) {
+  if (!shuffle_buffer_.empty()) {
+    const string& value = shuffle_buffer_[buffer_slot_];
+    *size = value.size();
+    return value.data();
+  }
+  return cursor_->value_data(size);
 }
 
 template <typename Dtype>
 bool DataLayer<Dtype>::Skip() {
+  // Shuffled reads only hand out records of this solver.
+  if (this->layer_param_.data_param().shuffle()) {
+    return false;
+  }
+  return SkipRecord();
+}
+
+template <typename Dtype>
+bool DataLayer<Dtype>::SkipRecord() {
   int size = Caffe::solver_count();
   int rank = Caffe::solver_rank();
   bool keep = (offset_ % size) == rank ||
@@ -73,6 +305,26 @@ bool DataLayer<Dtype>::Skip() {
 
 template<typename Dtype>
 void DataLayer<Dtype>::Next() {
+  if (!key_order_.empty()) {
+    NextKey();
+    SeekKey();
+  } else if (!shuffle_buffer_.empty()) {
+    // Replace the record just handed out by the next one of the DB.
+    while (SkipRecord()) {
+      NextRecord();
+    }
+    size_t size;
+    const char* value = cursor_->value_data(&size);
+    shuffle_buffer_[buffer_slot_].assign(value, size);
+    NextRecord();
+    buffer_slot_ = ShuffleRand(shuffle_buffer_.size());
+  } else {
+    NextRecord();
+  }
+}
+
+template<typename Dtype>
+void DataLayer<Dtype>::NextRecord() {
   cursor_->Next();
   if (!cursor_->valid()) {
     LOG_IF(INFO, Caffe::root_solver())
@@ -108,47 +360,349 @@ void DataLayer<Dtype>::load_batch(Batch<Dtype>* batch) {
 	  rand_skip_num_ = 0;//skip once
   }
 
-  Datum datum;
-  for (int item_id = 0; item_id < batch_size; ++item_id) {
+  if (!buckets_.empty()) {
+    LoadBucketedBatch(batch);
+    return;
+  }
+  if (!worker_transformers_.empty()) {
+    // Only the reading is serial; items are decoded by TransformItems.
     timer.Start();
-    while (Skip()) {
+    for (int item_id = 0; item_id < batch_size; ++item_id) {
+      if (!worker_cursors_.empty()) {
+        // The workers look the items up themselves.
+        item_keys_[item_id] = key_order_[key_id_];
+        if (this->sample_cache_) {
+          cache_keys_[item_id] = Key(item_keys_[item_id]);
+        }
+        NextKey();
+        continue;
+      }
+      while (Skip()) {
+        Next();
+      }
+      size_t size;
+      const char* value = Value(&size);
+      values_[item_id].assign(value, size);
+      cache_keys_[item_id] = CacheKey();
       Next();
     }
-    datum.ParseFromString(cursor_->value());
+    if (!worker_cursors_.empty()) {
+      // The first item shapes the batch.
+      CHECK(worker_cursors_[0]->Seek(Key(item_keys_[0])));
+      size_t size;
+      const char* value = worker_cursors_[0]->value_data(&size);
+      values_[0].assign(value, size);
+    }
+    ParseValue(values_[0].data(), values_[0].size(), &datums_[0], &views_[0]);
     read_time += timer.MicroSeconds();
+    // Reshape according to the first datum of each batch.
+    vector<int> top_shape = InferItemShape(cache_keys_[0], views_[0],
+        this->data_transformer_.get());
+    this->transformed_data_.Reshape(top_shape);
+    top_shape[0] = batch_size;
+    batch->data_.Reshape(top_shape);
+    timer.Start();
+    TransformItems(batch);
+    trans_time += timer.MicroSeconds();
+  } else {
+    Datum datum;
+    DatumView view;
+    for (int item_id = 0; item_id < batch_size; ++item_id) {
+      timer.Start();
+      while (Skip()) {
+        Next();
+      }
+      // The view points into the DB until the cursor moves on.
+      size_t size;
+      const char* value = Value(&size);
+      ParseValue(value, size, &datum, &view);
+      const string key = CacheKey();
+      read_time += timer.MicroSeconds();
 
-    if (item_id == 0) {
-      // Reshape according to the first datum of each batch
-      // on single input batches allows for inputs of varying dimension.
-      // Use data_transformer to infer the expected blob shape from datum.
-      vector<int> top_shape = this->data_transformer_->InferBlobShape(datum);
-      this->transformed_data_.Reshape(top_shape);
-      // Reshape batch according to the batch_size.
-      top_shape[0] = batch_size;
-      batch->data_.Reshape(top_shape);
-    }
+      if (item_id == 0) {
+        // Reshape according to the first datum of each batch
+        // on single input batches allows for inputs of varying dimension.
+        // Use data_transformer to infer the expected blob shape from datum.
+        vector<int> top_shape = InferItemShape(key, view,
+            this->data_transformer_.get());
+        this->transformed_data_.Reshape(top_shape);
+        // Reshape batch according to the batch_size.
+        top_shape[0] = batch_size;
+        batch->data_.Reshape(top_shape);
+      }
 
-    // Apply data transformations (mirror, scale, crop...)
-    timer.Start();
-    int offset = batch->data_.offset(item_id);
-    Dtype* top_data = batch->data_.mutable_cpu_data();
-    this->transformed_data_.set_cpu_data(top_data + offset);
-    this->data_transformer_->Transform(datum, &(this->transformed_data_));
-    // Copy label.
-    if (this->output_labels_) {
-      Dtype* top_label = batch->label_.mutable_cpu_data();
-      //top_label[item_id] = datum.label();
-		for (size_t i = 0; i < datum.label_size(); i++)
-			top_label[item_id*datum.label_size() + i] = datum.label(i);
+      // Apply data transformations (mirror, scale, crop...)
+      timer.Start();
+      int offset = batch->data_.offset(item_id);
+      Dtype* top_data = batch->data_.mutable_cpu_data();
+      this->transformed_data_.set_cpu_data(top_data + offset);
+      TransformItem(key, view, this->data_transformer_.get(),
+          &(this->transformed_data_));
+      // Copy label.
+      if (this->output_labels_) {
+        Dtype* top_label = batch->label_.mutable_cpu_data();
+        //top_label[item_id] = datum.label();
+		for (size_t i = 0; i < view.labels.size(); i++)
+			top_label[item_id*view.labels.size() + i] = view.labels[i];
+      }
+      trans_time += timer.MicroSeconds();
+      Next();
     }
-    trans_time += timer.MicroSeconds();
-    Next();
   }
   timer.Stop();
   batch_timer.Stop();
-  //DLOG(INFO) << "Prefetch batch: " << batch_timer.MilliSeconds() << " ms.";
-  //DLOG(INFO) << "     Read time: " << read_time / 1000 << " ms.";
-  //DLOG(INFO) << "Transform time: " << trans_time / 1000 << " ms.";
+  batch->read_us_ = read_time;
+  batch->transform_us_ = trans_time;
+  batch->load_us_ = batch_timer.MicroSeconds();
+}
+
+template<typename Dtype>
+void DataLayer<Dtype>::TransformItems(Batch<Dtype>* batch) {
+  const int batch_size = this->layer_param_.data_param().batch_size();
+  const int num_workers = worker_transformers_.size();
+  // Seeds are drawn in item order, so an item is transformed the same way
+  // whichever worker picks it up.
+  for (int item_id = 0; item_id < batch_size; ++item_id) {
+    seeds_[item_id] = caffe_rng_rand();
+  }
+  for (int i = 0; i < num_workers; ++i) {
+    worker_data_[i]->ReshapeLike(this->transformed_data_);
+  }
+  // The budget is per thread; this one is the prefetch thread.
+  if (Caffe::cpu_threads() != num_workers) {
+    Caffe::set_cpu_threads(num_workers);
+  }
+  Dtype* top_data = batch->data_.mutable_cpu_data();
+  Dtype* top_label = this->output_labels_ ?
+      batch->label_.mutable_cpu_data() : NULL;
+  parallel_for(num_workers, [&](int begin, int end) {
+    for (int w = begin; w < end; ++w) {
+      for (int item_id = w; item_id < batch_size; item_id += num_workers) {
+        DatumView& datum = views_[item_id];
+        if (item_id > 0 && !worker_cursors_.empty()) {
+          // The view stays valid until this worker moves its cursor.
+          db::Cursor* cursor = worker_cursors_[w].get();
+          CHECK(cursor->Seek(Key(item_keys_[item_id])));
+          size_t size;
+          const char* value = cursor->value_data(&size);
+          ParseValue(value, size, &datums_[item_id], &datum);
+        } else if (item_id > 0) {
+          ParseValue(values_[item_id].data(), values_[item_id].size(),
+              &datums_[item_id], &datum);
+        }
+        worker_data_[w]->set_cpu_data(top_data + batch->data_.offset(item_id));
+        worker_transformers_[w]->InitRand(seeds_[item_id]);
+        TransformItem(cache_keys_[item_id], datum,
+            worker_transformers_[w].get(), worker_data_[w].get());
+        if (top_label) {
+          const int label_size = datum.labels.size();
+          for (int i = 0; i < label_size; ++i) {
+            top_label[item_id * label_size + i] = datum.labels[i];
+          }
+        }
+      }
+    }
+  });
+}
+
+template<typename Dtype>
+string DataLayer<Dtype>::CacheKey() {
+  if (!this->sample_cache_ || !shuffle_buffer_.empty()) {
+    return string();
+  }
+  return cursor_->key();
+}
+
+template<typename Dtype>
+vector<int> DataLayer<Dtype>::InferItemShape(const string& key,
+    const DatumView& datum, DataTransformer<Dtype>* transformer) {
+#ifdef USE_OPENCV
+  if (datum.encoded && !key.empty()) {
+    return transformer->InferBlobShape(DecodeCached(key, datum, transformer));
+  }
+#endif  // USE_OPENCV
+  return transformer->InferBlobShape(datum);
+}
+
+template<typename Dtype>
+void DataLayer<Dtype>::TransformItem(const string& key,
+    const DatumView& datum, DataTransformer<Dtype>* transformer,
+    Blob<Dtype>* blob) {
+#ifdef USE_OPENCV
+  if (datum.encoded && !key.empty()) {
+    // Only the random part of the transformation is redone on a hit.
+    transformer->Transform(DecodeCached(key, datum, transformer), blob);
+    return;
+  }
+#endif  // USE_OPENCV
+  transformer->Transform(datum, blob);
+}
+
+#ifdef USE_OPENCV
+template<typename Dtype>
+cv::Mat DataLayer<Dtype>::DecodeCached(const string& key,
+    const DatumView& datum, DataTransformer<Dtype>* transformer) {
+  if (key.empty()) {
+    return transformer->Decode(datum);
+  }
+  cv::Mat cv_img;
+  if (!this->CachedSample(key, &cv_img)) {
+    cv_img = transformer->Decode(datum);
+    this->CacheSample(key, cv_img);
+  }
+  return cv_img;
+}
+#endif  // USE_OPENCV
+
+template<typename Dtype>
+int DataLayer<Dtype>::BucketOf(int width) const {
+  const DataParameter& data_param = this->layer_param_.data_param();
+  int bucket = 0;
+  while (bucket < data_param.bucket_width_size() &&
+         width > static_cast<int>(data_param.bucket_width(bucket))) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+template<typename Dtype>
+void DataLayer<Dtype>::FillBucketWindow() {
+  const DataParameter& data_param = this->layer_param_.data_param();
+  while (window_size_ < static_cast<int>(data_param.bucket_window())) {
+    while (Skip()) {
+      Next();
+    }
+    Datum datum;
+    size_t size;
+    const char* value = Value(&size);
+    datum.ParseFromArray(value, size);
+    const string key = CacheKey();
+    Next();
+    // The width of an encoded sample is only known once it is decoded.
+    if (datum.encoded()) {
+#ifdef USE_OPENCV
+      CVMatToDatum(DecodeCached(key, DatumView(datum),
+          this->data_transformer_.get()), &datum);
+#else
+      LOG(FATAL) << "Encoded datum requires OpenCV; compile with USE_OPENCV.";
+#endif  // USE_OPENCV
+    }
+    vector<Datum>& bucket = buckets_[BucketOf(datum.width())];
+    bucket.push_back(Datum());
+    bucket.back().Swap(&datum);
+    ++window_size_;
+  }
+}
+
+template<typename Dtype>
+void DataLayer<Dtype>::LoadBucketedBatch(Batch<Dtype>* batch) {
+  CPUTimer batch_timer;
+  batch_timer.Start();
+  CPUTimer timer;
+  timer.Start();
+  FillBucketWindow();
+  batch->read_us_ = timer.MicroSeconds();
+
+  timer.Start();
+  const DataParameter& data_param = this->layer_param_.data_param();
+  const int batch_size = data_param.batch_size();
+  // Draw from a random bucket that can fill a whole batch; when none can,
+  // the window is full, so drain the fullest one.
+  vector<int> full_buckets;
+  int fullest = 0;
+  for (int i = 0; i < buckets_.size(); ++i) {
+    if (static_cast<int>(buckets_[i].size()) >= batch_size) {
+      full_buckets.push_back(i);
+    }
+    if (buckets_[i].size() > buckets_[fullest].size()) {
+      fullest = i;
+    }
+  }
+  const int bucket = full_buckets.empty() ? fullest :
+      full_buckets[caffe_rng_rand() % full_buckets.size()];
+  vector<Datum>& pending = buckets_[bucket];
+  const int num = std::min<int>(batch_size, pending.size());
+  vector<Datum> items(num);
+  int padded_width = 0;
+  for (int i = 0; i < num; ++i) {
+    const int j = caffe_rng_rand() % pending.size();
+    items[i].Swap(&pending[j]);
+    pending[j].Swap(&pending.back());
+    pending.pop_back();
+    padded_width = std::max(padded_width, items[i].width());
+  }
+  window_size_ -= num;
+  if (bucket < data_param.bucket_width_size()) {
+    padded_width = data_param.bucket_width(bucket);
+  }
+
+  vector<int> top_shape = bucket_transformer_->InferBlobShape(items[0]);
+  const int channels = top_shape[1];
+  const int height = top_shape[2];
+  top_shape[0] = num;
+  top_shape[3] = padded_width;
+  batch->data_.Reshape(top_shape);
+  Dtype* top_data = batch->data_.mutable_cpu_data();
+  caffe_set(batch->data_.count(), Dtype(data_param.bucket_pad_value()),
+      top_data);
+  Dtype* top_label = NULL;
+  if (this->output_labels_) {
+    vector<int> label_shape = batch->label_.shape();
+    label_shape[0] = num;
+    batch->label_.Reshape(label_shape);
+    top_label = batch->label_.mutable_cpu_data();
+  }
+  Dtype* top_length = NULL;
+  if (batch->length_.num_axes() > 0) {
+    batch->length_.Reshape(vector<int>(1, num));
+    top_length = batch->length_.mutable_cpu_data();
+  }
+  uint64_t valid_pixels = 0;
+  for (int i = 0; i < num; ++i) {
+    const Datum& datum = items[i];
+    const vector<int> shape = bucket_transformer_->InferBlobShape(datum);
+    CHECK_EQ(shape[1], channels) << "All samples need the same channels";
+    CHECK_EQ(shape[2], height) << "All samples need the same height";
+    const int width = shape[3];
+    bucket_item_.Reshape(shape);
+    bucket_transformer_->Transform(datum, &bucket_item_);
+    const Dtype* item_data = bucket_item_.cpu_data();
+    for (int c = 0; c < channels; ++c) {
+      for (int h = 0; h < height; ++h) {
+        caffe_copy(width, item_data + (c * height + h) * width,
+            top_data + batch->data_.offset(i, c, h));
+      }
+    }
+    if (top_label) {
+      for (int l = 0; l < datum.label_size(); ++l) {
+        top_label[i * datum.label_size() + l] = datum.label(l);
+      }
+    }
+    if (top_length) {
+      top_length[i] = width;
+    }
+    valid_pixels += channels * height * width;
+  }
+  valid_pixels_ += valid_pixels;
+  padded_pixels_ += batch->data_.count() - valid_pixels;
+  ++bucket_batches_[bucket];
+  batch->transform_us_ = timer.MicroSeconds();
+  batch->load_us_ = batch_timer.MicroSeconds();
+
+  int num_batches = 0;
+  for (int i = 0; i < bucket_batches_.size(); ++i) {
+    num_batches += bucket_batches_[i];
+  }
+  if (num_batches % 1000 == 0) {
+    std::ostringstream batches;
+    for (int i = 0; i < bucket_batches_.size(); ++i) {
+      batches << (i ? " " : "") << bucket_batches_[i];
+    }
+    LOG_IF(INFO, Caffe::root_solver()) << "Width buckets: " << num_batches
+        << " batches (" << batches.str() << " per bucket), padding is "
+        << 100.0 * padded_pixels_ / (valid_pixels_ + padded_pixels_)
+        << "% of the pixels";
+  }
 }
 
 INSTANTIATE_CLASS(DataLayer);
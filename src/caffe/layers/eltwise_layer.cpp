@@ -3,6 +3,7 @@
 
 #include "caffe/layers/eltwise_layer.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -45,51 +46,63 @@ template <typename Dtype>
 void EltwiseLayer<Dtype>::Forward_cpu(
     const vector<Blob<Dtype>*>& bottom, const vector<Blob<Dtype>*>& top) {
   int* mask = NULL;
-  const Dtype* bottom_data_a = NULL;
-  const Dtype* bottom_data_b = NULL;
   const int count = top[0]->count();
   Dtype* top_data = top[0]->mutable_cpu_data();
+  // fetch the pointers up front, the ranges below run concurrently
+  vector<const Dtype*> bottom_data(bottom.size());
+  for (int i = 0; i < bottom.size(); ++i) {
+    bottom_data[i] = bottom[i]->cpu_data();
+  }
   switch (op_) {
   case EltwiseParameter_EltwiseOp_PROD:
-    caffe_mul(count, bottom[0]->cpu_data(), bottom[1]->cpu_data(), top_data);
-    for (int i = 2; i < bottom.size(); ++i) {
-      caffe_mul(count, top_data, bottom[i]->cpu_data(), top_data);
-    }
+    parallel_for(count, [&](int begin, int end) {
+      caffe_mul(end - begin, bottom_data[0] + begin, bottom_data[1] + begin,
+          top_data + begin);
+      for (int i = 2; i < bottom.size(); ++i) {
+        caffe_mul(end - begin, top_data + begin, bottom_data[i] + begin,
+            top_data + begin);
+      }
+    }, kElementwiseGrain);
     break;
   case EltwiseParameter_EltwiseOp_SUM:
-    caffe_set(count, Dtype(0), top_data);
-    // TODO(shelhamer) does BLAS optimize to sum for coeff = 1?
-    for (int i = 0; i < bottom.size(); ++i) {
-      caffe_axpy(count, coeffs_[i], bottom[i]->cpu_data(), top_data);
-    }
+    parallel_for(count, [&](int begin, int end) {
+      caffe_set(end - begin, Dtype(0), top_data + begin);
+      // TODO(shelhamer) does BLAS optimize to sum for coeff = 1?
+      for (int i = 0; i < bottom.size(); ++i) {
+        caffe_axpy(end - begin, coeffs_[i], bottom_data[i] + begin,
+            top_data + begin);
+      }
+    }, kElementwiseGrain);
     break;
   case EltwiseParameter_EltwiseOp_MAX:
     // Initialize
     mask = max_idx_.mutable_cpu_data();
     caffe_set(count, -1, mask);
     caffe_set(count, Dtype(-FLT_MAX), top_data);
-    // bottom 0 & 1
-    bottom_data_a = bottom[0]->cpu_data();
-    bottom_data_b = bottom[1]->cpu_data();
-    for (int idx = 0; idx < count; ++idx) {
-      if (bottom_data_a[idx] > bottom_data_b[idx]) {
-        top_data[idx] = bottom_data_a[idx];  // maxval
-        mask[idx] = 0;  // maxid
-      } else {
-        top_data[idx] = bottom_data_b[idx];  // maxval
-        mask[idx] = 1;  // maxid
-      }
-    }
-    // bottom 2++
-    for (int blob_idx = 2; blob_idx < bottom.size(); ++blob_idx) {
-      bottom_data_b = bottom[blob_idx]->cpu_data();
-      for (int idx = 0; idx < count; ++idx) {
-        if (bottom_data_b[idx] > top_data[idx]) {
+    parallel_for(count, [&](int begin, int end) {
+      // bottom 0 & 1
+      const Dtype* bottom_data_a = bottom_data[0];
+      const Dtype* bottom_data_b = bottom_data[1];
+      for (int idx = begin; idx < end; ++idx) {
+        if (bottom_data_a[idx] > bottom_data_b[idx]) {
+          top_data[idx] = bottom_data_a[idx];  // maxval
+          mask[idx] = 0;  // maxid
+        } else {
           top_data[idx] = bottom_data_b[idx];  // maxval
-          mask[idx] = blob_idx;  // maxid
+          mask[idx] = 1;  // maxid
         }
       }
-    }
+      // bottom 2++
+      for (int blob_idx = 2; blob_idx < bottom.size(); ++blob_idx) {
+        bottom_data_b = bottom_data[blob_idx];
+        for (int idx = begin; idx < end; ++idx) {
+          if (bottom_data_b[idx] > top_data[idx]) {
+            top_data[idx] = bottom_data_b[idx];  // maxval
+            mask[idx] = blob_idx;  // maxid
+          }
+        }
+      }
+    }, kElementwiseGrain);
     break;
   default:
     LOG(FATAL) << "Unknown elementwise operation.";
@@ -1,6 +1,7 @@
 #ifdef USE_OPENCV
 #include <opencv2/core/core.hpp>
 
+#include <algorithm>
 #include <fstream>  // NOLINT(readability/streams)
 #include <iostream>  // NOLINT(readability/streams)
 #include <string>
@@ -63,6 +64,8 @@ void ImageDataLayer<Dtype>::DataLayerSetUp(const vector<Blob<Dtype>*>& bottom,
   const int new_height = this->layer_param_.image_data_param().new_height();
   const int new_width  = this->layer_param_.image_data_param().new_width();
   const bool is_color  = this->layer_param_.image_data_param().is_color();
+  const bool reduced_decode =
+      this->layer_param_.image_data_param().reduced_decode();
   const int task_class_num = this->layer_param_.image_data_param().task_class_num();
   const bool is_regression = this->layer_param_.image_data_param().regression();
 
@@ -71,150 +74,71 @@ void ImageDataLayer<Dtype>::DataLayerSetUp(const vector<Blob<Dtype>*>& bottom,
   CHECK((new_height == 0 && new_width == 0) ||
       (new_height > 0 && new_width > 0)) << "Current implementation requires "
       "new_height and new_width to be set at the same time.";
-  // Read the file with filenames and labels
+  // Read the file with filenames and labels (or regression values)
   const string& source = this->layer_param_.image_data_param().source();
   LOG(INFO) << "Opening file " << source;
-  std::ifstream infile(source.c_str());
-  string line;
-  size_t pos;
-  std::string filename;
-
-  if (!is_regression)
-  {
-	  int label;
-	  while (std::getline(infile, line)) {
-		  std::istringstream iss(line);
-		  iss >> filename;
-		  vector<int> labels;
-		  while (iss >> label)
-			  labels.push_back(label);
-		  lines_.push_back(std::make_pair(filename, labels));
-	  }
-
-	  CHECK(!lines_.empty()) << "File is empty";
-
-	  if (this->layer_param_.image_data_param().shuffle()) {
-		  // randomly shuffle data
-		  LOG(INFO) << "Shuffling data";
-		  const unsigned int prefetch_rng_seed = caffe_rng_rand();
-		  prefetch_rng_.reset(new Caffe::RNG(prefetch_rng_seed));
-		  ShuffleImages();
-	  }
-	  LOG(INFO) << "A total of " << lines_.size() << " images.";
-
-	  lines_id_ = 0;
-	  // Check if we would need to randomly skip a few data points
-	  if (this->layer_param_.image_data_param().rand_skip()) {
-		  unsigned int skip = caffe_rng_rand() %
-			  this->layer_param_.image_data_param().rand_skip();
-		  LOG(INFO) << "Skipping first " << skip << " data points.";
-		  CHECK_GT(lines_.size(), skip) << "Not enough points to skip";
-		  lines_id_ = skip;
-	  }
-	  // Read an image, and use it to initialize the top blob.
-	  cv::Mat cv_img = ReadImageToCVMat(root_folder + lines_[lines_id_].first,
-		  new_height, new_width, is_color);
-	  CHECK(cv_img.data) << "Could not load " << lines_[lines_id_].first;
-	  // Use data_transformer to infer the expected blob shape from a cv_image.
-	  vector<int> top_shape = this->data_transformer_->InferBlobShape(cv_img);
-	  this->transformed_data_.Reshape(top_shape);
-	  // Reshape prefetch_data and top[0] according to the batch_size.
-	  const int batch_size = this->layer_param_.image_data_param().batch_size();
-	  CHECK_GT(batch_size, 0) << "Positive batch size required";
-	  top_shape[0] = batch_size;
-	for (int i = 0; i < this->prefetch_.size(); ++i) {
-		this->prefetch_[i]->data_.Reshape(top_shape);
-	  }
-	  top[0]->Reshape(top_shape);
-
-	  LOG(INFO) << "output data size: " << top[0]->num() << ","
-		  << top[0]->channels() << "," << top[0]->height() << ","
-		  << top[0]->width();
-	  // label
-	  vector<int> label_shape;
-	  label_shape.push_back(batch_size);
-	  label_shape.push_back(lines_[0].second.size());
-	  label_shape.push_back(1);
-	  label_shape.push_back(1);
-	  top[1]->Reshape(label_shape);
-  		for (int i = 0; i < this->prefetch_.size(); ++i) {
-		  this->prefetch_[i]->label_.Reshape(label_shape);
-	  }
+  list_.Load(source, is_regression,
+	  this->layer_param_.image_data_param().list_index());
+  CHECK_GT(list_.size(), 0) << "File is empty";
+
+  order_.resize(list_.size());
+  for (int i = 0; i < order_.size(); ++i)
+	  order_[i] = i;
+  if (this->layer_param_.image_data_param().shuffle()) {
+	  // randomly shuffle data
+	  LOG(INFO) << "Shuffling data";
+	  const unsigned int prefetch_rng_seed = caffe_rng_rand();
+	  prefetch_rng_.reset(new Caffe::RNG(prefetch_rng_seed));
+	  ShuffleImages();
   }
-  else
-  {
-	  float value = 0;
-	  while (std::getline(infile, line)) {
-		  std::istringstream iss(line);
-		  iss >> filename;
-		  vector<float> values;
-		  while (iss >> value)
-			  values.push_back(value);
-
-		  regression_lines_.push_back(std::make_pair(filename, values));
-	  }
-
-	  CHECK(!regression_lines_.empty()) << "File is empty";
-
-	  if (this->layer_param_.image_data_param().shuffle()) {
-		  // randomly shuffle data
-		  LOG(INFO) << "Shuffling data";
-		  const unsigned int prefetch_rng_seed = caffe_rng_rand();
-		  prefetch_rng_.reset(new Caffe::RNG(prefetch_rng_seed));
-		 
-		  caffe::rng_t* prefetch_rng =
-			  static_cast<caffe::rng_t*>(prefetch_rng_->generator());
-		  shuffle(regression_lines_.begin(), regression_lines_.end(), prefetch_rng);
-	  }
-	  LOG(INFO) << "A total of " << regression_lines_.size() << " images.";
-
-	  lines_id_ = 0;
-	  // Check if we would need to randomly skip a few data points
-	  if (this->layer_param_.image_data_param().rand_skip()) {
-		  unsigned int skip = caffe_rng_rand() %
-			  this->layer_param_.image_data_param().rand_skip();
-		  LOG(INFO) << "Skipping first " << skip << " data points.";
-		  CHECK_GT(regression_lines_.size(), skip) << "Not enough points to skip";
-		  lines_id_ = skip;
-	  }
-	  // Read an image, and use it to initialize the top blob.
-	  cv::Mat cv_img = ReadImageToCVMat(root_folder + regression_lines_[lines_id_].first,
-		  new_height, new_width, is_color);
-	  CHECK(cv_img.data) << "Could not load " << regression_lines_[lines_id_].first;
-	  // Use data_transformer to infer the expected blob shape from a cv_image.
-	  vector<int> top_shape = this->data_transformer_->InferBlobShape(cv_img);
-	  this->transformed_data_.Reshape(top_shape);
-	  // Reshape prefetch_data and top[0] according to the batch_size.
-	  const int batch_size = this->layer_param_.image_data_param().batch_size();
-	  CHECK_GT(batch_size, 0) << "Positive batch size required";
-	  top_shape[0] = batch_size;
-	  for (int i = 0; i < this->prefetch_.size(); ++i) {
-		  this->prefetch_[i]->data_.Reshape(top_shape);
-	  }
-	  top[0]->Reshape(top_shape);
-
-	  LOG(INFO) << "output data size: " << top[0]->num() << ","
-		  << top[0]->channels() << "," << top[0]->height() << ","
-		  << top[0]->width();
-
-	  vector<int> regression_values_shape;
-	  regression_values_shape.push_back(batch_size);
-	  regression_values_shape.push_back(regression_lines_[0].second.size());
-	  regression_values_shape.push_back(1);
-	  regression_values_shape.push_back(1);
-	  top[1]->Reshape(regression_values_shape);
-	  for (int i = 0; i < this->prefetch_.size(); ++i) {
-		  this->prefetch_[i]->label_.Reshape(regression_values_shape);
-	  }
+  LOG(INFO) << "A total of " << list_.size() << " images.";
+
+  lines_id_ = 0;
+  // Check if we would need to randomly skip a few data points
+  if (this->layer_param_.image_data_param().rand_skip()) {
+	  unsigned int skip = caffe_rng_rand() %
+		  this->layer_param_.image_data_param().rand_skip();
+	  LOG(INFO) << "Skipping first " << skip << " data points.";
+	  CHECK_GT(list_.size(), skip) << "Not enough points to skip";
+	  lines_id_ = skip;
+  }
+  // Read an image, and use it to initialize the top blob.
+  const char* name = list_.name(order_[lines_id_]);
+  cv::Mat cv_img = ReadImageToCVMat(root_folder + name,
+	  new_height, new_width, is_color, reduced_decode);
+  CHECK(cv_img.data) << "Could not load " << name;
+  // Use data_transformer to infer the expected blob shape from a cv_image.
+  vector<int> top_shape = this->data_transformer_->InferBlobShape(cv_img);
+  this->transformed_data_.Reshape(top_shape);
+  // Reshape prefetch_data and top[0] according to the batch_size.
+  const int batch_size = this->layer_param_.image_data_param().batch_size();
+  CHECK_GT(batch_size, 0) << "Positive batch size required";
+  top_shape[0] = batch_size;
+  for (int i = 0; i < this->prefetch_.size(); ++i) {
+	  this->prefetch_[i]->data_.Reshape(top_shape);
+  }
+  top[0]->Reshape(top_shape);
+
+  LOG(INFO) << "output data size: " << top[0]->num() << ","
+	  << top[0]->channels() << "," << top[0]->height() << ","
+	  << top[0]->width();
+  // label or regression values, as many as the first line has
+  vector<int> label_shape;
+  label_shape.push_back(batch_size);
+  label_shape.push_back(list_.label_count(0));
+  label_shape.push_back(1);
+  label_shape.push_back(1);
+  top[1]->Reshape(label_shape);
+  for (int i = 0; i < this->prefetch_.size(); ++i) {
+	  this->prefetch_[i]->label_.Reshape(label_shape);
   }
-    
 }
 
 template <typename Dtype>
 void ImageDataLayer<Dtype>::ShuffleImages() {
   caffe::rng_t* prefetch_rng =
       static_cast<caffe::rng_t*>(prefetch_rng_->generator());
-  shuffle(lines_.begin(), lines_.end(), prefetch_rng);
+  shuffle(order_.begin(), order_.end(), prefetch_rng);
 }
 
 // This function is called on prefetch thread
@@ -232,109 +156,68 @@ void ImageDataLayer<Dtype>::load_batch(Batch<Dtype>* batch) {
   const int new_height = image_data_param.new_height();
   const int new_width = image_data_param.new_width();
   const bool is_color = image_data_param.is_color();
+  const bool reduced_decode = image_data_param.reduced_decode();
   string root_folder = image_data_param.root_folder();
   const bool is_regression = image_data_param.regression();
 
-  if (!is_regression)
-  {
-	  // Reshape according to the first image of each batch
-	  // on single input batches allows for inputs of varying dimension.
-	  cv::Mat cv_img = ReadImageToCVMat(root_folder + lines_[lines_id_].first,
-		  new_height, new_width, is_color);
-	  CHECK(cv_img.data) << "Could not load " << lines_[lines_id_].first;
-	  // Use data_transformer to infer the expected blob shape from a cv_img.
-	  vector<int> top_shape = this->data_transformer_->InferBlobShape(cv_img);
-	  this->transformed_data_.Reshape(top_shape);
-	  // Reshape batch according to the batch_size.
-	  top_shape[0] = batch_size;
-	  batch->data_.Reshape(top_shape);
-
-	  Dtype* prefetch_data = batch->data_.mutable_cpu_data();
-	  Dtype* prefetch_label = batch->label_.mutable_cpu_data();
-
-	  // datum scales
-	  const int lines_size = lines_.size();
-	  for (int item_id = 0; item_id < batch_size; ++item_id) {
-		  // get a blob
-		  timer.Start();
-		  CHECK_GT(lines_size, lines_id_);
-		  cv::Mat cv_img = ReadImageToCVMat(root_folder + lines_[lines_id_].first,
-			  new_height, new_width, is_color);
-		  CHECK(cv_img.data) << "Could not load " << lines_[lines_id_].first;
-		  read_time += timer.MicroSeconds();
-		  timer.Start();
-		  // Apply transformations (mirror, crop...) to the image
-		  int offset = batch->data_.offset(item_id);
-		  this->transformed_data_.set_cpu_data(prefetch_data + offset);
-		  this->data_transformer_->Transform(cv_img, &(this->transformed_data_));
-		  trans_time += timer.MicroSeconds();
-
-		  //prefetch_label[item_id] = lines_[lines_id_].second;
-		  int label_size = lines_[lines_id_].second.size();
-		  for (int label_id = 0; label_id < label_size; label_id++)
-			  prefetch_label[item_id*label_size + label_id] = lines_[lines_id_].second[label_id];
-
-		  // go to the next iter
-		  lines_id_++;
-		  if (lines_id_ >= lines_size) {
-			  // We have reached the end. Restart from the first.
-			  //DLOG(INFO) << "Restarting data prefetching from start.";
-			  lines_id_ = 0;
-			  if (this->layer_param_.image_data_param().shuffle()) {
-				  ShuffleImages();
-			  }
-		  }
-	  }
+  // Reshape according to the first image of each batch
+  // on single input batches allows for inputs of varying dimension.
+  const char* first_name = list_.name(order_[lines_id_]);
+  cv::Mat cv_img;
+  if (!this->CachedSample(first_name, &cv_img)) {
+    cv_img = ReadImageToCVMat(root_folder + first_name,
+        new_height, new_width, is_color, reduced_decode);
+    CHECK(cv_img.data) << "Could not load " << first_name;
+    this->CacheSample(first_name, cv_img);
   }
-  else
-  {
-	  // Reshape according to the first image of each batch
-	  // on single input batches allows for inputs of varying dimension.
-	  cv::Mat cv_img = ReadImageToCVMat(root_folder + regression_lines_[lines_id_].first,
-		  new_height, new_width, is_color);
-	  CHECK(cv_img.data) << "Could not load " << regression_lines_[lines_id_].first;
-	  // Use data_transformer to infer the expected blob shape from a cv_img.
-	  vector<int> top_shape = this->data_transformer_->InferBlobShape(cv_img);
-	  this->transformed_data_.Reshape(top_shape);
-	  // Reshape batch according to the batch_size.
-	  top_shape[0] = batch_size;
-	  batch->data_.Reshape(top_shape);
-
-	  Dtype* prefetch_data = batch->data_.mutable_cpu_data();
-	  Dtype* prefetch_label = batch->label_.mutable_cpu_data();
-
-	  // datum scales
-	  const int lines_size = regression_lines_.size();
-	  for (int item_id = 0; item_id < batch_size; ++item_id) {
-		  // get a blob
-		  timer.Start();
-		  CHECK_GT(lines_size, lines_id_);
-		  cv::Mat cv_img = ReadImageToCVMat(root_folder + regression_lines_[lines_id_].first,
-			  new_height, new_width, is_color);
-		  CHECK(cv_img.data) << "Could not load " << regression_lines_[lines_id_].first;
-		  read_time += timer.MicroSeconds();
-		  timer.Start();
-		  // Apply transformations (mirror, crop...) to the image
-		  int offset = batch->data_.offset(item_id);
-		  this->transformed_data_.set_cpu_data(prefetch_data + offset);
-		  this->data_transformer_->Transform(cv_img, &(this->transformed_data_));
-		  trans_time += timer.MicroSeconds();
-
-		  int valuenum = regression_lines_[lines_id_].second.size();
-		  for (int value_id = 0; value_id < valuenum; value_id++)
-			  prefetch_label[item_id*valuenum + value_id] = regression_lines_[lines_id_].second[value_id];
-
-		  // go to the next iter
-		  lines_id_++;
-		  if (lines_id_ >= lines_size) {
-			  // We have reached the end. Restart from the first.
-			  //DLOG(INFO) << "Restarting data prefetching from start.";
-			  lines_id_ = 0;
-			  if (this->layer_param_.image_data_param().shuffle()) {
-				  caffe::rng_t* prefetch_rng =
-					  static_cast<caffe::rng_t*>(prefetch_rng_->generator());
-				  shuffle(regression_lines_.begin(), regression_lines_.end(), prefetch_rng);
-			  }
+  // Use data_transformer to infer the expected blob shape from a cv_img.
+  vector<int> top_shape = this->data_transformer_->InferBlobShape(cv_img);
+  this->transformed_data_.Reshape(top_shape);
+  // Reshape batch according to the batch_size.
+  top_shape[0] = batch_size;
+  batch->data_.Reshape(top_shape);
+
+  Dtype* prefetch_data = batch->data_.mutable_cpu_data();
+  Dtype* prefetch_label = batch->label_.mutable_cpu_data();
+  const int label_size = batch->label_.count() / batch_size;
+
+  // datum scales
+  const int lines_size = list_.size();
+  for (int item_id = 0; item_id < batch_size; ++item_id) {
+	  // get a blob
+	  timer.Start();
+	  CHECK_GT(lines_size, lines_id_);
+	  const int line = order_[lines_id_];
+	  const char* name = list_.name(line);
+	  // The cache holds the images as read, before the random transformations.
+	  cv::Mat cv_img;
+	  if (!this->CachedSample(name, &cv_img)) {
+		  cv_img = ReadImageToCVMat(root_folder + name,
+			  new_height, new_width, is_color, reduced_decode);
+		  CHECK(cv_img.data) << "Could not load " << name;
+		  this->CacheSample(name, cv_img);
+	  }
+	  read_time += timer.MicroSeconds();
+	  timer.Start();
+	  // Apply transformations (mirror, crop...) to the image
+	  int offset = batch->data_.offset(item_id);
+	  this->transformed_data_.set_cpu_data(prefetch_data + offset);
+	  this->data_transformer_->Transform(cv_img, &(this->transformed_data_));
+	  trans_time += timer.MicroSeconds();
+
+	  const int label_count = std::min(list_.label_count(line), label_size);
+	  for (int label_id = 0; label_id < label_count; label_id++)
+		  prefetch_label[item_id*label_size + label_id] = is_regression ?
+			  list_.values(line)[label_id] : list_.labels(line)[label_id];
+
+	  // go to the next iter
+	  lines_id_++;
+	  if (lines_id_ >= lines_size) {
+		  // We have reached the end. Restart from the first.
+		  //DLOG(INFO) << "Restarting data prefetching from start.";
+		  lines_id_ = 0;
+		  if (this->layer_param_.image_data_param().shuffle()) {
+			  ShuffleImages();
 		  }
 	  }
   }
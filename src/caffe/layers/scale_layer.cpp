@@ -5,6 +5,7 @@
 #include "caffe/layer_factory.hpp"
 #include "caffe/layers/scale_layer.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -122,14 +123,13 @@ void ScaleLayer<Dtype>::Forward_cpu(
 
   //LOG(INFO) << this->layer_param_.name() << " scale value=" << scale_data[0];
   Dtype* top_data = top[0]->mutable_cpu_data();
-  for (int n = 0; n < outer_dim_; ++n) {
-    for (int d = 0; d < scale_dim_; ++d) {
-      const Dtype factor = scale_data[d];
-      caffe_cpu_scale(inner_dim_, factor, bottom_data, top_data);
-      bottom_data += inner_dim_;
-      top_data += inner_dim_;
+  parallel_for(outer_dim_ * scale_dim_, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const Dtype factor = scale_data[i % scale_dim_];
+      caffe_cpu_scale(inner_dim_, factor, bottom_data + i * inner_dim_,
+          top_data + i * inner_dim_);
     }
-  }
+  });
   if (bias_layer_) {
     bias_layer_->Forward(bias_bottom_vec_, top);
   }
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <vector>
+
+#include "caffe/layers/shard_data_layer.hpp"
+#include "caffe/util/benchmark.hpp"
+#include "caffe/util/rng.hpp"
+
+namespace caffe {
+
+template <typename Dtype>
+ShardDataLayer<Dtype>::~ShardDataLayer() {
+  this->StopInternalThread();
+}
+
+template <typename Dtype>
+void ShardDataLayer<Dtype>::DataLayerSetUp(const vector<Blob<Dtype>*>& bottom,
+      const vector<Blob<Dtype>*>& top) {
+  const ShardDataParameter& shard_param =
+      this->layer_param_.shard_data_param();
+  const TransformationParameter& transform_param = this->transform_param_;
+  CHECK_GT(shard_param.source_size(), 0) << "ShardData needs a source";
+  CHECK_EQ(transform_param.crop_size(), 0) << "ShardData does not crop";
+  CHECK(!transform_param.mirror()) << "ShardData does not mirror";
+  CHECK(!transform_param.has_mean_file())
+      << "ShardData needs mean_value instead of mean_file";
+
+  shard_begin_.assign(1, 0);
+  max_width_ = 0;
+  for (int i = 0; i < shard_param.source_size(); ++i) {
+    shared_ptr<ShardReader> shard(new ShardReader());
+    shard->Open(shard_param.source(i));
+    if (i > 0) {
+      CHECK_EQ(shard->channels(), shards_[0]->channels());
+      CHECK_EQ(shard->height(), shards_[0]->height());
+      CHECK_EQ(shard->label_count(), shards_[0]->label_count());
+    }
+    if (shard->fixed_width()) {
+      max_width_ = std::max(max_width_, shard->fixed_width());
+    } else {
+      for (int j = 0; j < shard->num_records(); ++j) {
+        max_width_ = std::max(max_width_, shard->width(j));
+      }
+    }
+    shard_begin_.push_back(shard_begin_.back() + shard->num_records());
+    shards_.push_back(shard);
+  }
+  const int num_samples = shard_begin_.back();
+  CHECK_GT(num_samples, 0) << "ShardData sources hold no samples";
+  const int channels = shards_[0]->channels();
+  const int height = shards_[0]->height();
+  LOG(INFO) << "A total of " << num_samples << " samples in "
+      << shards_.size() << " shards.";
+
+  mean_values_.assign(transform_param.mean_value().begin(),
+      transform_param.mean_value().end());
+  if (mean_values_.size() > 0) {
+    CHECK(mean_values_.size() == 1 || mean_values_.size() == channels) <<
+     "Specify either 1 mean_value or as many as channels: " << channels;
+    mean_values_.resize(channels, mean_values_[0]);
+  } else {
+    mean_values_.resize(channels, Dtype(0));
+  }
+
+  order_.resize(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    order_[i] = i;
+  }
+  if (shard_param.shuffle()) {
+    const unsigned int prefetch_rng_seed = caffe_rng_rand();
+    prefetch_rng_.reset(new Caffe::RNG(prefetch_rng_seed));
+    ShuffleSamples();
+  }
+  order_id_ = 0;
+
+  const int batch_size = shard_param.batch_size();
+  CHECK_GT(batch_size, 0) << "Positive batch size required";
+  vector<int> top_shape(4);
+  top_shape[0] = batch_size;
+  top_shape[1] = channels;
+  top_shape[2] = height;
+  top_shape[3] = max_width_;
+  top[0]->Reshape(top_shape);
+  for (int i = 0; i < this->prefetch_.size(); ++i) {
+    this->prefetch_[i]->data_.Reshape(top_shape);
+  }
+  LOG(INFO) << "output data size: " << top[0]->num() << ","
+      << top[0]->channels() << "," << top[0]->height() << ","
+      << top[0]->width();
+  if (this->output_labels_) {
+    vector<int> label_shape(4, 1);
+    label_shape[0] = batch_size;
+    label_shape[1] = shards_[0]->label_count();
+    top[1]->Reshape(label_shape);
+    for (int i = 0; i < this->prefetch_.size(); ++i) {
+      this->prefetch_[i]->label_.Reshape(label_shape);
+    }
+  }
+}
+
+template <typename Dtype>
+void ShardDataLayer<Dtype>::ShuffleSamples() {
+  caffe::rng_t* prefetch_rng =
+      static_cast<caffe::rng_t*>(prefetch_rng_->generator());
+  shuffle(order_.begin(), order_.end(), prefetch_rng);
+}
+
+template <typename Dtype>
+void ShardDataLayer<Dtype>::Locate(uint32_t sample, int* shard,
+    int* record) const {
+  *shard = std::upper_bound(shard_begin_.begin(), shard_begin_.end(), sample)
+      - shard_begin_.begin() - 1;
+  *record = sample - shard_begin_[*shard];
+}
+
+// This function is called on prefetch thread
+template <typename Dtype>
+void ShardDataLayer<Dtype>::load_batch(Batch<Dtype>* batch) {
+  CPUTimer batch_timer;
+  batch_timer.Start();
+  const ShardDataParameter& shard_param =
+      this->layer_param_.shard_data_param();
+  const int batch_size = shard_param.batch_size();
+  const int channels = shards_[0]->channels();
+  const int height = shards_[0]->height();
+  const int label_count = shards_[0]->label_count();
+
+  // Pick the samples first: the batch is as wide as its widest sample.
+  vector<int> item_shards(batch_size);
+  vector<int> item_records(batch_size);
+  int batch_width = 0;
+  for (int item_id = 0; item_id < batch_size; ++item_id) {
+    Locate(order_[order_id_], &item_shards[item_id], &item_records[item_id]);
+    batch_width = std::max(batch_width,
+        shards_[item_shards[item_id]]->width(item_records[item_id]));
+    if (++order_id_ == static_cast<int>(order_.size())) {
+      // We have reached the end. Restart from the first.
+      DLOG(INFO) << "Restarting data prefetching from start.";
+      order_id_ = 0;
+      if (shard_param.shuffle()) {
+        ShuffleSamples();
+      }
+    }
+  }
+  batch->data_.Reshape(batch_size, channels, height, batch_width);
+  Dtype* top_data = batch->data_.mutable_cpu_data();
+  Dtype* top_label = this->output_labels_ ?
+      batch->label_.mutable_cpu_data() : NULL;
+  const Dtype scale = this->transform_param_.scale();
+  const Dtype pad_value = shard_param.pad_value();
+
+  for (int item_id = 0; item_id < batch_size; ++item_id) {
+    const ShardReader& shard = *shards_[item_shards[item_id]];
+    const int record = item_records[item_id];
+    const int width = shard.width(record);
+    const uint8_t* pixels = shard.pixels(record);
+    for (int c = 0; c < channels; ++c) {
+      const Dtype mean = mean_values_[c];
+      for (int h = 0; h < height; ++h) {
+        const uint8_t* src = pixels + (c * height + h) * width;
+        Dtype* dst = top_data + batch->data_.offset(item_id, c, h);
+        for (int w = 0; w < width; ++w) {
+          dst[w] = (static_cast<Dtype>(src[w]) - mean) * scale;
+        }
+        for (int w = width; w < batch_width; ++w) {
+          dst[w] = pad_value;
+        }
+      }
+    }
+    if (top_label) {
+      const uint16_t* labels = shard.labels(record);
+      for (int l = 0; l < label_count; ++l) {
+        top_label[item_id * label_count + l] = labels[l] == kShardNoLabel ?
+            Dtype(-1) : static_cast<Dtype>(labels[l]);
+      }
+    }
+  }
+  batch_timer.Stop();
+  batch->read_us_ = 0;
+  batch->transform_us_ = batch_timer.MicroSeconds();
+  batch->load_us_ = batch_timer.MicroSeconds();
+}
+
+INSTANTIATE_CLASS(ShardDataLayer);
+REGISTER_LAYER_CLASS(ShardData);
+
+}  // namespace caffe
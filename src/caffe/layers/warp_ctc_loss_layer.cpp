@@ -3,6 +3,7 @@
 #ifdef USE_WARP_CTC
 #include <ctcpp.h>
 
+#include <algorithm>
 #include <limits>
 
 using namespace CTC;
@@ -16,6 +17,7 @@ WarpCTCLossLayer<Dtype>::WarpCTCLossLayer(const LayerParameter& param)
        N_(0),
        C_(0) {
   blank_index_ = param.ctc_loss_param().blank_index();
+  input_stride_ = param.ctc_loss_param().input_stride();
 }
 
 template <typename Dtype>
@@ -36,7 +38,16 @@ void WarpCTCLossLayer<Dtype>::LayerSetUp(
   C_ = probs->height();
   CHECK_EQ(probs->width(), 1);
 
-  if (bottom.size() == 3) {
+  if (input_stride_ > 0) {
+    CHECK_EQ(bottom.size(), 3)
+        << "input_stride needs bottoms: activations, labels, widths";
+  }
+  if (bottom.size() == 3 && input_stride_ > 0) {
+    const Blob<Dtype>* label_seq = bottom[1];
+    const Blob<Dtype>* width_blob = bottom[2];
+    CHECK_EQ(N_, label_seq->num());
+    CHECK_EQ(N_, width_blob->count());
+  } else if (bottom.size() == 3) {
     const Blob<Dtype>* seq_ind = bottom[1];
     const Blob<Dtype>* label_seq = bottom[2];
     CHECK_EQ(T_, seq_ind->num());
@@ -69,6 +80,12 @@ void WarpCTCLossLayer<Dtype>::Reshape(
     const vector<Blob<Dtype>*>& top) {
   vector<int> loss_shape(0);  // Loss layers output a scalar; 0 axes.
   top[0]->Reshape(loss_shape);
+  // The sequence length follows the input width, which may change per batch.
+  T_ = bottom[0]->num();
+  N_ = bottom[0]->channels();
+  C_ = bottom[0]->height();
+  label_lengths_.resize(N_);
+  input_lengths_.resize(N_);
 }
 
 template <typename Dtype>
@@ -81,7 +98,7 @@ void WarpCTCLossLayer<Dtype>::Forward_cpu(const vector<Blob<Dtype>*>& bottom,
     vector<Dtype> costs(N_);
 
 	flat_labels_.clear();
-	if (bottom.size() == 2) {//bottom[0]=activations, bottom[1] is labels, shape: Batchsize*seq len
+	if (bottom.size() == 2 || (bottom.size() == 3 && input_stride_ > 0)) {//bottom[0]=activations, bottom[1] is labels, shape: Batchsize*seq len
 		const Blob<Dtype>* label_seq_blob = bottom[1];
 		const Dtype *label_seq_d = label_seq_blob->cpu_data();
 		int label_len_per_batch = label_seq_blob->channels();
@@ -100,6 +117,12 @@ void WarpCTCLossLayer<Dtype>::Forward_cpu(const vector<Blob<Dtype>*>& bottom,
 			label_lengths_[n] = curlen;
 			input_lengths_[n] = T_;
 		}
+		if (input_stride_ > 0) {//bottom[2] is the valid width of each sample
+			const Dtype* width_d = bottom[2]->cpu_data();
+			for (int n = 0; n < N_; ++n)
+				input_lengths_[n] = std::min(T_,
+					(static_cast<int>(width_d[n]) + input_stride_ - 1) / input_stride_);
+		}
 	}
     else if (bottom.size() == 3) {
       ExtractInputData(bottom[1], bottom[2],
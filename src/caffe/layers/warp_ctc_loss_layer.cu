@@ -3,6 +3,7 @@
 #ifdef USE_WARP_CTC
 #include <ctcpp.h>
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
 
@@ -23,7 +24,7 @@ void WarpCTCLossLayer<Dtype>::Forward_gpu(const vector<Blob<Dtype>*>& bottom,
     vector<Dtype> costs(N_);
 
 	flat_labels_.clear();
-	if (bottom.size() == 2) {//bottom[0]=activations, bottom[1] is labels, shape: Batchsize*seq len
+	if (bottom.size() == 2 || (bottom.size() == 3 && input_stride_ > 0)) {//bottom[0]=activations, bottom[1] is labels, shape: Batchsize*seq len
 		const Blob<Dtype>* label_seq_blob = bottom[1];
 		const Dtype *label_seq_d = label_seq_blob->cpu_data();
 		int label_len_per_batch = label_seq_blob->channels();
@@ -42,6 +43,12 @@ void WarpCTCLossLayer<Dtype>::Forward_gpu(const vector<Blob<Dtype>*>& bottom,
 			label_lengths_[n] = curlen;
 			input_lengths_[n] = T_;
 		}
+		if (input_stride_ > 0) {//bottom[2] is the valid width of each sample
+			const Dtype* width_d = bottom[2]->cpu_data();
+			for (int n = 0; n < N_; ++n)
+				input_lengths_[n] = std::min(T_,
+					(static_cast<int>(width_d[n]) + input_stride_ - 1) / input_stride_);
+		}
 	}
 	else if(bottom.size() == 3) {
       ExtractInputData(bottom[1], bottom[2],
@@ -1,4 +1,9 @@
+#include <stdint.h>
+
 #include <algorithm>
+#include <climits>
+#include <cstring>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -15,6 +20,7 @@
 #include "caffe/util/hdf5.hpp"
 #include "caffe/util/insert_splits.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/trace.hpp"
 #include "caffe/util/upgrade_proto.hpp"
 
 #include "caffe/test/test_caffe_main.hpp"
@@ -47,7 +53,7 @@ Net<Dtype>::Net(const string& param_file, Phase phase,
 
 template <typename Dtype>
 void Net<Dtype>::Init(const NetParameter& in_param) {
-  CHECK(Caffe::root_solver() || root_net_)
+  CHECK(Caffe::root_solver() || root_net_ || Caffe::multiprocess())
       << "root_net_ needs to be set for all non-root solvers";
   // Set phase from the state.
   phase_ = in_param.state().phase();
@@ -75,7 +81,7 @@ void Net<Dtype>::Init(const NetParameter& in_param) {
   bottom_need_backward_.resize(param.layer_size());
   for (int layer_id = 0; layer_id < param.layer_size(); ++layer_id) {
     // For non-root solvers, whether this layer is shared from root_net_.
-    bool share_from_root = !Caffe::root_solver()
+    bool share_from_root = !Caffe::root_solver() && root_net_
         && root_net_->layers_[layer_id]->ShareInParallel();
     // Inherit phase from net if unset.
     if (!param.layer(layer_id).has_phase()) {
@@ -280,6 +286,11 @@ void Net<Dtype>::Init(const NetParameter& in_param) {
   }
   ShareWeights();
   debug_info_ = param.debug_info();
+  share_activations_ = false;
+  params_flat_ = false;
+  flat_params_count_ = 0;
+  activation_bytes_ = memory_used_ * sizeof(Dtype);
+  shared_activation_bytes_ = activation_bytes_;
   LOG_IF(INFO, Caffe::root_solver()) << "Network initialization done.";
 }
 
@@ -545,8 +556,11 @@ Dtype Net<Dtype>::ForwardFromTo(int start, int end) {
   CHECK_GE(start, 0);
   CHECK_LT(end, layers_.size());
   Dtype loss = 0;
+  // Blobs that outgrew their shared buffer in the last pass get a new plan.
+  if (share_activations_ && start == 0) { PlanActivationMemory(false); }
   for (int i = start; i <= end; ++i) {
     // LOG(ERROR) << "Forwarding " << layer_names_[i];
+    TraceScope trace("forward", layer_names_[i]);
     Dtype layer_loss = layers_[i]->Forward(bottom_vecs_[i], top_vecs_[i]);
     loss += layer_loss;
     if (debug_info_) { ForwardDebugInfo(i); }
@@ -592,6 +606,7 @@ void Net<Dtype>::BackwardFromTo(int start, int end) {
   CHECK_LT(start, layers_.size());
   for (int i = start; i >= end; --i) {
     if (layer_need_backward_[i]) {
+      TraceScope trace("backward", layer_names_[i]);
       layers_[i]->Backward(
           top_vecs_[i], bottom_need_backward_[i], bottom_vecs_[i]);
       if (debug_info_) { BackwardDebugInfo(i); }
@@ -680,6 +695,16 @@ void Net<Dtype>::UpdateDebugInfo(const int param_id) {
 
 template <typename Dtype>
 void Net<Dtype>::ShareTrainedLayersWith(const Net* other) {
+  TransferTrainedLayers(other, false);
+}
+
+template <typename Dtype>
+void Net<Dtype>::CopyTrainedLayersFrom(const Net* other) {
+  TransferTrainedLayers(other, true);
+}
+
+template <typename Dtype>
+void Net<Dtype>::TransferTrainedLayers(const Net* other, bool copy) {
   int num_source_layers = other->layers().size();
   for (int i = 0; i < num_source_layers; ++i) {
     Layer<Dtype>* source_layer = other->layers()[i].get();
@@ -705,7 +730,11 @@ void Net<Dtype>::ShareTrainedLayersWith(const Net* other) {
           << source_layer_name << "'; shape mismatch.  Source param shape is "
           << source_blob->shape_string() << "; target param shape is "
           << target_blobs[j]->shape_string();
-      target_blobs[j]->ShareData(*source_blob);
+      if (copy) {
+        target_blobs[j]->CopyFrom(*source_blob);
+      } else {
+        target_blobs[j]->ShareData(*source_blob);
+      }
     }
   }
 }
@@ -744,6 +773,170 @@ void Net<Dtype>::Reshape() {
   for (int i = 0; i < layers_.size(); ++i) {
     layers_[i]->Reshape(bottom_vecs_[i], top_vecs_[i]);
   }
+  if (share_activations_) { PlanActivationMemory(false); }
+}
+
+template <typename Dtype>
+void Net<Dtype>::ShareActivationMemory(const vector<string>& keep_blobs) {
+  CHECK_EQ(phase_, TEST) << "Activation memory can only be shared in TEST.";
+  for (int i = 0; i < keep_blobs.size(); ++i) {
+    CHECK(has_blob(keep_blobs[i])) << "Unknown blob " << keep_blobs[i];
+    keep_blobs_.insert(keep_blobs[i]);
+  }
+  share_activations_ = true;
+  planned_mode_ = Caffe::mode();
+  PlanActivationMemory(true);
+}
+
+template <typename Dtype>
+void Net<Dtype>::KeepBlob(const string& blob_name) {
+  CHECK(has_blob(blob_name)) << "Unknown blob " << blob_name;
+  if (!keep_blobs_.insert(blob_name).second) { return; }
+  if (share_activations_) { PlanActivationMemory(true); }
+}
+
+template <typename Dtype>
+void Net<Dtype>::PlanActivationMemory(bool force) {
+  CHECK_EQ(planned_mode_, Caffe::mode())
+      << "Caffe::mode() changed after ShareActivationMemory.";
+  if (!force) {
+    bool changed = false;
+    for (int i = 0; i < blobs_.size() && !changed; ++i) {
+      changed = blobs_[i]->data().get() != planned_memory_[i];
+    }
+    if (!changed) { return; }
+  }
+  // Blobs sharing a SyncedMemory (Split, Flatten, Reshape, in-place Concat)
+  // form one group that lives as long as its longest-lived member.
+  map<SyncedMemory*, int> group_index;
+  vector<SyncedMemory*> group_memory;
+  vector<int> group_first, group_last;
+  vector<bool> group_kept;
+  vector<int> blob_group(blobs_.size(), -1);
+  for (int i = 0; i < blobs_.size(); ++i) {
+    SyncedMemory* memory = blobs_[i]->data().get();
+    if (memory == NULL || memory->size() == 0) { continue; }
+    map<SyncedMemory*, int>::iterator it = group_index.find(memory);
+    if (it == group_index.end()) {
+      it = group_index.insert(make_pair(memory, group_memory.size())).first;
+      group_memory.push_back(memory);
+      group_first.push_back(INT_MAX);
+      group_last.push_back(-1);
+      group_kept.push_back(false);
+    }
+    blob_group[i] = it->second;
+    if (keep_blobs_.count(blob_names_[i])) { group_kept[it->second] = true; }
+  }
+  for (int i = 0; i < net_input_blob_indices_.size(); ++i) {
+    const int group = blob_group[net_input_blob_indices_[i]];
+    if (group >= 0) { group_kept[group] = true; }
+  }
+  for (int i = 0; i < net_output_blob_indices_.size(); ++i) {
+    const int group = blob_group[net_output_blob_indices_[i]];
+    if (group >= 0) { group_kept[group] = true; }
+  }
+  // Input layer tops are filled by the caller before Forward.
+  for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+    if (strcmp(layers_[layer_id]->type(), "Input") != 0) { continue; }
+    for (int j = 0; j < top_id_vecs_[layer_id].size(); ++j) {
+      const int group = blob_group[top_id_vecs_[layer_id][j]];
+      if (group >= 0) { group_kept[group] = true; }
+    }
+  }
+  for (int layer_id = 0; layer_id < layers_.size(); ++layer_id) {
+    for (int j = 0; j < bottom_id_vecs_[layer_id].size(); ++j) {
+      const int group = blob_group[bottom_id_vecs_[layer_id][j]];
+      if (group < 0) { continue; }
+      group_last[group] = std::max(group_last[group], layer_id);
+    }
+    for (int j = 0; j < top_id_vecs_[layer_id].size(); ++j) {
+      const int group = blob_group[top_id_vecs_[layer_id][j]];
+      if (group < 0) { continue; }
+      group_first[group] = std::min(group_first[group], layer_id);
+      group_last[group] = std::max(group_last[group], layer_id);
+    }
+  }
+  // Kept memory that is already backed by a slab cannot be left pointing at
+  // it once the old slabs are released, so it moves to a slab of its own.
+  // Largest groups first, each into the first slab whose groups all have
+  // disjoint lifetimes.
+  vector<pair<size_t, int> > order;
+  size_t total_bytes = 0;
+  size_t kept_bytes = 0;
+  for (int g = 0; g < group_memory.size(); ++g) {
+    total_bytes += group_memory[g]->size();
+    if (group_first[g] == INT_MAX) { group_kept[g] = true; }
+    if (!group_kept[g] || slab_backed_.count(group_memory[g])) {
+      order.push_back(make_pair(group_memory[g]->size(), g));
+    } else {
+      kept_bytes += group_memory[g]->size();
+    }
+  }
+  std::sort(order.begin(), order.end(), std::greater<pair<size_t, int> >());
+  vector<size_t> slab_size;
+  vector<vector<int> > slab_groups;
+  for (int i = 0; i < order.size(); ++i) {
+    const int g = order[i].second;
+    int slab = -1;
+    for (int s = 0; s < slab_size.size() && slab < 0; ++s) {
+      bool fits = !group_kept[g] && !group_kept[slab_groups[s][0]];
+      for (int k = 0; k < slab_groups[s].size() && fits; ++k) {
+        const int other = slab_groups[s][k];
+        fits = group_last[other] < group_first[g] ||
+            group_last[g] < group_first[other];
+      }
+      if (fits) { slab = s; }
+    }
+    if (slab < 0) {
+      slab = slab_size.size();
+      slab_size.push_back(0);
+      slab_groups.push_back(vector<int>());
+    }
+    slab_size[slab] = std::max(slab_size[slab], order[i].first);
+    slab_groups[slab].push_back(g);
+  }
+  vector<shared_ptr<SyncedMemory> > slabs;
+  size_t slab_bytes = 0;
+  for (int s = 0; s < slab_size.size(); ++s) {
+    slabs.push_back(shared_ptr<SyncedMemory>(new SyncedMemory(slab_size[s])));
+    slab_bytes += slab_size[s];
+    void* data = (Caffe::mode() == Caffe::CPU) ?
+        slabs[s]->mutable_cpu_data() : slabs[s]->mutable_gpu_data();
+    for (int k = 0; k < slab_groups[s].size(); ++k) {
+      const int g = slab_groups[s][k];
+      SyncedMemory* memory = group_memory[g];
+      if (Caffe::mode() == Caffe::CPU) {
+        if (group_kept[g]) {
+          memcpy(data, memory->cpu_data(), memory->size());
+        }
+        memory->set_cpu_data(data);
+      } else {
+#ifndef CPU_ONLY
+        if (group_kept[g]) {
+          caffe_gpu_memcpy(memory->size(), memory->gpu_data(), data);
+        }
+        memory->set_gpu_data(data);
+#else
+        NO_GPU;
+#endif
+      }
+    }
+  }
+  activation_slabs_.swap(slabs);
+  slab_backed_.clear();
+  for (int i = 0; i < order.size(); ++i) {
+    slab_backed_.insert(group_memory[order[i].second]);
+  }
+  planned_memory_.resize(blobs_.size());
+  for (int i = 0; i < blobs_.size(); ++i) {
+    planned_memory_[i] = blobs_[i]->data().get();
+  }
+  activation_bytes_ = total_bytes;
+  shared_activation_bytes_ = kept_bytes + slab_bytes;
+  LOG_IF(INFO, Caffe::root_solver())
+      << "Activation memory of " << name_ << ": " << activation_bytes_
+      << " bytes -> " << shared_activation_bytes_ << " bytes in "
+      << activation_slabs_.size() << " shared buffers.";
 }
 
 template <typename Dtype>
@@ -866,8 +1059,19 @@ void Net<Dtype>::ToProto(NetParameter* param, bool write_diff) const {
 
 template <typename Dtype>
 void Net<Dtype>::ToHDF5(const string& filename, bool write_diff) const {
-  hid_t file_hid = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
-      H5P_DEFAULT);
+  WriteHDF5(filename, write_diff, NULL);
+}
+
+template <typename Dtype>
+void Net<Dtype>::ToHDF5Image(string* image, bool write_diff) const {
+  WriteHDF5("in-memory image", write_diff, CHECK_NOTNULL(image));
+}
+
+template <typename Dtype>
+void Net<Dtype>::WriteHDF5(const string& filename, bool write_diff,
+    string* image) const {
+  hid_t file_hid = image ? hdf5_create_in_memory() :
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
   CHECK_GE(file_hid, 0)
       << "Couldn't open " << filename << " to save weights.";
   hid_t data_hid = H5Gcreate2(file_hid, "data", H5P_DEFAULT, H5P_DEFAULT,
@@ -918,18 +1122,140 @@ void Net<Dtype>::ToHDF5(const string& filename, bool write_diff) const {
   if (write_diff) {
     H5Gclose(diff_hid);
   }
+  if (image) {
+    *image = hdf5_file_image(file_hid);
+  }
   H5Fclose(file_hid);
 }
 
 template <typename Dtype>
 void Net<Dtype>::Update() {
+  if (params_flat()) {
+    const Dtype* diff = mutable_flat_diff();
+    Dtype* data = mutable_flat_data();
+    switch (Caffe::mode()) {
+    case Caffe::CPU:
+      caffe_axpy<Dtype>(flat_params_count_, Dtype(-1), diff, data);
+      break;
+    case Caffe::GPU:
+#ifndef CPU_ONLY
+      caffe_gpu_axpy<Dtype>(flat_params_count_, Dtype(-1), diff, data);
+#else
+      NO_GPU;
+#endif
+      break;
+    }
+    return;
+  }
   for (int i = 0; i < learnable_params_.size(); ++i) {
     learnable_params_[i]->Update();
   }
 }
 
+template <typename Dtype>
+void Net<Dtype>::FlattenParams() {
+  CHECK(!params_flat_) << "The params are already flat";
+  flat_params_count_ = 0;
+  for (int i = 0; i < learnable_params_.size(); ++i) {
+    flat_params_count_ += learnable_params_[i]->count();
+  }
+  if (flat_params_count_ == 0) {
+    return;
+  }
+  flat_mode_ = Caffe::mode();
+  // Room to start the CPU buffers on a cache line.
+  const int pad = 64 / sizeof(Dtype);
+  const size_t bytes = (flat_params_count_ + pad) * sizeof(Dtype);
+  flat_data_.reset(new SyncedMemory(bytes));
+  flat_diff_.reset(new SyncedMemory(bytes));
+  Dtype* data;
+  Dtype* diff;
+  if (flat_mode_ == Caffe::CPU) {
+    data = static_cast<Dtype*>(flat_data_->mutable_cpu_data());
+    diff = static_cast<Dtype*>(flat_diff_->mutable_cpu_data());
+    data += (pad - reinterpret_cast<uintptr_t>(data) / sizeof(Dtype) % pad)
+        % pad;
+    diff += (pad - reinterpret_cast<uintptr_t>(diff) / sizeof(Dtype) % pad)
+        % pad;
+  } else {
+    data = static_cast<Dtype*>(flat_data_->mutable_gpu_data());
+    diff = static_cast<Dtype*>(flat_diff_->mutable_gpu_data());
+  }
+  // Shared params follow their owners, whose SyncedMemory they use.
+  for (int i = 0; i < learnable_params_.size(); ++i) {
+    Blob<Dtype>* blob = learnable_params_[i];
+    const int count = blob->count();
+    if (flat_mode_ == Caffe::CPU) {
+      caffe_copy(count, blob->cpu_data(), data);
+      caffe_copy(count, blob->cpu_diff(), diff);
+      blob->data()->set_cpu_data(data);
+      blob->diff()->set_cpu_data(diff);
+    } else {
+#ifndef CPU_ONLY
+      caffe_copy(count, blob->gpu_data(), data);
+      caffe_copy(count, blob->gpu_diff(), diff);
+      blob->data()->set_gpu_data(data);
+      blob->diff()->set_gpu_data(diff);
+#else
+      NO_GPU;
+#endif
+    }
+    data += count;
+    diff += count;
+  }
+  params_flat_ = true;
+  LOG_IF(INFO, Caffe::root_solver()) << "Flattened "
+      << learnable_params_.size() << " learnable params ("
+      << flat_params_count_ << " values)";
+}
+
+template <typename Dtype>
+Dtype* Net<Dtype>::mutable_flat_data() {
+  CHECK(params_flat());
+  // Walk back to the first param so that every head is updated.
+  Dtype* data = NULL;
+  for (int i = learnable_params_.size() - 1; i >= 0; --i) {
+    Blob<Dtype>* blob = learnable_params_[i];
+    Dtype* param = Caffe::mode() == Caffe::CPU ? blob->mutable_cpu_data() :
+        blob->mutable_gpu_data();
+    DCHECK(!data || param + blob->count() == data) << "Params are not flat";
+    data = param;
+  }
+  return data;
+}
+
+template <typename Dtype>
+Dtype* Net<Dtype>::mutable_flat_diff() {
+  CHECK(params_flat());
+  Dtype* diff = NULL;
+  for (int i = learnable_params_.size() - 1; i >= 0; --i) {
+    Blob<Dtype>* blob = learnable_params_[i];
+    Dtype* param = Caffe::mode() == Caffe::CPU ? blob->mutable_cpu_diff() :
+        blob->mutable_gpu_diff();
+    DCHECK(!diff || param + blob->count() == diff) << "Params are not flat";
+    diff = param;
+  }
+  return diff;
+}
+
 template <typename Dtype>
 void Net<Dtype>::ClearParamDiffs() {
+  if (params_flat()) {
+    Dtype* diff = mutable_flat_diff();
+    switch (Caffe::mode()) {
+    case Caffe::CPU:
+      caffe_set(flat_params_count_, static_cast<Dtype>(0), diff);
+      break;
+    case Caffe::GPU:
+#ifndef CPU_ONLY
+      caffe_gpu_set(flat_params_count_, static_cast<Dtype>(0), diff);
+#else
+      NO_GPU;
+#endif
+      break;
+    }
+    return;
+  }
   for (int i = 0; i < learnable_params_.size(); ++i) {
     Blob<Dtype>* blob = learnable_params_[i];
     switch (Caffe::mode()) {
@@ -4,10 +4,18 @@
 #include <glog/logging.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <new>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "boost/bind.hpp"
+#include "boost/interprocess/mapped_region.hpp"
+#include "boost/interprocess/shared_memory_object.hpp"
+#include "boost/interprocess/sync/interprocess_condition.hpp"
+#include "boost/interprocess/sync/interprocess_mutex.hpp"
+#include "boost/interprocess/sync/scoped_lock.hpp"
 #include "boost/thread.hpp"
 #include "caffe/caffe.hpp"
 #include "caffe/parallel.hpp"
@@ -436,8 +444,432 @@ void P2PSync<Dtype>::Run(const vector<int>& gpus) {
   }
 }
 
+namespace {
+
+const int kMaxShmRanks = 64;
+
+}  // namespace
+
+// Lives at the start of the shared memory, followed by the parameters and
+// one gradient buffer per process.
+template<typename Dtype>
+struct ShmSync<Dtype>::Header {
+  boost::interprocess::interprocess_mutex mutex;
+  boost::interprocess::interprocess_condition condition;
+  int ranks;
+  int initial_iter;
+  // Barrier state; stop is set by the root once it is done.
+  int arrived;
+  int generation;
+  bool stop;
+  // Cumulative timings of each process, read by the root at display.
+  double compute_us[kMaxShmRanks];
+  double sync_us[kMaxShmRanks];
+};
+
+template<typename Dtype>
+class ShmSync<Dtype>::Shm {
+ public:
+  Shm(const string& name, size_t size, bool create) : name_(name) {
+    using boost::interprocess::shared_memory_object;
+    try {
+      if (create) {
+        shared_memory_object::remove(name.c_str());
+        object_ = shared_memory_object(boost::interprocess::create_only,
+            name.c_str(), boost::interprocess::read_write);
+        object_.truncate(size);
+      } else {
+        object_ = shared_memory_object(boost::interprocess::open_only,
+            name.c_str(), boost::interprocess::read_write);
+      }
+      region_ = boost::interprocess::mapped_region(object_,
+          boost::interprocess::read_write, 0, size);
+    } catch (const boost::interprocess::interprocess_exception& e) {
+      LOG(FATAL) << "Cannot map shared memory " << name << ": " << e.what();
+    }
+    owner_ = create;
+  }
+  ~Shm() {
+    if (owner_) {
+      boost::interprocess::shared_memory_object::remove(name_.c_str());
+    }
+  }
+  char* data() { return static_cast<char*>(region_.get_address()); }
+
+ private:
+  string name_;
+  bool owner_;
+  boost::interprocess::shared_memory_object object_;
+  boost::interprocess::mapped_region region_;
+};
+
+template<typename Dtype>
+ShmSync<Dtype>::ShmSync(shared_ptr<Solver<Dtype> > solver,
+                        const string& name)
+    : Params<Dtype>(solver),
+      header_(),
+      grads_(),
+      solver_(solver),
+      stopped_(false),
+      compute_us_(0),
+      sync_us_(0),
+      display_iter_(solver->iter()),
+      display_compute_us_(0),
+      display_sync_us_(0) {
+  CHECK(Caffe::mode() == Caffe::CPU) << "ShmSync only runs in CPU mode";
+  const int ranks = Caffe::solver_count();
+  const int rank = Caffe::solver_rank();
+  CHECK_LE(ranks, kMaxShmRanks);
+  // Keep the parameters aligned for vectorized loops.
+  const size_t header_size = (sizeof(Header) + 63) / 64 * 64;
+  shm_.reset(new Shm(name, header_size + (ranks + 1) * size_ * sizeof(Dtype),
+      Caffe::root_solver()));
+  header_ = reinterpret_cast<Header*>(shm_->data());
+  data_ = reinterpret_cast<Dtype*>(shm_->data() + header_size);
+  grads_ = data_ + size_;
+  diff_ = grads_ + rank * size_;
+
+  const vector<Blob<Dtype>*>& net = solver_->net()->learnable_params();
+  if (Caffe::root_solver()) {
+    new (header_) Header();
+    header_->ranks = ranks;
+    header_->initial_iter = solver_->iter();
+    header_->arrived = 0;
+    header_->generation = 0;
+    header_->stop = false;
+    std::fill(header_->compute_us, header_->compute_us + kMaxShmRanks, 0.);
+    std::fill(header_->sync_us, header_->sync_us + kMaxShmRanks, 0.);
+    apply_buffers(net, data_, size_, copy);
+    caffe_set(ranks * size_, Dtype(0), grads_);
+  } else {
+    CHECK_EQ(header_->ranks, ranks) << "Shared memory " << name
+        << " was created for another number of solvers";
+    // Workers have no solver state to restore; they follow the root.
+    solver_->SetActionFunction(boost::bind(&ShmSync::RequestedAction, this));
+  }
+  apply_buffers(net, data_, size_, replace_cpu);
+  apply_buffers(net, diff_, size_, replace_cpu_diff);
+  solver_->add_callback(this);
+}
+
+template<typename Dtype>
+ShmSync<Dtype>::~ShmSync() {
+}
+
+template<typename Dtype>
+void ShmSync<Dtype>::Run() {
+  if (!Caffe::root_solver()) {
+    solver_->Step(solver_->param().max_iter() - header_->initial_iter);
+    return;
+  }
+  LOG(INFO) << "Starting Optimization on " << Caffe::solver_count()
+      << " processes";
+  display_timer_.Start();
+  solver_->Solve();
+  // Release the workers if training stopped early.
+  boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex>
+      lock(header_->mutex);
+  header_->stop = true;
+  header_->condition.notify_all();
+}
+
+template<typename Dtype>
+bool ShmSync<Dtype>::Wait() {
+  boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex>
+      lock(header_->mutex);
+  if (header_->stop) {
+    return false;
+  }
+  const int generation = header_->generation;
+  if (++header_->arrived == header_->ranks) {
+    header_->arrived = 0;
+    ++header_->generation;
+    header_->condition.notify_all();
+    return true;
+  }
+  while (header_->generation == generation && !header_->stop) {
+    header_->condition.wait(lock);
+  }
+  return header_->generation != generation;
+}
+
+template<typename Dtype>
+SolverAction::Enum ShmSync<Dtype>::RequestedAction() {
+  return stopped_ ? SolverAction::STOP : SolverAction::NONE;
+}
+
+template<typename Dtype>
+void ShmSync<Dtype>::on_start() {
+  if (stopped_) {
+    return;
+  }
+  // Wait for the root to update the parameters.
+  timer_.Start();
+  if (!Wait()) {
+    stopped_ = true;
+    return;
+  }
+  sync_us_ += timer_.MicroSeconds();
+  const int display = solver_->param().display();
+  if (Caffe::root_solver() && display && solver_->iter() % display == 0 &&
+      solver_->iter() > display_iter_) {
+    DisplayStats();
+  }
+  timer_.Start();
+}
+
+template<typename Dtype>
+void ShmSync<Dtype>::on_gradients_ready() {
+  if (stopped_) {
+    return;
+  }
+  compute_us_ += timer_.MicroSeconds();
+  timer_.Start();
+  if (!Wait()) {
+    stopped_ = true;
+    return;
+  }
+  // Every process sums its slice of the gradient buffers into the root's
+  // buffer, which the root's update then reads.
+  const int ranks = Caffe::solver_count();
+  const int rank = Caffe::solver_rank();
+  const size_t begin = size_ * rank / ranks;
+  const int count = size_ * (rank + 1) / ranks - begin;
+  Dtype* sum = grads_ + begin;
+  for (int i = 1; i < ranks; ++i) {
+    caffe_axpy<Dtype>(count, Dtype(1), grads_ + i * size_ + begin, sum);
+  }
+  // Loss functions divide gradients by the batch size, so to compensate
+  // for split batch, divide by number of solvers.
+  caffe_scal<Dtype>(count, Dtype(1.0 / ranks), sum);
+  if (!Wait()) {
+    stopped_ = true;
+    return;
+  }
+  sync_us_ += timer_.MicroSeconds();
+  // The root reads these after the next Wait in on_start.
+  header_->compute_us[rank] = compute_us_;
+  header_->sync_us[rank] = sync_us_;
+}
+
+template<typename Dtype>
+void ShmSync<Dtype>::DisplayStats() {
+  double compute_us = 0;
+  double sync_us = 0;
+  for (int i = 0; i < header_->ranks; ++i) {
+    compute_us += header_->compute_us[i];
+    sync_us += header_->sync_us[i];
+  }
+  const int iters = solver_->iter() - display_iter_;
+  const double busy_us = compute_us - display_compute_us_;
+  const double total_us = busy_us + sync_us - display_sync_us_;
+  // Efficiency is the share of the processes' time spent in forward and
+  // backward; compare iter/s with a run on fewer processes for the speedup.
+  LOG(INFO) << "    ShmSync: " << header_->ranks << " processes, "
+      << iters / display_timer_.Seconds() << " iter/s, parallel efficiency "
+      << (total_us > 0 ? 100 * busy_us / total_us : 100) << "%";
+  display_timer_.Start();
+  display_iter_ = solver_->iter();
+  display_compute_us_ = compute_us;
+  display_sync_us_ = sync_us;
+}
+
+template<typename Dtype>
+class HogwildSync<Dtype>::Sync {
+ public:
+  Sync() : threads(Caffe::solver_count()), arrived(0), generation(0),
+      stop(false), iters(0) {}
+
+  boost::mutex mutex;
+  boost::condition_variable condition;
+  // Barrier state; threads that are done leave it. stop is set by the root
+  // once it is done.
+  int threads;
+  int arrived;
+  int generation;
+  bool stop;
+  // Iterations run by all threads.
+  int64_t iters;
+};
+
+template<typename Dtype>
+HogwildSync<Dtype>::HogwildSync(shared_ptr<Solver<Dtype> > root_solver)
+    : root_(this),
+      sync_(new Sync()),
+      solver_(root_solver),
+      rank_(0),
+      cpu_threads_(Caffe::cpu_threads()),
+      start_iter_(root_solver->iter()),
+      stopped_(false),
+      display_iters_(0) {
+  CHECK(Caffe::mode() == Caffe::CPU) << "HogwildSync only runs in CPU mode";
+  CHECK(Caffe::root_solver());
+  solver_->add_callback(this);
+  for (int rank = 1; rank < Caffe::solver_count(); ++rank) {
+    workers_.push_back(shared_ptr<HogwildSync<Dtype> >(
+        new HogwildSync<Dtype>(this, rank)));
+  }
+}
+
+template<typename Dtype>
+HogwildSync<Dtype>::HogwildSync(HogwildSync<Dtype>* root, int rank)
+    : root_(root),
+      rank_(rank),
+      cpu_threads_(root->cpu_threads_),
+      start_iter_(0),
+      stopped_(false),
+      display_iters_(0) {
+  SolverParameter param(root->solver_->param());
+  param.set_type(root->solver_->type());
+  // Only the root tests, snapshots and displays.
+  param.set_test_interval(0);
+  param.set_snapshot(0);
+  param.set_display(0);
+  param.clear_data_stats_file();
+  // The parameter data is replaced by the root's below.
+  param.set_flat_params(false);
+  // Set up the data layers as this rank, without a root net in this
+  // process, as the workers of ShmSync do.
+  const bool multiprocess = Caffe::multiprocess();
+  Caffe::set_solver_rank(rank);
+  Caffe::set_multiprocess(true);
+  solver_.reset(SolverRegistry<Dtype>::CreateSolver(param));
+  Caffe::set_solver_rank(0);
+  Caffe::set_multiprocess(multiprocess);
+  // Diffs and history stay private.
+  solver_->net()->ShareTrainedLayersWith(root->solver_->net().get());
+  solver_->SetActionFunction(boost::bind(&HogwildSync::RequestedAction, this));
+  solver_->add_callback(this);
+}
+
+template<typename Dtype>
+HogwildSync<Dtype>::~HogwildSync() {
+}
+
+template<typename Dtype>
+void HogwildSync<Dtype>::Restore(const char* state_file) {
+  for (int i = 0; i < workers_.size(); ++i) {
+    workers_[i]->solver_->Restore(state_file);
+  }
+}
+
+template<typename Dtype>
+void HogwildSync<Dtype>::Run() {
+  LOG(INFO) << "Starting Optimization on " << Caffe::solver_count()
+      << " Hogwild threads";
+  for (int i = 0; i < workers_.size(); ++i) {
+    workers_[i]->StartInternalThread();
+  }
+  start_iter_ = solver_->iter();
+  display_timer_.Start();
+  solver_->Solve();
+  {
+    boost::mutex::scoped_lock lock(sync_->mutex);
+    sync_->stop = true;
+    sync_->condition.notify_all();
+  }
+  for (int i = 0; i < workers_.size(); ++i) {
+    workers_[i]->StopInternalThread();
+  }
+}
+
+template<typename Dtype>
+void HogwildSync<Dtype>::InternalThreadEntry() {
+  // The thread runs as rank 0, like the root: the solver updates the
+  // shared parameters itself. Only its data layers read as rank_.
+  Caffe::set_cpu_threads(cpu_threads_);
+  if (solver_->param().random_seed() >= 0) {
+    Caffe::set_random_seed(solver_->param().random_seed() + rank_);
+  }
+  start_iter_ = solver_->iter();
+  solver_->Step(solver_->param().max_iter() - solver_->iter());
+  Leave();
+}
+
+template<typename Dtype>
+bool HogwildSync<Dtype>::Wait() {
+  Sync* sync = root_->sync_.get();
+  boost::mutex::scoped_lock lock(sync->mutex);
+  if (sync->stop) {
+    return false;
+  }
+  const int generation = sync->generation;
+  if (++sync->arrived == sync->threads) {
+    sync->arrived = 0;
+    ++sync->generation;
+    sync->condition.notify_all();
+    return true;
+  }
+  while (sync->generation == generation && !sync->stop) {
+    sync->condition.wait(lock);
+  }
+  return sync->generation != generation;
+}
+
+template<typename Dtype>
+void HogwildSync<Dtype>::Leave() {
+  Sync* sync = root_->sync_.get();
+  boost::mutex::scoped_lock lock(sync->mutex);
+  --sync->threads;
+  if (sync->arrived > 0 && sync->arrived == sync->threads) {
+    sync->arrived = 0;
+    ++sync->generation;
+    sync->condition.notify_all();
+  }
+}
+
+template<typename Dtype>
+SolverAction::Enum HogwildSync<Dtype>::RequestedAction() {
+  if (stopped_) {
+    return SolverAction::STOP;
+  }
+  Sync* sync = root_->sync_.get();
+  boost::mutex::scoped_lock lock(sync->mutex);
+  return sync->stop ? SolverAction::STOP : SolverAction::NONE;
+}
+
+template<typename Dtype>
+void HogwildSync<Dtype>::on_start() {
+  if (stopped_) {
+    return;
+  }
+  {
+    boost::mutex::scoped_lock lock(root_->sync_->mutex);
+    ++root_->sync_->iters;
+  }
+  // Periodically let all threads catch up, so that none runs more than
+  // hogwild_sync_interval iterations ahead of the others.
+  const int interval = solver_->param().hogwild_sync_interval();
+  const int iters = solver_->iter() - start_iter_;
+  if (interval && iters > 0 && iters % interval == 0 && !Wait()) {
+    stopped_ = true;
+    return;
+  }
+  const int display = solver_->param().display();
+  if (root_ == this && display && solver_->iter() % display == 0 &&
+      iters > 0) {
+    DisplayStats();
+  }
+}
+
+template<typename Dtype>
+void HogwildSync<Dtype>::DisplayStats() {
+  int64_t iters;
+  {
+    boost::mutex::scoped_lock lock(sync_->mutex);
+    iters = sync_->iters;
+  }
+  LOG(INFO) << "    Hogwild: " << Caffe::solver_count() << " threads, "
+      << (iters - display_iters_) / display_timer_.Seconds()
+      << " iter/s in total";
+  display_timer_.Start();
+  display_iters_ = iters;
+}
+
 INSTANTIATE_CLASS(Params);
 INSTANTIATE_CLASS(GPUParams);
 INSTANTIATE_CLASS(P2PSync);
+INSTANTIATE_CLASS(ShmSync);
+INSTANTIATE_CLASS(HogwildSync);
 
 }  // namespace caffe
@@ -37,38 +37,29 @@ void protobuf_AddDesc_caffe_2eproto();
 void protobuf_AssignDesc_caffe_2eproto();
 void protobuf_ShutdownFile_caffe_2eproto();
 
-class BlobShape;
-class BlobProto;
-class BlobProtoVector;
-class Datum;
-class FillerParameter;
-class NetParameter;
-class SolverParameter;
-class SolverState;
-class NetState;
-class NetStateRule;
-class ParamSpec;
-class LayerParameter;
-class DenseBlockParameter;
-class TransformationParameter;
-class LossParameter;
 class AccuracyParameter;
 class ArgMaxParameter;
-class ConcatParameter;
 class BatchNormParameter;
 class BiasParameter;
+class BlobProto;
+class BlobProtoVector;
+class BlobShape;
+class CTCDecoderParameter;
+class CTCLossParameter;
+class ConcatParameter;
 class ContrastiveLossParameter;
 class ConvolutionParameter;
 class CropParameter;
-class CTCDecoderParameter;
-class CTCLossParameter;
 class DataParameter;
+class Datum;
+class DenseBlockParameter;
 class DropoutParameter;
 class DummyDataParameter;
-class EltwiseParameter;
 class ELUParameter;
+class EltwiseParameter;
 class EmbedParameter;
 class ExpParameter;
+class FillerParameter;
 class FlattenParameter;
 class HDF5DataParameter;
 class HDF5OutputParameter;
@@ -78,34 +69,44 @@ class InfogainLossParameter;
 class InnerProductParameter;
 class InputParameter;
 class InterpParameter;
-class LogParameter;
 class LRNParameter;
-class MemoryDataParameter;
+class LSTMParameter;
+class LayerParameter;
+class LogParameter;
+class LossParameter;
 class MVNParameter;
+class MemoryDataParameter;
+class NetParameter;
+class NetState;
+class NetStateRule;
+class PReLUParameter;
+class ParamSpec;
 class ParameterParameter;
 class PoolingParameter;
 class PowerParameter;
 class PythonParameter;
+class ReLUParameter;
 class RecurrentParameter;
-class LSTMParameter;
 class ReductionParameter;
-class ReLUParameter;
 class ReshapeParameter;
 class ReverseParameter;
 class ReverseTimeParameter;
+class SPPParameter;
 class ScaleParameter;
+class ShardDataParameter;
 class SigmoidParameter;
 class SliceParameter;
 class SoftmaxParameter;
+class SolverParameter;
+class SolverState;
 class TanHParameter;
-class TileParameter;
 class ThresholdParameter;
-class WindowDataParameter;
-class SPPParameter;
-class V1LayerParameter;
-class V0LayerParameter;
-class PReLUParameter;
+class TileParameter;
+class TransformationParameter;
 class TransposeParameter;
+class V0LayerParameter;
+class V1LayerParameter;
+class WindowDataParameter;
 
 enum FillerParameter_VarianceNorm {
   FillerParameter_VarianceNorm_FAN_IN = 0,
@@ -643,7 +644,7 @@ inline bool Phase_Parse(
 }
 // ===================================================================
 
-class BlobShape : public ::google::protobuf::Message {
+class BlobShape : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.BlobShape) */ {
  public:
   BlobShape();
   virtual ~BlobShape();
@@ -685,7 +686,11 @@ class BlobShape : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -736,7 +741,7 @@ class BlobShape : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class BlobProto : public ::google::protobuf::Message {
+class BlobProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.BlobProto) */ {
  public:
   BlobProto();
   virtual ~BlobProto();
@@ -778,7 +783,11 @@ class BlobProto : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -923,7 +932,7 @@ class BlobProto : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class BlobProtoVector : public ::google::protobuf::Message {
+class BlobProtoVector : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.BlobProtoVector) */ {
  public:
   BlobProtoVector();
   virtual ~BlobProtoVector();
@@ -965,7 +974,11 @@ class BlobProtoVector : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -994,10 +1007,10 @@ class BlobProtoVector : public ::google::protobuf::Message {
   const ::caffe::BlobProto& blobs(int index) const;
   ::caffe::BlobProto* mutable_blobs(int index);
   ::caffe::BlobProto* add_blobs();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
       mutable_blobs();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+      blobs() const;
 
   // @@protoc_insertion_point(class_scope:caffe.BlobProtoVector)
  private:
@@ -1015,7 +1028,7 @@ class BlobProtoVector : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class Datum : public ::google::protobuf::Message {
+class Datum : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.Datum) */ {
  public:
   Datum();
   virtual ~Datum();
@@ -1057,7 +1070,11 @@ class Datum : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -1175,7 +1192,7 @@ class Datum : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class FillerParameter : public ::google::protobuf::Message {
+class FillerParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.FillerParameter) */ {
  public:
   FillerParameter();
   virtual ~FillerParameter();
@@ -1217,7 +1234,11 @@ class FillerParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -1238,9 +1259,12 @@ class FillerParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef FillerParameter_VarianceNorm VarianceNorm;
-  static const VarianceNorm FAN_IN = FillerParameter_VarianceNorm_FAN_IN;
-  static const VarianceNorm FAN_OUT = FillerParameter_VarianceNorm_FAN_OUT;
-  static const VarianceNorm AVERAGE = FillerParameter_VarianceNorm_AVERAGE;
+  static const VarianceNorm FAN_IN =
+    FillerParameter_VarianceNorm_FAN_IN;
+  static const VarianceNorm FAN_OUT =
+    FillerParameter_VarianceNorm_FAN_OUT;
+  static const VarianceNorm AVERAGE =
+    FillerParameter_VarianceNorm_AVERAGE;
   static inline bool VarianceNorm_IsValid(int value) {
     return FillerParameter_VarianceNorm_IsValid(value);
   }
@@ -1365,7 +1389,7 @@ class FillerParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class NetParameter : public ::google::protobuf::Message {
+class NetParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.NetParameter) */ {
  public:
   NetParameter();
   virtual ~NetParameter();
@@ -1407,7 +1431,11 @@ class NetParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -1464,10 +1492,10 @@ class NetParameter : public ::google::protobuf::Message {
   const ::caffe::BlobShape& input_shape(int index) const;
   ::caffe::BlobShape* mutable_input_shape(int index);
   ::caffe::BlobShape* add_input_shape();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-      input_shape() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
       mutable_input_shape();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
+      input_shape() const;
 
   // repeated int32 input_dim = 4;
   int input_dim_size() const;
@@ -1511,10 +1539,10 @@ class NetParameter : public ::google::protobuf::Message {
   const ::caffe::LayerParameter& layer(int index) const;
   ::caffe::LayerParameter* mutable_layer(int index);
   ::caffe::LayerParameter* add_layer();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >&
-      layer() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >*
       mutable_layer();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >&
+      layer() const;
 
   // repeated .caffe.V1LayerParameter layers = 2;
   int layers_size() const;
@@ -1523,10 +1551,10 @@ class NetParameter : public ::google::protobuf::Message {
   const ::caffe::V1LayerParameter& layers(int index) const;
   ::caffe::V1LayerParameter* mutable_layers(int index);
   ::caffe::V1LayerParameter* add_layers();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >&
-      layers() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >*
       mutable_layers();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >&
+      layers() const;
 
   // @@protoc_insertion_point(class_scope:caffe.NetParameter)
  private:
@@ -1560,7 +1588,7 @@ class NetParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class SolverParameter : public ::google::protobuf::Message {
+class SolverParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.SolverParameter) */ {
  public:
   SolverParameter();
   virtual ~SolverParameter();
@@ -1602,7 +1630,11 @@ class SolverParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -1623,8 +1655,10 @@ class SolverParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef SolverParameter_SnapshotFormat SnapshotFormat;
-  static const SnapshotFormat HDF5 = SolverParameter_SnapshotFormat_HDF5;
-  static const SnapshotFormat BINARYPROTO = SolverParameter_SnapshotFormat_BINARYPROTO;
+  static const SnapshotFormat HDF5 =
+    SolverParameter_SnapshotFormat_HDF5;
+  static const SnapshotFormat BINARYPROTO =
+    SolverParameter_SnapshotFormat_BINARYPROTO;
   static inline bool SnapshotFormat_IsValid(int value) {
     return SolverParameter_SnapshotFormat_IsValid(value);
   }
@@ -1647,8 +1681,10 @@ class SolverParameter : public ::google::protobuf::Message {
   }
 
   typedef SolverParameter_SolverMode SolverMode;
-  static const SolverMode CPU = SolverParameter_SolverMode_CPU;
-  static const SolverMode GPU = SolverParameter_SolverMode_GPU;
+  static const SolverMode CPU =
+    SolverParameter_SolverMode_CPU;
+  static const SolverMode GPU =
+    SolverParameter_SolverMode_GPU;
   static inline bool SolverMode_IsValid(int value) {
     return SolverParameter_SolverMode_IsValid(value);
   }
@@ -1671,12 +1707,18 @@ class SolverParameter : public ::google::protobuf::Message {
   }
 
   typedef SolverParameter_SolverType SolverType;
-  static const SolverType SGD = SolverParameter_SolverType_SGD;
-  static const SolverType NESTEROV = SolverParameter_SolverType_NESTEROV;
-  static const SolverType ADAGRAD = SolverParameter_SolverType_ADAGRAD;
-  static const SolverType RMSPROP = SolverParameter_SolverType_RMSPROP;
-  static const SolverType ADADELTA = SolverParameter_SolverType_ADADELTA;
-  static const SolverType ADAM = SolverParameter_SolverType_ADAM;
+  static const SolverType SGD =
+    SolverParameter_SolverType_SGD;
+  static const SolverType NESTEROV =
+    SolverParameter_SolverType_NESTEROV;
+  static const SolverType ADAGRAD =
+    SolverParameter_SolverType_ADAGRAD;
+  static const SolverType RMSPROP =
+    SolverParameter_SolverType_RMSPROP;
+  static const SolverType ADADELTA =
+    SolverParameter_SolverType_ADADELTA;
+  static const SolverType ADAM =
+    SolverParameter_SolverType_ADAM;
   static inline bool SolverType_IsValid(int value) {
     return SolverParameter_SolverType_IsValid(value);
   }
@@ -1765,10 +1807,10 @@ class SolverParameter : public ::google::protobuf::Message {
   const ::caffe::NetParameter& test_net_param(int index) const;
   ::caffe::NetParameter* mutable_test_net_param(int index);
   ::caffe::NetParameter* add_test_net_param();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >&
-      test_net_param() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >*
       mutable_test_net_param();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >&
+      test_net_param() const;
 
   // optional .caffe.NetState train_state = 26;
   bool has_train_state() const;
@@ -1786,10 +1828,10 @@ class SolverParameter : public ::google::protobuf::Message {
   const ::caffe::NetState& test_state(int index) const;
   ::caffe::NetState* mutable_test_state(int index);
   ::caffe::NetState* add_test_state();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::NetState >&
-      test_state() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::NetState >*
       mutable_test_state();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::NetState >&
+      test_state() const;
 
   // repeated int32 test_iter = 3;
   int test_iter_size() const;
@@ -1824,6 +1866,20 @@ class SolverParameter : public ::google::protobuf::Message {
   bool test_initialization() const;
   void set_test_initialization(bool value);
 
+  // optional bool test_async = 44 [default = false];
+  bool has_test_async() const;
+  void clear_test_async();
+  static const int kTestAsyncFieldNumber = 44;
+  bool test_async() const;
+  void set_test_async(bool value);
+
+  // optional int32 test_threads = 45 [default = 1];
+  bool has_test_threads() const;
+  void clear_test_threads();
+  static const int kTestThreadsFieldNumber = 45;
+  ::google::protobuf::int32 test_threads() const;
+  void set_test_threads(::google::protobuf::int32 value);
+
   // optional float base_lr = 5;
   bool has_base_lr() const;
   void clear_base_lr();
@@ -1970,6 +2026,13 @@ class SolverParameter : public ::google::protobuf::Message {
   ::caffe::SolverParameter_SnapshotFormat snapshot_format() const;
   void set_snapshot_format(::caffe::SolverParameter_SnapshotFormat value);
 
+  // optional bool snapshot_async = 43 [default = false];
+  bool has_snapshot_async() const;
+  void clear_snapshot_async();
+  static const int kSnapshotAsyncFieldNumber = 43;
+  bool snapshot_async() const;
+  void set_snapshot_async(bool value);
+
   // optional .caffe.SolverParameter.SolverMode solver_mode = 17 [default = GPU];
   bool has_solver_mode() const;
   void clear_solver_mode();
@@ -2003,7 +2066,7 @@ class SolverParameter : public ::google::protobuf::Message {
   ::std::string* release_type();
   void set_allocated_type(::std::string* type);
 
-  // optional float delta = 31 [default = 1e-008];
+  // optional float delta = 31 [default = 1e-08];
   bool has_delta() const;
   void clear_delta();
   static const int kDeltaFieldNumber = 31;
@@ -2045,6 +2108,32 @@ class SolverParameter : public ::google::protobuf::Message {
   ::caffe::SolverParameter_SolverType solver_type() const;
   void set_solver_type(::caffe::SolverParameter_SolverType value);
 
+  // optional string data_stats_file = 41;
+  bool has_data_stats_file() const;
+  void clear_data_stats_file();
+  static const int kDataStatsFileFieldNumber = 41;
+  const ::std::string& data_stats_file() const;
+  void set_data_stats_file(const ::std::string& value);
+  void set_data_stats_file(const char* value);
+  void set_data_stats_file(const char* value, size_t size);
+  ::std::string* mutable_data_stats_file();
+  ::std::string* release_data_stats_file();
+  void set_allocated_data_stats_file(::std::string* data_stats_file);
+
+  // optional bool flat_params = 42 [default = false];
+  bool has_flat_params() const;
+  void clear_flat_params();
+  static const int kFlatParamsFieldNumber = 42;
+  bool flat_params() const;
+  void set_flat_params(bool value);
+
+  // optional int32 hogwild_sync_interval = 46 [default = 0];
+  bool has_hogwild_sync_interval() const;
+  void clear_hogwild_sync_interval();
+  static const int kHogwildSyncIntervalFieldNumber = 46;
+  ::google::protobuf::int32 hogwild_sync_interval() const;
+  void set_hogwild_sync_interval(::google::protobuf::int32 value);
+
   // @@protoc_insertion_point(class_scope:caffe.SolverParameter)
  private:
   inline void set_has_net();
@@ -2063,6 +2152,10 @@ class SolverParameter : public ::google::protobuf::Message {
   inline void clear_has_test_compute_loss();
   inline void set_has_test_initialization();
   inline void clear_has_test_initialization();
+  inline void set_has_test_async();
+  inline void clear_has_test_async();
+  inline void set_has_test_threads();
+  inline void clear_has_test_threads();
   inline void set_has_base_lr();
   inline void clear_has_base_lr();
   inline void set_has_display();
@@ -2097,6 +2190,8 @@ class SolverParameter : public ::google::protobuf::Message {
   inline void clear_has_snapshot_diff();
   inline void set_has_snapshot_format();
   inline void clear_has_snapshot_format();
+  inline void set_has_snapshot_async();
+  inline void clear_has_snapshot_async();
   inline void set_has_solver_mode();
   inline void clear_has_solver_mode();
   inline void set_has_device_id();
@@ -2117,6 +2212,12 @@ class SolverParameter : public ::google::protobuf::Message {
   inline void clear_has_snapshot_after_train();
   inline void set_has_solver_type();
   inline void clear_has_solver_type();
+  inline void set_has_data_stats_file();
+  inline void clear_has_data_stats_file();
+  inline void set_has_flat_params();
+  inline void clear_has_flat_params();
+  inline void set_has_hogwild_sync_interval();
+  inline void clear_has_hogwild_sync_interval();
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::uint32 _has_bits_[2];
@@ -2130,8 +2231,13 @@ class SolverParameter : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedPtrField< ::caffe::NetState > test_state_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > test_iter_;
   ::google::protobuf::int32 test_interval_;
+  ::google::protobuf::int32 test_threads_;
   float base_lr_;
   ::google::protobuf::int32 display_;
+  bool test_compute_loss_;
+  bool test_initialization_;
+  bool test_async_;
+  bool snapshot_diff_;
   ::google::protobuf::int32 average_loss_;
   ::google::protobuf::int32 max_iter_;
   ::google::protobuf::int32 iter_size_;
@@ -2140,28 +2246,29 @@ class SolverParameter : public ::google::protobuf::Message {
   float power_;
   float momentum_;
   float weight_decay_;
-  bool test_compute_loss_;
-  bool test_initialization_;
-  bool snapshot_diff_;
-  bool debug_info_;
-  ::google::protobuf::int32 stepsize_;
   static ::std::string* _default_regularization_type_;
   ::google::protobuf::internal::ArenaStringPtr regularization_type_;
   ::google::protobuf::RepeatedField< ::google::protobuf::int32 > stepvalue_;
+  ::google::protobuf::int32 stepsize_;
   float clip_gradients_;
-  ::google::protobuf::int32 snapshot_;
   ::google::protobuf::internal::ArenaStringPtr snapshot_prefix_;
+  ::google::protobuf::int32 snapshot_;
   int snapshot_format_;
   int solver_mode_;
-  ::google::protobuf::int64 random_seed_;
   ::google::protobuf::int32 device_id_;
-  float delta_;
+  ::google::protobuf::int64 random_seed_;
   static ::std::string* _default_type_;
   ::google::protobuf::internal::ArenaStringPtr type_;
+  float delta_;
   float momentum2_;
   float rms_decay_;
+  bool snapshot_async_;
+  bool debug_info_;
   bool snapshot_after_train_;
+  bool flat_params_;
+  ::google::protobuf::internal::ArenaStringPtr data_stats_file_;
   int solver_type_;
+  ::google::protobuf::int32 hogwild_sync_interval_;
   mutable int _cached_size_;
   friend void  protobuf_AddDesc_caffe_2eproto();
   friend void protobuf_AssignDesc_caffe_2eproto();
@@ -2172,7 +2279,7 @@ class SolverParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class SolverState : public ::google::protobuf::Message {
+class SolverState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.SolverState) */ {
  public:
   SolverState();
   virtual ~SolverState();
@@ -2214,7 +2321,11 @@ class SolverState : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -2262,10 +2373,10 @@ class SolverState : public ::google::protobuf::Message {
   const ::caffe::BlobProto& history(int index) const;
   ::caffe::BlobProto* mutable_history(int index);
   ::caffe::BlobProto* add_history();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      history() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
       mutable_history();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+      history() const;
 
   // optional int32 current_step = 4 [default = 0];
   bool has_current_step() const;
@@ -2299,7 +2410,7 @@ class SolverState : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class NetState : public ::google::protobuf::Message {
+class NetState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.NetState) */ {
  public:
   NetState();
   virtual ~NetState();
@@ -2341,7 +2452,11 @@ class NetState : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -2415,7 +2530,7 @@ class NetState : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class NetStateRule : public ::google::protobuf::Message {
+class NetStateRule : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.NetStateRule) */ {
  public:
   NetStateRule();
   virtual ~NetStateRule();
@@ -2457,7 +2572,11 @@ class NetStateRule : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -2558,7 +2677,7 @@ class NetStateRule : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ParamSpec : public ::google::protobuf::Message {
+class ParamSpec : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ParamSpec) */ {
  public:
   ParamSpec();
   virtual ~ParamSpec();
@@ -2600,7 +2719,11 @@ class ParamSpec : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -2621,8 +2744,10 @@ class ParamSpec : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef ParamSpec_DimCheckMode DimCheckMode;
-  static const DimCheckMode STRICT = ParamSpec_DimCheckMode_STRICT;
-  static const DimCheckMode PERMISSIVE = ParamSpec_DimCheckMode_PERMISSIVE;
+  static const DimCheckMode STRICT =
+    ParamSpec_DimCheckMode_STRICT;
+  static const DimCheckMode PERMISSIVE =
+    ParamSpec_DimCheckMode_PERMISSIVE;
   static inline bool DimCheckMode_IsValid(int value) {
     return ParamSpec_DimCheckMode_IsValid(value);
   }
@@ -2706,7 +2831,7 @@ class ParamSpec : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class LayerParameter : public ::google::protobuf::Message {
+class LayerParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.LayerParameter) */ {
  public:
   LayerParameter();
   virtual ~LayerParameter();
@@ -2748,7 +2873,11 @@ class LayerParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -2852,10 +2981,10 @@ class LayerParameter : public ::google::protobuf::Message {
   const ::caffe::ParamSpec& param(int index) const;
   ::caffe::ParamSpec* mutable_param(int index);
   ::caffe::ParamSpec* add_param();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >&
-      param() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >*
       mutable_param();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >&
+      param() const;
 
   // repeated .caffe.BlobProto blobs = 7;
   int blobs_size() const;
@@ -2864,10 +2993,10 @@ class LayerParameter : public ::google::protobuf::Message {
   const ::caffe::BlobProto& blobs(int index) const;
   ::caffe::BlobProto* mutable_blobs(int index);
   ::caffe::BlobProto* add_blobs();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
       mutable_blobs();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+      blobs() const;
 
   // repeated bool propagate_down = 11;
   int propagate_down_size() const;
@@ -2888,10 +3017,10 @@ class LayerParameter : public ::google::protobuf::Message {
   const ::caffe::NetStateRule& include(int index) const;
   ::caffe::NetStateRule* mutable_include(int index);
   ::caffe::NetStateRule* add_include();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      include() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
       mutable_include();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+      include() const;
 
   // repeated .caffe.NetStateRule exclude = 9;
   int exclude_size() const;
@@ -2900,10 +3029,10 @@ class LayerParameter : public ::google::protobuf::Message {
   const ::caffe::NetStateRule& exclude(int index) const;
   ::caffe::NetStateRule* mutable_exclude(int index);
   ::caffe::NetStateRule* add_exclude();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      exclude() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
       mutable_exclude();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+      exclude() const;
 
   // optional .caffe.TransformationParameter transform_param = 100;
   bool has_transform_param() const;
@@ -3382,6 +3511,15 @@ class LayerParameter : public ::google::protobuf::Message {
   ::caffe::InterpParameter* release_interp_param();
   void set_allocated_interp_param(::caffe::InterpParameter* interp_param);
 
+  // optional .caffe.ShardDataParameter shard_data_param = 163;
+  bool has_shard_data_param() const;
+  void clear_shard_data_param();
+  static const int kShardDataParamFieldNumber = 163;
+  const ::caffe::ShardDataParameter& shard_data_param() const;
+  ::caffe::ShardDataParameter* mutable_shard_data_param();
+  ::caffe::ShardDataParameter* release_shard_data_param();
+  void set_allocated_shard_data_param(::caffe::ShardDataParameter* shard_data_param);
+
   // optional .caffe.TransposeParameter transpose_param = 8266710;
   bool has_transpose_param() const;
   void clear_transpose_param();
@@ -3514,6 +3652,8 @@ class LayerParameter : public ::google::protobuf::Message {
   inline void clear_has_reverse_time_param();
   inline void set_has_interp_param();
   inline void clear_has_interp_param();
+  inline void set_has_shard_data_param();
+  inline void clear_has_shard_data_param();
   inline void set_has_transpose_param();
   inline void clear_has_transpose_param();
   inline void set_has_lstm_param();
@@ -3585,6 +3725,7 @@ class LayerParameter : public ::google::protobuf::Message {
   ::caffe::ReverseParameter* reverse_param_;
   ::caffe::ReverseTimeParameter* reverse_time_param_;
   ::caffe::InterpParameter* interp_param_;
+  ::caffe::ShardDataParameter* shard_data_param_;
   ::caffe::TransposeParameter* transpose_param_;
   ::caffe::LSTMParameter* lstm_param_;
   int phase_;
@@ -3597,7 +3738,7 @@ class LayerParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class DenseBlockParameter : public ::google::protobuf::Message {
+class DenseBlockParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.DenseBlockParameter) */ {
  public:
   DenseBlockParameter();
   virtual ~DenseBlockParameter();
@@ -3639,7 +3780,11 @@ class DenseBlockParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -3872,7 +4017,7 @@ class DenseBlockParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class TransformationParameter : public ::google::protobuf::Message {
+class TransformationParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.TransformationParameter) */ {
  public:
   TransformationParameter();
   virtual ~TransformationParameter();
@@ -3914,7 +4059,11 @@ class TransformationParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4035,6 +4184,27 @@ class TransformationParameter : public ::google::protobuf::Message {
   ::google::protobuf::uint32 crop_height() const;
   void set_crop_height(::google::protobuf::uint32 value);
 
+  // optional uint32 decode_height = 13 [default = 0];
+  bool has_decode_height() const;
+  void clear_decode_height();
+  static const int kDecodeHeightFieldNumber = 13;
+  ::google::protobuf::uint32 decode_height() const;
+  void set_decode_height(::google::protobuf::uint32 value);
+
+  // optional int32 decode_width = 14 [default = 0];
+  bool has_decode_width() const;
+  void clear_decode_width();
+  static const int kDecodeWidthFieldNumber = 14;
+  ::google::protobuf::int32 decode_width() const;
+  void set_decode_width(::google::protobuf::int32 value);
+
+  // optional bool reduced_decode = 15 [default = false];
+  bool has_reduced_decode() const;
+  void clear_reduced_decode();
+  static const int kReducedDecodeFieldNumber = 15;
+  bool reduced_decode() const;
+  void set_reduced_decode(bool value);
+
   // @@protoc_insertion_point(class_scope:caffe.TransformationParameter)
  private:
   inline void set_has_scale();
@@ -4057,6 +4227,12 @@ class TransformationParameter : public ::google::protobuf::Message {
   inline void clear_has_crop_width();
   inline void set_has_crop_height();
   inline void clear_has_crop_height();
+  inline void set_has_decode_height();
+  inline void clear_has_decode_height();
+  inline void set_has_decode_width();
+  inline void clear_has_decode_width();
+  inline void set_has_reduced_decode();
+  inline void clear_has_reduced_decode();
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::uint32 _has_bits_[1];
@@ -4073,6 +4249,9 @@ class TransformationParameter : public ::google::protobuf::Message {
   ::google::protobuf::RepeatedField< float > scale_factors_;
   ::google::protobuf::uint32 crop_width_;
   ::google::protobuf::uint32 crop_height_;
+  ::google::protobuf::uint32 decode_height_;
+  ::google::protobuf::int32 decode_width_;
+  bool reduced_decode_;
   friend void  protobuf_AddDesc_caffe_2eproto();
   friend void protobuf_AssignDesc_caffe_2eproto();
   friend void protobuf_ShutdownFile_caffe_2eproto();
@@ -4082,7 +4261,7 @@ class TransformationParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class LossParameter : public ::google::protobuf::Message {
+class LossParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.LossParameter) */ {
  public:
   LossParameter();
   virtual ~LossParameter();
@@ -4124,7 +4303,11 @@ class LossParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4145,10 +4328,14 @@ class LossParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef LossParameter_NormalizationMode NormalizationMode;
-  static const NormalizationMode FULL = LossParameter_NormalizationMode_FULL;
-  static const NormalizationMode VALID = LossParameter_NormalizationMode_VALID;
-  static const NormalizationMode BATCH_SIZE = LossParameter_NormalizationMode_BATCH_SIZE;
-  static const NormalizationMode NONE = LossParameter_NormalizationMode_NONE;
+  static const NormalizationMode FULL =
+    LossParameter_NormalizationMode_FULL;
+  static const NormalizationMode VALID =
+    LossParameter_NormalizationMode_VALID;
+  static const NormalizationMode BATCH_SIZE =
+    LossParameter_NormalizationMode_BATCH_SIZE;
+  static const NormalizationMode NONE =
+    LossParameter_NormalizationMode_NONE;
   static inline bool NormalizationMode_IsValid(int value) {
     return LossParameter_NormalizationMode_IsValid(value);
   }
@@ -4217,7 +4404,7 @@ class LossParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class AccuracyParameter : public ::google::protobuf::Message {
+class AccuracyParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.AccuracyParameter) */ {
  public:
   AccuracyParameter();
   virtual ~AccuracyParameter();
@@ -4259,7 +4446,11 @@ class AccuracyParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4326,7 +4517,7 @@ class AccuracyParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ArgMaxParameter : public ::google::protobuf::Message {
+class ArgMaxParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ArgMaxParameter) */ {
  public:
   ArgMaxParameter();
   virtual ~ArgMaxParameter();
@@ -4368,7 +4559,11 @@ class ArgMaxParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4435,7 +4630,7 @@ class ArgMaxParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ConcatParameter : public ::google::protobuf::Message {
+class ConcatParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ConcatParameter) */ {
  public:
   ConcatParameter();
   virtual ~ConcatParameter();
@@ -4477,7 +4672,11 @@ class ConcatParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4534,7 +4733,7 @@ class ConcatParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class BatchNormParameter : public ::google::protobuf::Message {
+class BatchNormParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.BatchNormParameter) */ {
  public:
   BatchNormParameter();
   virtual ~BatchNormParameter();
@@ -4576,7 +4775,11 @@ class BatchNormParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4612,7 +4815,7 @@ class BatchNormParameter : public ::google::protobuf::Message {
   float moving_average_fraction() const;
   void set_moving_average_fraction(float value);
 
-  // optional float eps = 3 [default = 1e-005];
+  // optional float eps = 3 [default = 1e-05];
   bool has_eps() const;
   void clear_eps();
   static const int kEpsFieldNumber = 3;
@@ -4653,7 +4856,7 @@ class BatchNormParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class BiasParameter : public ::google::protobuf::Message {
+class BiasParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.BiasParameter) */ {
  public:
   BiasParameter();
   virtual ~BiasParameter();
@@ -4695,7 +4898,11 @@ class BiasParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4764,7 +4971,7 @@ class BiasParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ContrastiveLossParameter : public ::google::protobuf::Message {
+class ContrastiveLossParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ContrastiveLossParameter) */ {
  public:
   ContrastiveLossParameter();
   virtual ~ContrastiveLossParameter();
@@ -4806,7 +5013,11 @@ class ContrastiveLossParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4863,7 +5074,7 @@ class ContrastiveLossParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ConvolutionParameter : public ::google::protobuf::Message {
+class ConvolutionParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ConvolutionParameter) */ {
  public:
   ConvolutionParameter();
   virtual ~ConvolutionParameter();
@@ -4905,7 +5116,11 @@ class ConvolutionParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -4926,9 +5141,12 @@ class ConvolutionParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef ConvolutionParameter_Engine Engine;
-  static const Engine DEFAULT = ConvolutionParameter_Engine_DEFAULT;
-  static const Engine CAFFE = ConvolutionParameter_Engine_CAFFE;
-  static const Engine CUDNN = ConvolutionParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    ConvolutionParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    ConvolutionParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    ConvolutionParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return ConvolutionParameter_Engine_IsValid(value);
   }
@@ -5102,6 +5320,13 @@ class ConvolutionParameter : public ::google::protobuf::Message {
   bool force_nd_im2col() const;
   void set_force_nd_im2col(bool value);
 
+  // optional bool fused_relu = 19 [default = false];
+  bool has_fused_relu() const;
+  void clear_fused_relu();
+  static const int kFusedReluFieldNumber = 19;
+  bool fused_relu() const;
+  void set_fused_relu(bool value);
+
   // @@protoc_insertion_point(class_scope:caffe.ConvolutionParameter)
  private:
   inline void set_has_num_output();
@@ -5132,6 +5357,8 @@ class ConvolutionParameter : public ::google::protobuf::Message {
   inline void clear_has_axis();
   inline void set_has_force_nd_im2col();
   inline void clear_has_force_nd_im2col();
+  inline void set_has_fused_relu();
+  inline void clear_has_fused_relu();
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::uint32 _has_bits_[1];
@@ -5145,13 +5372,14 @@ class ConvolutionParameter : public ::google::protobuf::Message {
   ::google::protobuf::uint32 pad_w_;
   ::google::protobuf::uint32 kernel_h_;
   ::google::protobuf::uint32 kernel_w_;
-  bool bias_term_;
-  bool force_nd_im2col_;
   ::google::protobuf::uint32 stride_h_;
   ::google::protobuf::uint32 stride_w_;
-  ::caffe::FillerParameter* weight_filler_;
   ::google::protobuf::uint32 group_;
+  bool bias_term_;
+  bool force_nd_im2col_;
+  bool fused_relu_;
   int engine_;
+  ::caffe::FillerParameter* weight_filler_;
   ::caffe::FillerParameter* bias_filler_;
   ::google::protobuf::int32 axis_;
   friend void  protobuf_AddDesc_caffe_2eproto();
@@ -5163,7 +5391,7 @@ class ConvolutionParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class CropParameter : public ::google::protobuf::Message {
+class CropParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.CropParameter) */ {
  public:
   CropParameter();
   virtual ~CropParameter();
@@ -5205,7 +5433,11 @@ class CropParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -5265,7 +5497,7 @@ class CropParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class CTCDecoderParameter : public ::google::protobuf::Message {
+class CTCDecoderParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.CTCDecoderParameter) */ {
  public:
   CTCDecoderParameter();
   virtual ~CTCDecoderParameter();
@@ -5307,7 +5539,11 @@ class CTCDecoderParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -5364,7 +5600,7 @@ class CTCDecoderParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class CTCLossParameter : public ::google::protobuf::Message {
+class CTCLossParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.CTCLossParameter) */ {
  public:
   CTCLossParameter();
   virtual ~CTCLossParameter();
@@ -5406,7 +5642,11 @@ class CTCLossParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -5463,6 +5703,13 @@ class CTCLossParameter : public ::google::protobuf::Message {
   ::google::protobuf::int32 loss_calculation_t() const;
   void set_loss_calculation_t(::google::protobuf::int32 value);
 
+  // optional uint32 input_stride = 6 [default = 0];
+  bool has_input_stride() const;
+  void clear_input_stride();
+  static const int kInputStrideFieldNumber = 6;
+  ::google::protobuf::uint32 input_stride() const;
+  void set_input_stride(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:caffe.CTCLossParameter)
  private:
   inline void set_has_output_delay();
@@ -5475,6 +5722,8 @@ class CTCLossParameter : public ::google::protobuf::Message {
   inline void clear_has_ctc_merge_repeated();
   inline void set_has_loss_calculation_t();
   inline void clear_has_loss_calculation_t();
+  inline void set_has_input_stride();
+  inline void clear_has_input_stride();
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::uint32 _has_bits_[1];
@@ -5484,6 +5733,7 @@ class CTCLossParameter : public ::google::protobuf::Message {
   bool preprocess_collapse_repeated_;
   bool ctc_merge_repeated_;
   ::google::protobuf::int32 loss_calculation_t_;
+  ::google::protobuf::uint32 input_stride_;
   friend void  protobuf_AddDesc_caffe_2eproto();
   friend void protobuf_AssignDesc_caffe_2eproto();
   friend void protobuf_ShutdownFile_caffe_2eproto();
@@ -5493,7 +5743,7 @@ class CTCLossParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class DataParameter : public ::google::protobuf::Message {
+class DataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.DataParameter) */ {
  public:
   DataParameter();
   virtual ~DataParameter();
@@ -5535,7 +5785,11 @@ class DataParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -5556,8 +5810,10 @@ class DataParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef DataParameter_DB DB;
-  static const DB LEVELDB = DataParameter_DB_LEVELDB;
-  static const DB LMDB = DataParameter_DB_LMDB;
+  static const DB LEVELDB =
+    DataParameter_DB_LEVELDB;
+  static const DB LMDB =
+    DataParameter_DB_LMDB;
   static inline bool DB_IsValid(int value) {
     return DataParameter_DB_IsValid(value);
   }
@@ -5668,6 +5924,93 @@ class DataParameter : public ::google::protobuf::Message {
   ::google::protobuf::uint32 task_class_num() const;
   void set_task_class_num(::google::protobuf::uint32 value);
 
+  // optional uint32 num_workers = 12 [default = 1];
+  bool has_num_workers() const;
+  void clear_num_workers();
+  static const int kNumWorkersFieldNumber = 12;
+  ::google::protobuf::uint32 num_workers() const;
+  void set_num_workers(::google::protobuf::uint32 value);
+
+  // repeated uint32 bucket_width = 13;
+  int bucket_width_size() const;
+  void clear_bucket_width();
+  static const int kBucketWidthFieldNumber = 13;
+  ::google::protobuf::uint32 bucket_width(int index) const;
+  void set_bucket_width(int index, ::google::protobuf::uint32 value);
+  void add_bucket_width(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      bucket_width() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_bucket_width();
+
+  // optional uint32 bucket_window = 14 [default = 512];
+  bool has_bucket_window() const;
+  void clear_bucket_window();
+  static const int kBucketWindowFieldNumber = 14;
+  ::google::protobuf::uint32 bucket_window() const;
+  void set_bucket_window(::google::protobuf::uint32 value);
+
+  // optional float bucket_pad_value = 15 [default = 0];
+  bool has_bucket_pad_value() const;
+  void clear_bucket_pad_value();
+  static const int kBucketPadValueFieldNumber = 15;
+  float bucket_pad_value() const;
+  void set_bucket_pad_value(float value);
+
+  // optional bool shuffle = 16 [default = false];
+  bool has_shuffle() const;
+  void clear_shuffle();
+  static const int kShuffleFieldNumber = 16;
+  bool shuffle() const;
+  void set_shuffle(bool value);
+
+  // optional string key_index = 17;
+  bool has_key_index() const;
+  void clear_key_index();
+  static const int kKeyIndexFieldNumber = 17;
+  const ::std::string& key_index() const;
+  void set_key_index(const ::std::string& value);
+  void set_key_index(const char* value);
+  void set_key_index(const char* value, size_t size);
+  ::std::string* mutable_key_index();
+  ::std::string* release_key_index();
+  void set_allocated_key_index(::std::string* key_index);
+
+  // optional uint32 shuffle_buffer = 18 [default = 0];
+  bool has_shuffle_buffer() const;
+  void clear_shuffle_buffer();
+  static const int kShuffleBufferFieldNumber = 18;
+  ::google::protobuf::uint32 shuffle_buffer() const;
+  void set_shuffle_buffer(::google::protobuf::uint32 value);
+
+  // optional uint64 sample_cache_bytes = 19 [default = 0];
+  bool has_sample_cache_bytes() const;
+  void clear_sample_cache_bytes();
+  static const int kSampleCacheBytesFieldNumber = 19;
+  ::google::protobuf::uint64 sample_cache_bytes() const;
+  void set_sample_cache_bytes(::google::protobuf::uint64 value);
+
+  // optional bool sample_cache_compress = 20 [default = false];
+  bool has_sample_cache_compress() const;
+  void clear_sample_cache_compress();
+  static const int kSampleCacheCompressFieldNumber = 20;
+  bool sample_cache_compress() const;
+  void set_sample_cache_compress(bool value);
+
+  // optional bool adaptive_prefetch = 21 [default = false];
+  bool has_adaptive_prefetch() const;
+  void clear_adaptive_prefetch();
+  static const int kAdaptivePrefetchFieldNumber = 21;
+  bool adaptive_prefetch() const;
+  void set_adaptive_prefetch(bool value);
+
+  // optional uint64 prefetch_max_bytes = 22 [default = 1073741824];
+  bool has_prefetch_max_bytes() const;
+  void clear_prefetch_max_bytes();
+  static const int kPrefetchMaxBytesFieldNumber = 22;
+  ::google::protobuf::uint64 prefetch_max_bytes() const;
+  void set_prefetch_max_bytes(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:caffe.DataParameter)
  private:
   inline void set_has_source();
@@ -5692,6 +6035,26 @@ class DataParameter : public ::google::protobuf::Message {
   inline void clear_has_prefetch();
   inline void set_has_task_class_num();
   inline void clear_has_task_class_num();
+  inline void set_has_num_workers();
+  inline void clear_has_num_workers();
+  inline void set_has_bucket_window();
+  inline void clear_has_bucket_window();
+  inline void set_has_bucket_pad_value();
+  inline void clear_has_bucket_pad_value();
+  inline void set_has_shuffle();
+  inline void clear_has_shuffle();
+  inline void set_has_key_index();
+  inline void clear_has_key_index();
+  inline void set_has_shuffle_buffer();
+  inline void clear_has_shuffle_buffer();
+  inline void set_has_sample_cache_bytes();
+  inline void clear_has_sample_cache_bytes();
+  inline void set_has_sample_cache_compress();
+  inline void clear_has_sample_cache_compress();
+  inline void set_has_adaptive_prefetch();
+  inline void clear_has_adaptive_prefetch();
+  inline void set_has_prefetch_max_bytes();
+  inline void clear_has_prefetch_max_bytes();
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::uint32 _has_bits_[1];
@@ -5703,10 +6066,21 @@ class DataParameter : public ::google::protobuf::Message {
   float scale_;
   ::google::protobuf::internal::ArenaStringPtr mean_file_;
   ::google::protobuf::uint32 crop_size_;
-  bool mirror_;
-  bool force_encoded_color_;
   ::google::protobuf::uint32 prefetch_;
   ::google::protobuf::uint32 task_class_num_;
+  ::google::protobuf::uint32 num_workers_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > bucket_width_;
+  bool mirror_;
+  bool force_encoded_color_;
+  bool shuffle_;
+  bool sample_cache_compress_;
+  ::google::protobuf::uint32 bucket_window_;
+  float bucket_pad_value_;
+  ::google::protobuf::uint32 shuffle_buffer_;
+  ::google::protobuf::internal::ArenaStringPtr key_index_;
+  ::google::protobuf::uint64 sample_cache_bytes_;
+  ::google::protobuf::uint64 prefetch_max_bytes_;
+  bool adaptive_prefetch_;
   friend void  protobuf_AddDesc_caffe_2eproto();
   friend void protobuf_AssignDesc_caffe_2eproto();
   friend void protobuf_ShutdownFile_caffe_2eproto();
@@ -5716,7 +6090,7 @@ class DataParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class DropoutParameter : public ::google::protobuf::Message {
+class DropoutParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.DropoutParameter) */ {
  public:
   DropoutParameter();
   virtual ~DropoutParameter();
@@ -5758,7 +6132,11 @@ class DropoutParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -5805,7 +6183,7 @@ class DropoutParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class DummyDataParameter : public ::google::protobuf::Message {
+class DummyDataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.DummyDataParameter) */ {
  public:
   DummyDataParameter();
   virtual ~DummyDataParameter();
@@ -5847,7 +6225,11 @@ class DummyDataParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -5876,10 +6258,10 @@ class DummyDataParameter : public ::google::protobuf::Message {
   const ::caffe::FillerParameter& data_filler(int index) const;
   ::caffe::FillerParameter* mutable_data_filler(int index);
   ::caffe::FillerParameter* add_data_filler();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >&
-      data_filler() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >*
       mutable_data_filler();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >&
+      data_filler() const;
 
   // repeated .caffe.BlobShape shape = 6;
   int shape_size() const;
@@ -5888,10 +6270,10 @@ class DummyDataParameter : public ::google::protobuf::Message {
   const ::caffe::BlobShape& shape(int index) const;
   ::caffe::BlobShape* mutable_shape(int index);
   ::caffe::BlobShape* add_shape();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-      shape() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
       mutable_shape();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
+      shape() const;
 
   // repeated uint32 num = 2;
   int num_size() const;
@@ -5962,7 +6344,7 @@ class DummyDataParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class EltwiseParameter : public ::google::protobuf::Message {
+class EltwiseParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.EltwiseParameter) */ {
  public:
   EltwiseParameter();
   virtual ~EltwiseParameter();
@@ -6004,7 +6386,11 @@ class EltwiseParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6025,9 +6411,12 @@ class EltwiseParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef EltwiseParameter_EltwiseOp EltwiseOp;
-  static const EltwiseOp PROD = EltwiseParameter_EltwiseOp_PROD;
-  static const EltwiseOp SUM = EltwiseParameter_EltwiseOp_SUM;
-  static const EltwiseOp MAX = EltwiseParameter_EltwiseOp_MAX;
+  static const EltwiseOp PROD =
+    EltwiseParameter_EltwiseOp_PROD;
+  static const EltwiseOp SUM =
+    EltwiseParameter_EltwiseOp_SUM;
+  static const EltwiseOp MAX =
+    EltwiseParameter_EltwiseOp_MAX;
   static inline bool EltwiseOp_IsValid(int value) {
     return EltwiseParameter_EltwiseOp_IsValid(value);
   }
@@ -6099,7 +6488,7 @@ class EltwiseParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ELUParameter : public ::google::protobuf::Message {
+class ELUParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ELUParameter) */ {
  public:
   ELUParameter();
   virtual ~ELUParameter();
@@ -6141,7 +6530,11 @@ class ELUParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6188,7 +6581,7 @@ class ELUParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class EmbedParameter : public ::google::protobuf::Message {
+class EmbedParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.EmbedParameter) */ {
  public:
   EmbedParameter();
   virtual ~EmbedParameter();
@@ -6230,7 +6623,11 @@ class EmbedParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6321,7 +6718,7 @@ class EmbedParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ExpParameter : public ::google::protobuf::Message {
+class ExpParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ExpParameter) */ {
  public:
   ExpParameter();
   virtual ~ExpParameter();
@@ -6363,7 +6760,11 @@ class ExpParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6430,7 +6831,7 @@ class ExpParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class FlattenParameter : public ::google::protobuf::Message {
+class FlattenParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.FlattenParameter) */ {
  public:
   FlattenParameter();
   virtual ~FlattenParameter();
@@ -6472,7 +6873,11 @@ class FlattenParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6529,7 +6934,7 @@ class FlattenParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class HDF5DataParameter : public ::google::protobuf::Message {
+class HDF5DataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.HDF5DataParameter) */ {
  public:
   HDF5DataParameter();
   virtual ~HDF5DataParameter();
@@ -6571,7 +6976,11 @@ class HDF5DataParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6643,7 +7052,7 @@ class HDF5DataParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class HDF5OutputParameter : public ::google::protobuf::Message {
+class HDF5OutputParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.HDF5OutputParameter) */ {
  public:
   HDF5OutputParameter();
   virtual ~HDF5OutputParameter();
@@ -6685,7 +7094,11 @@ class HDF5OutputParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6737,7 +7150,7 @@ class HDF5OutputParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class HingeLossParameter : public ::google::protobuf::Message {
+class HingeLossParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.HingeLossParameter) */ {
  public:
   HingeLossParameter();
   virtual ~HingeLossParameter();
@@ -6779,7 +7192,11 @@ class HingeLossParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -6800,8 +7217,10 @@ class HingeLossParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef HingeLossParameter_Norm Norm;
-  static const Norm L1 = HingeLossParameter_Norm_L1;
-  static const Norm L2 = HingeLossParameter_Norm_L2;
+  static const Norm L1 =
+    HingeLossParameter_Norm_L1;
+  static const Norm L2 =
+    HingeLossParameter_Norm_L2;
   static inline bool Norm_IsValid(int value) {
     return HingeLossParameter_Norm_IsValid(value);
   }
@@ -6850,7 +7269,7 @@ class HingeLossParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ImageDataParameter : public ::google::protobuf::Message {
+class ImageDataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ImageDataParameter) */ {
  public:
   ImageDataParameter();
   virtual ~ImageDataParameter();
@@ -6892,7 +7311,11 @@ class ImageDataParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7027,6 +7450,25 @@ class ImageDataParameter : public ::google::protobuf::Message {
   bool regression() const;
   void set_regression(bool value);
 
+  // optional bool reduced_decode = 15 [default = false];
+  bool has_reduced_decode() const;
+  void clear_reduced_decode();
+  static const int kReducedDecodeFieldNumber = 15;
+  bool reduced_decode() const;
+  void set_reduced_decode(bool value);
+
+  // optional string list_index = 16;
+  bool has_list_index() const;
+  void clear_list_index();
+  static const int kListIndexFieldNumber = 16;
+  const ::std::string& list_index() const;
+  void set_list_index(const ::std::string& value);
+  void set_list_index(const char* value);
+  void set_list_index(const char* value, size_t size);
+  ::std::string* mutable_list_index();
+  ::std::string* release_list_index();
+  void set_allocated_list_index(::std::string* list_index);
+
   // @@protoc_insertion_point(class_scope:caffe.ImageDataParameter)
  private:
   inline void set_has_source();
@@ -7057,6 +7499,10 @@ class ImageDataParameter : public ::google::protobuf::Message {
   inline void clear_has_task_class_num();
   inline void set_has_regression();
   inline void clear_has_regression();
+  inline void set_has_reduced_decode();
+  inline void clear_has_reduced_decode();
+  inline void set_has_list_index();
+  inline void clear_has_list_index();
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
   ::google::protobuf::uint32 _has_bits_[1];
@@ -7075,6 +7521,8 @@ class ImageDataParameter : public ::google::protobuf::Message {
   ::google::protobuf::uint32 crop_size_;
   ::google::protobuf::uint32 task_class_num_;
   ::google::protobuf::internal::ArenaStringPtr root_folder_;
+  ::google::protobuf::internal::ArenaStringPtr list_index_;
+  bool reduced_decode_;
   friend void  protobuf_AddDesc_caffe_2eproto();
   friend void protobuf_AssignDesc_caffe_2eproto();
   friend void protobuf_ShutdownFile_caffe_2eproto();
@@ -7084,7 +7532,7 @@ class ImageDataParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class InfogainLossParameter : public ::google::protobuf::Message {
+class InfogainLossParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.InfogainLossParameter) */ {
  public:
   InfogainLossParameter();
   virtual ~InfogainLossParameter();
@@ -7126,7 +7574,11 @@ class InfogainLossParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7178,7 +7630,7 @@ class InfogainLossParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class InnerProductParameter : public ::google::protobuf::Message {
+class InnerProductParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.InnerProductParameter) */ {
  public:
   InnerProductParameter();
   virtual ~InnerProductParameter();
@@ -7220,7 +7672,11 @@ class InnerProductParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7321,7 +7777,7 @@ class InnerProductParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class InputParameter : public ::google::protobuf::Message {
+class InputParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.InputParameter) */ {
  public:
   InputParameter();
   virtual ~InputParameter();
@@ -7363,7 +7819,11 @@ class InputParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7392,10 +7852,10 @@ class InputParameter : public ::google::protobuf::Message {
   const ::caffe::BlobShape& shape(int index) const;
   ::caffe::BlobShape* mutable_shape(int index);
   ::caffe::BlobShape* add_shape();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-      shape() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
       mutable_shape();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
+      shape() const;
 
   // @@protoc_insertion_point(class_scope:caffe.InputParameter)
  private:
@@ -7413,7 +7873,7 @@ class InputParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class InterpParameter : public ::google::protobuf::Message {
+class InterpParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.InterpParameter) */ {
  public:
   InterpParameter();
   virtual ~InterpParameter();
@@ -7455,7 +7915,11 @@ class InterpParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7552,7 +8016,7 @@ class InterpParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class LogParameter : public ::google::protobuf::Message {
+class LogParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.LogParameter) */ {
  public:
   LogParameter();
   virtual ~LogParameter();
@@ -7594,7 +8058,11 @@ class LogParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7661,7 +8129,7 @@ class LogParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class LRNParameter : public ::google::protobuf::Message {
+class LRNParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.LRNParameter) */ {
  public:
   LRNParameter();
   virtual ~LRNParameter();
@@ -7703,7 +8171,11 @@ class LRNParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7724,8 +8196,10 @@ class LRNParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef LRNParameter_NormRegion NormRegion;
-  static const NormRegion ACROSS_CHANNELS = LRNParameter_NormRegion_ACROSS_CHANNELS;
-  static const NormRegion WITHIN_CHANNEL = LRNParameter_NormRegion_WITHIN_CHANNEL;
+  static const NormRegion ACROSS_CHANNELS =
+    LRNParameter_NormRegion_ACROSS_CHANNELS;
+  static const NormRegion WITHIN_CHANNEL =
+    LRNParameter_NormRegion_WITHIN_CHANNEL;
   static inline bool NormRegion_IsValid(int value) {
     return LRNParameter_NormRegion_IsValid(value);
   }
@@ -7748,9 +8222,12 @@ class LRNParameter : public ::google::protobuf::Message {
   }
 
   typedef LRNParameter_Engine Engine;
-  static const Engine DEFAULT = LRNParameter_Engine_DEFAULT;
-  static const Engine CAFFE = LRNParameter_Engine_CAFFE;
-  static const Engine CUDNN = LRNParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    LRNParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    LRNParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    LRNParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return LRNParameter_Engine_IsValid(value);
   }
@@ -7849,7 +8326,7 @@ class LRNParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class MemoryDataParameter : public ::google::protobuf::Message {
+class MemoryDataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.MemoryDataParameter) */ {
  public:
   MemoryDataParameter();
   virtual ~MemoryDataParameter();
@@ -7891,7 +8368,11 @@ class MemoryDataParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -7978,7 +8459,7 @@ class MemoryDataParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class MVNParameter : public ::google::protobuf::Message {
+class MVNParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.MVNParameter) */ {
  public:
   MVNParameter();
   virtual ~MVNParameter();
@@ -8020,7 +8501,11 @@ class MVNParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8056,7 +8541,7 @@ class MVNParameter : public ::google::protobuf::Message {
   bool across_channels() const;
   void set_across_channels(bool value);
 
-  // optional float eps = 3 [default = 1e-009];
+  // optional float eps = 3 [default = 1e-09];
   bool has_eps() const;
   void clear_eps();
   static const int kEpsFieldNumber = 3;
@@ -8087,7 +8572,7 @@ class MVNParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ParameterParameter : public ::google::protobuf::Message {
+class ParameterParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ParameterParameter) */ {
  public:
   ParameterParameter();
   virtual ~ParameterParameter();
@@ -8129,7 +8614,11 @@ class ParameterParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8178,7 +8667,7 @@ class ParameterParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class PoolingParameter : public ::google::protobuf::Message {
+class PoolingParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.PoolingParameter) */ {
  public:
   PoolingParameter();
   virtual ~PoolingParameter();
@@ -8220,7 +8709,11 @@ class PoolingParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8241,9 +8734,12 @@ class PoolingParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef PoolingParameter_PoolMethod PoolMethod;
-  static const PoolMethod MAX = PoolingParameter_PoolMethod_MAX;
-  static const PoolMethod AVE = PoolingParameter_PoolMethod_AVE;
-  static const PoolMethod STOCHASTIC = PoolingParameter_PoolMethod_STOCHASTIC;
+  static const PoolMethod MAX =
+    PoolingParameter_PoolMethod_MAX;
+  static const PoolMethod AVE =
+    PoolingParameter_PoolMethod_AVE;
+  static const PoolMethod STOCHASTIC =
+    PoolingParameter_PoolMethod_STOCHASTIC;
   static inline bool PoolMethod_IsValid(int value) {
     return PoolingParameter_PoolMethod_IsValid(value);
   }
@@ -8266,9 +8762,12 @@ class PoolingParameter : public ::google::protobuf::Message {
   }
 
   typedef PoolingParameter_Engine Engine;
-  static const Engine DEFAULT = PoolingParameter_Engine_DEFAULT;
-  static const Engine CAFFE = PoolingParameter_Engine_CAFFE;
-  static const Engine CUDNN = PoolingParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    PoolingParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    PoolingParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    PoolingParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return PoolingParameter_Engine_IsValid(value);
   }
@@ -8427,7 +8926,7 @@ class PoolingParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class PowerParameter : public ::google::protobuf::Message {
+class PowerParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.PowerParameter) */ {
  public:
   PowerParameter();
   virtual ~PowerParameter();
@@ -8469,7 +8968,11 @@ class PowerParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8536,7 +9039,7 @@ class PowerParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class PythonParameter : public ::google::protobuf::Message {
+class PythonParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.PythonParameter) */ {
  public:
   PythonParameter();
   virtual ~PythonParameter();
@@ -8578,7 +9081,11 @@ class PythonParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8670,7 +9177,7 @@ class PythonParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class RecurrentParameter : public ::google::protobuf::Message {
+class RecurrentParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.RecurrentParameter) */ {
  public:
   RecurrentParameter();
   virtual ~RecurrentParameter();
@@ -8712,7 +9219,11 @@ class RecurrentParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8803,7 +9314,7 @@ class RecurrentParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class LSTMParameter : public ::google::protobuf::Message {
+class LSTMParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.LSTMParameter) */ {
  public:
   LSTMParameter();
   virtual ~LSTMParameter();
@@ -8845,7 +9356,11 @@ class LSTMParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8936,7 +9451,7 @@ class LSTMParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ReductionParameter : public ::google::protobuf::Message {
+class ReductionParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ReductionParameter) */ {
  public:
   ReductionParameter();
   virtual ~ReductionParameter();
@@ -8978,7 +9493,11 @@ class ReductionParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -8999,10 +9518,14 @@ class ReductionParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef ReductionParameter_ReductionOp ReductionOp;
-  static const ReductionOp SUM = ReductionParameter_ReductionOp_SUM;
-  static const ReductionOp ASUM = ReductionParameter_ReductionOp_ASUM;
-  static const ReductionOp SUMSQ = ReductionParameter_ReductionOp_SUMSQ;
-  static const ReductionOp MEAN = ReductionParameter_ReductionOp_MEAN;
+  static const ReductionOp SUM =
+    ReductionParameter_ReductionOp_SUM;
+  static const ReductionOp ASUM =
+    ReductionParameter_ReductionOp_ASUM;
+  static const ReductionOp SUMSQ =
+    ReductionParameter_ReductionOp_SUMSQ;
+  static const ReductionOp MEAN =
+    ReductionParameter_ReductionOp_MEAN;
   static inline bool ReductionOp_IsValid(int value) {
     return ReductionParameter_ReductionOp_IsValid(value);
   }
@@ -9071,7 +9594,7 @@ class ReductionParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ReLUParameter : public ::google::protobuf::Message {
+class ReLUParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ReLUParameter) */ {
  public:
   ReLUParameter();
   virtual ~ReLUParameter();
@@ -9113,7 +9636,11 @@ class ReLUParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9134,9 +9661,12 @@ class ReLUParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef ReLUParameter_Engine Engine;
-  static const Engine DEFAULT = ReLUParameter_Engine_DEFAULT;
-  static const Engine CAFFE = ReLUParameter_Engine_CAFFE;
-  static const Engine CUDNN = ReLUParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    ReLUParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    ReLUParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    ReLUParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return ReLUParameter_Engine_IsValid(value);
   }
@@ -9195,7 +9725,7 @@ class ReLUParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ReshapeParameter : public ::google::protobuf::Message {
+class ReshapeParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ReshapeParameter) */ {
  public:
   ReshapeParameter();
   virtual ~ReshapeParameter();
@@ -9237,7 +9767,11 @@ class ReshapeParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9306,7 +9840,7 @@ class ReshapeParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ReverseParameter : public ::google::protobuf::Message {
+class ReverseParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ReverseParameter) */ {
  public:
   ReverseParameter();
   virtual ~ReverseParameter();
@@ -9348,7 +9882,11 @@ class ReverseParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9395,7 +9933,7 @@ class ReverseParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ReverseTimeParameter : public ::google::protobuf::Message {
+class ReverseTimeParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ReverseTimeParameter) */ {
  public:
   ReverseTimeParameter();
   virtual ~ReverseTimeParameter();
@@ -9437,7 +9975,11 @@ class ReverseTimeParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9484,7 +10026,7 @@ class ReverseTimeParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ScaleParameter : public ::google::protobuf::Message {
+class ScaleParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ScaleParameter) */ {
  public:
   ScaleParameter();
   virtual ~ScaleParameter();
@@ -9526,7 +10068,11 @@ class ScaleParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9617,14 +10163,14 @@ class ScaleParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class SigmoidParameter : public ::google::protobuf::Message {
+class ShardDataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ShardDataParameter) */ {
  public:
-  SigmoidParameter();
-  virtual ~SigmoidParameter();
+  ShardDataParameter();
+  virtual ~ShardDataParameter();
 
-  SigmoidParameter(const SigmoidParameter& from);
+  ShardDataParameter(const ShardDataParameter& from);
 
-  inline SigmoidParameter& operator=(const SigmoidParameter& from) {
+  inline ShardDataParameter& operator=(const ShardDataParameter& from) {
     CopyFrom(from);
     return *this;
   }
@@ -9638,19 +10184,19 @@ class SigmoidParameter : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const SigmoidParameter& default_instance();
+  static const ShardDataParameter& default_instance();
 
-  void Swap(SigmoidParameter* other);
+  void Swap(ShardDataParameter* other);
 
   // implements Message ----------------------------------------------
 
-  inline SigmoidParameter* New() const { return New(NULL); }
+  inline ShardDataParameter* New() const { return New(NULL); }
 
-  SigmoidParameter* New(::google::protobuf::Arena* arena) const;
+  ShardDataParameter* New(::google::protobuf::Arena* arena) const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SigmoidParameter& from);
-  void MergeFrom(const SigmoidParameter& from);
+  void CopyFrom(const ShardDataParameter& from);
+  void MergeFrom(const ShardDataParameter& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -9659,13 +10205,17 @@ class SigmoidParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(SigmoidParameter* other);
+  void InternalSwap(ShardDataParameter* other);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
     return _internal_metadata_.arena();
@@ -9679,38 +10229,171 @@ class SigmoidParameter : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
-  typedef SigmoidParameter_Engine Engine;
-  static const Engine DEFAULT = SigmoidParameter_Engine_DEFAULT;
-  static const Engine CAFFE = SigmoidParameter_Engine_CAFFE;
-  static const Engine CUDNN = SigmoidParameter_Engine_CUDNN;
-  static inline bool Engine_IsValid(int value) {
-    return SigmoidParameter_Engine_IsValid(value);
-  }
-  static const Engine Engine_MIN =
-    SigmoidParameter_Engine_Engine_MIN;
-  static const Engine Engine_MAX =
-    SigmoidParameter_Engine_Engine_MAX;
-  static const int Engine_ARRAYSIZE =
-    SigmoidParameter_Engine_Engine_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Engine_descriptor() {
-    return SigmoidParameter_Engine_descriptor();
-  }
-  static inline const ::std::string& Engine_Name(Engine value) {
-    return SigmoidParameter_Engine_Name(value);
-  }
-  static inline bool Engine_Parse(const ::std::string& name,
-      Engine* value) {
-    return SigmoidParameter_Engine_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
-  // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
-  bool has_engine() const;
-  void clear_engine();
-  static const int kEngineFieldNumber = 1;
-  ::caffe::SigmoidParameter_Engine engine() const;
+  // repeated string source = 1;
+  int source_size() const;
+  void clear_source();
+  static const int kSourceFieldNumber = 1;
+  const ::std::string& source(int index) const;
+  ::std::string* mutable_source(int index);
+  void set_source(int index, const ::std::string& value);
+  void set_source(int index, const char* value);
+  void set_source(int index, const char* value, size_t size);
+  ::std::string* add_source();
+  void add_source(const ::std::string& value);
+  void add_source(const char* value);
+  void add_source(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& source() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_source();
+
+  // optional uint32 batch_size = 2 [default = 1];
+  bool has_batch_size() const;
+  void clear_batch_size();
+  static const int kBatchSizeFieldNumber = 2;
+  ::google::protobuf::uint32 batch_size() const;
+  void set_batch_size(::google::protobuf::uint32 value);
+
+  // optional bool shuffle = 3 [default = true];
+  bool has_shuffle() const;
+  void clear_shuffle();
+  static const int kShuffleFieldNumber = 3;
+  bool shuffle() const;
+  void set_shuffle(bool value);
+
+  // optional float pad_value = 4 [default = 0];
+  bool has_pad_value() const;
+  void clear_pad_value();
+  static const int kPadValueFieldNumber = 4;
+  float pad_value() const;
+  void set_pad_value(float value);
+
+  // @@protoc_insertion_point(class_scope:caffe.ShardDataParameter)
+ private:
+  inline void set_has_batch_size();
+  inline void clear_has_batch_size();
+  inline void set_has_shuffle();
+  inline void clear_has_shuffle();
+  inline void set_has_pad_value();
+  inline void clear_has_pad_value();
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> source_;
+  ::google::protobuf::uint32 batch_size_;
+  bool shuffle_;
+  float pad_value_;
+  friend void  protobuf_AddDesc_caffe_2eproto();
+  friend void protobuf_AssignDesc_caffe_2eproto();
+  friend void protobuf_ShutdownFile_caffe_2eproto();
+
+  void InitAsDefaultInstance();
+  static ShardDataParameter* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SigmoidParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.SigmoidParameter) */ {
+ public:
+  SigmoidParameter();
+  virtual ~SigmoidParameter();
+
+  SigmoidParameter(const SigmoidParameter& from);
+
+  inline SigmoidParameter& operator=(const SigmoidParameter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SigmoidParameter& default_instance();
+
+  void Swap(SigmoidParameter* other);
+
+  // implements Message ----------------------------------------------
+
+  inline SigmoidParameter* New() const { return New(NULL); }
+
+  SigmoidParameter* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SigmoidParameter& from);
+  void MergeFrom(const SigmoidParameter& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SigmoidParameter* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef SigmoidParameter_Engine Engine;
+  static const Engine DEFAULT =
+    SigmoidParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    SigmoidParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    SigmoidParameter_Engine_CUDNN;
+  static inline bool Engine_IsValid(int value) {
+    return SigmoidParameter_Engine_IsValid(value);
+  }
+  static const Engine Engine_MIN =
+    SigmoidParameter_Engine_Engine_MIN;
+  static const Engine Engine_MAX =
+    SigmoidParameter_Engine_Engine_MAX;
+  static const int Engine_ARRAYSIZE =
+    SigmoidParameter_Engine_Engine_ARRAYSIZE;
+  static inline const ::google::protobuf::EnumDescriptor*
+  Engine_descriptor() {
+    return SigmoidParameter_Engine_descriptor();
+  }
+  static inline const ::std::string& Engine_Name(Engine value) {
+    return SigmoidParameter_Engine_Name(value);
+  }
+  static inline bool Engine_Parse(const ::std::string& name,
+      Engine* value) {
+    return SigmoidParameter_Engine_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
+  bool has_engine() const;
+  void clear_engine();
+  static const int kEngineFieldNumber = 1;
+  ::caffe::SigmoidParameter_Engine engine() const;
   void set_engine(::caffe::SigmoidParameter_Engine value);
 
   // @@protoc_insertion_point(class_scope:caffe.SigmoidParameter)
@@ -9731,7 +10414,7 @@ class SigmoidParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class SliceParameter : public ::google::protobuf::Message {
+class SliceParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.SliceParameter) */ {
  public:
   SliceParameter();
   virtual ~SliceParameter();
@@ -9773,7 +10456,11 @@ class SliceParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9843,7 +10530,7 @@ class SliceParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class SoftmaxParameter : public ::google::protobuf::Message {
+class SoftmaxParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.SoftmaxParameter) */ {
  public:
   SoftmaxParameter();
   virtual ~SoftmaxParameter();
@@ -9885,7 +10572,11 @@ class SoftmaxParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -9906,9 +10597,12 @@ class SoftmaxParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef SoftmaxParameter_Engine Engine;
-  static const Engine DEFAULT = SoftmaxParameter_Engine_DEFAULT;
-  static const Engine CAFFE = SoftmaxParameter_Engine_CAFFE;
-  static const Engine CUDNN = SoftmaxParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    SoftmaxParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    SoftmaxParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    SoftmaxParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return SoftmaxParameter_Engine_IsValid(value);
   }
@@ -9967,7 +10661,7 @@ class SoftmaxParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class TanHParameter : public ::google::protobuf::Message {
+class TanHParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.TanHParameter) */ {
  public:
   TanHParameter();
   virtual ~TanHParameter();
@@ -10009,7 +10703,11 @@ class TanHParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -10030,9 +10728,12 @@ class TanHParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef TanHParameter_Engine Engine;
-  static const Engine DEFAULT = TanHParameter_Engine_DEFAULT;
-  static const Engine CAFFE = TanHParameter_Engine_CAFFE;
-  static const Engine CUDNN = TanHParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    TanHParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    TanHParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    TanHParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return TanHParameter_Engine_IsValid(value);
   }
@@ -10081,7 +10782,7 @@ class TanHParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class TileParameter : public ::google::protobuf::Message {
+class TileParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.TileParameter) */ {
  public:
   TileParameter();
   virtual ~TileParameter();
@@ -10123,7 +10824,11 @@ class TileParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -10180,7 +10885,7 @@ class TileParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class ThresholdParameter : public ::google::protobuf::Message {
+class ThresholdParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.ThresholdParameter) */ {
  public:
   ThresholdParameter();
   virtual ~ThresholdParameter();
@@ -10222,7 +10927,11 @@ class ThresholdParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -10269,7 +10978,7 @@ class ThresholdParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class WindowDataParameter : public ::google::protobuf::Message {
+class WindowDataParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.WindowDataParameter) */ {
  public:
   WindowDataParameter();
   virtual ~WindowDataParameter();
@@ -10311,7 +11020,11 @@ class WindowDataParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -10499,7 +11212,7 @@ class WindowDataParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class SPPParameter : public ::google::protobuf::Message {
+class SPPParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.SPPParameter) */ {
  public:
   SPPParameter();
   virtual ~SPPParameter();
@@ -10541,7 +11254,11 @@ class SPPParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -10562,9 +11279,12 @@ class SPPParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef SPPParameter_PoolMethod PoolMethod;
-  static const PoolMethod MAX = SPPParameter_PoolMethod_MAX;
-  static const PoolMethod AVE = SPPParameter_PoolMethod_AVE;
-  static const PoolMethod STOCHASTIC = SPPParameter_PoolMethod_STOCHASTIC;
+  static const PoolMethod MAX =
+    SPPParameter_PoolMethod_MAX;
+  static const PoolMethod AVE =
+    SPPParameter_PoolMethod_AVE;
+  static const PoolMethod STOCHASTIC =
+    SPPParameter_PoolMethod_STOCHASTIC;
   static inline bool PoolMethod_IsValid(int value) {
     return SPPParameter_PoolMethod_IsValid(value);
   }
@@ -10587,9 +11307,12 @@ class SPPParameter : public ::google::protobuf::Message {
   }
 
   typedef SPPParameter_Engine Engine;
-  static const Engine DEFAULT = SPPParameter_Engine_DEFAULT;
-  static const Engine CAFFE = SPPParameter_Engine_CAFFE;
-  static const Engine CUDNN = SPPParameter_Engine_CUDNN;
+  static const Engine DEFAULT =
+    SPPParameter_Engine_DEFAULT;
+  static const Engine CAFFE =
+    SPPParameter_Engine_CAFFE;
+  static const Engine CUDNN =
+    SPPParameter_Engine_CUDNN;
   static inline bool Engine_IsValid(int value) {
     return SPPParameter_Engine_IsValid(value);
   }
@@ -10658,7 +11381,7 @@ class SPPParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class V1LayerParameter : public ::google::protobuf::Message {
+class V1LayerParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.V1LayerParameter) */ {
  public:
   V1LayerParameter();
   virtual ~V1LayerParameter();
@@ -10700,7 +11423,11 @@ class V1LayerParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -10721,46 +11448,86 @@ class V1LayerParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef V1LayerParameter_LayerType LayerType;
-  static const LayerType NONE = V1LayerParameter_LayerType_NONE;
-  static const LayerType ABSVAL = V1LayerParameter_LayerType_ABSVAL;
-  static const LayerType ACCURACY = V1LayerParameter_LayerType_ACCURACY;
-  static const LayerType ARGMAX = V1LayerParameter_LayerType_ARGMAX;
-  static const LayerType BNLL = V1LayerParameter_LayerType_BNLL;
-  static const LayerType CONCAT = V1LayerParameter_LayerType_CONCAT;
-  static const LayerType CONTRASTIVE_LOSS = V1LayerParameter_LayerType_CONTRASTIVE_LOSS;
-  static const LayerType CONVOLUTION = V1LayerParameter_LayerType_CONVOLUTION;
-  static const LayerType DATA = V1LayerParameter_LayerType_DATA;
-  static const LayerType DECONVOLUTION = V1LayerParameter_LayerType_DECONVOLUTION;
-  static const LayerType DROPOUT = V1LayerParameter_LayerType_DROPOUT;
-  static const LayerType DUMMY_DATA = V1LayerParameter_LayerType_DUMMY_DATA;
-  static const LayerType EUCLIDEAN_LOSS = V1LayerParameter_LayerType_EUCLIDEAN_LOSS;
-  static const LayerType ELTWISE = V1LayerParameter_LayerType_ELTWISE;
-  static const LayerType EXP = V1LayerParameter_LayerType_EXP;
-  static const LayerType FLATTEN = V1LayerParameter_LayerType_FLATTEN;
-  static const LayerType HDF5_DATA = V1LayerParameter_LayerType_HDF5_DATA;
-  static const LayerType HDF5_OUTPUT = V1LayerParameter_LayerType_HDF5_OUTPUT;
-  static const LayerType HINGE_LOSS = V1LayerParameter_LayerType_HINGE_LOSS;
-  static const LayerType IM2COL = V1LayerParameter_LayerType_IM2COL;
-  static const LayerType IMAGE_DATA = V1LayerParameter_LayerType_IMAGE_DATA;
-  static const LayerType INFOGAIN_LOSS = V1LayerParameter_LayerType_INFOGAIN_LOSS;
-  static const LayerType INNER_PRODUCT = V1LayerParameter_LayerType_INNER_PRODUCT;
-  static const LayerType LRN = V1LayerParameter_LayerType_LRN;
-  static const LayerType MEMORY_DATA = V1LayerParameter_LayerType_MEMORY_DATA;
-  static const LayerType MULTINOMIAL_LOGISTIC_LOSS = V1LayerParameter_LayerType_MULTINOMIAL_LOGISTIC_LOSS;
-  static const LayerType MVN = V1LayerParameter_LayerType_MVN;
-  static const LayerType POOLING = V1LayerParameter_LayerType_POOLING;
-  static const LayerType POWER = V1LayerParameter_LayerType_POWER;
-  static const LayerType RELU = V1LayerParameter_LayerType_RELU;
-  static const LayerType SIGMOID = V1LayerParameter_LayerType_SIGMOID;
-  static const LayerType SIGMOID_CROSS_ENTROPY_LOSS = V1LayerParameter_LayerType_SIGMOID_CROSS_ENTROPY_LOSS;
-  static const LayerType SILENCE = V1LayerParameter_LayerType_SILENCE;
-  static const LayerType SOFTMAX = V1LayerParameter_LayerType_SOFTMAX;
-  static const LayerType SOFTMAX_LOSS = V1LayerParameter_LayerType_SOFTMAX_LOSS;
-  static const LayerType SPLIT = V1LayerParameter_LayerType_SPLIT;
-  static const LayerType SLICE = V1LayerParameter_LayerType_SLICE;
-  static const LayerType TANH = V1LayerParameter_LayerType_TANH;
-  static const LayerType WINDOW_DATA = V1LayerParameter_LayerType_WINDOW_DATA;
-  static const LayerType THRESHOLD = V1LayerParameter_LayerType_THRESHOLD;
+  static const LayerType NONE =
+    V1LayerParameter_LayerType_NONE;
+  static const LayerType ABSVAL =
+    V1LayerParameter_LayerType_ABSVAL;
+  static const LayerType ACCURACY =
+    V1LayerParameter_LayerType_ACCURACY;
+  static const LayerType ARGMAX =
+    V1LayerParameter_LayerType_ARGMAX;
+  static const LayerType BNLL =
+    V1LayerParameter_LayerType_BNLL;
+  static const LayerType CONCAT =
+    V1LayerParameter_LayerType_CONCAT;
+  static const LayerType CONTRASTIVE_LOSS =
+    V1LayerParameter_LayerType_CONTRASTIVE_LOSS;
+  static const LayerType CONVOLUTION =
+    V1LayerParameter_LayerType_CONVOLUTION;
+  static const LayerType DATA =
+    V1LayerParameter_LayerType_DATA;
+  static const LayerType DECONVOLUTION =
+    V1LayerParameter_LayerType_DECONVOLUTION;
+  static const LayerType DROPOUT =
+    V1LayerParameter_LayerType_DROPOUT;
+  static const LayerType DUMMY_DATA =
+    V1LayerParameter_LayerType_DUMMY_DATA;
+  static const LayerType EUCLIDEAN_LOSS =
+    V1LayerParameter_LayerType_EUCLIDEAN_LOSS;
+  static const LayerType ELTWISE =
+    V1LayerParameter_LayerType_ELTWISE;
+  static const LayerType EXP =
+    V1LayerParameter_LayerType_EXP;
+  static const LayerType FLATTEN =
+    V1LayerParameter_LayerType_FLATTEN;
+  static const LayerType HDF5_DATA =
+    V1LayerParameter_LayerType_HDF5_DATA;
+  static const LayerType HDF5_OUTPUT =
+    V1LayerParameter_LayerType_HDF5_OUTPUT;
+  static const LayerType HINGE_LOSS =
+    V1LayerParameter_LayerType_HINGE_LOSS;
+  static const LayerType IM2COL =
+    V1LayerParameter_LayerType_IM2COL;
+  static const LayerType IMAGE_DATA =
+    V1LayerParameter_LayerType_IMAGE_DATA;
+  static const LayerType INFOGAIN_LOSS =
+    V1LayerParameter_LayerType_INFOGAIN_LOSS;
+  static const LayerType INNER_PRODUCT =
+    V1LayerParameter_LayerType_INNER_PRODUCT;
+  static const LayerType LRN =
+    V1LayerParameter_LayerType_LRN;
+  static const LayerType MEMORY_DATA =
+    V1LayerParameter_LayerType_MEMORY_DATA;
+  static const LayerType MULTINOMIAL_LOGISTIC_LOSS =
+    V1LayerParameter_LayerType_MULTINOMIAL_LOGISTIC_LOSS;
+  static const LayerType MVN =
+    V1LayerParameter_LayerType_MVN;
+  static const LayerType POOLING =
+    V1LayerParameter_LayerType_POOLING;
+  static const LayerType POWER =
+    V1LayerParameter_LayerType_POWER;
+  static const LayerType RELU =
+    V1LayerParameter_LayerType_RELU;
+  static const LayerType SIGMOID =
+    V1LayerParameter_LayerType_SIGMOID;
+  static const LayerType SIGMOID_CROSS_ENTROPY_LOSS =
+    V1LayerParameter_LayerType_SIGMOID_CROSS_ENTROPY_LOSS;
+  static const LayerType SILENCE =
+    V1LayerParameter_LayerType_SILENCE;
+  static const LayerType SOFTMAX =
+    V1LayerParameter_LayerType_SOFTMAX;
+  static const LayerType SOFTMAX_LOSS =
+    V1LayerParameter_LayerType_SOFTMAX_LOSS;
+  static const LayerType SPLIT =
+    V1LayerParameter_LayerType_SPLIT;
+  static const LayerType SLICE =
+    V1LayerParameter_LayerType_SLICE;
+  static const LayerType TANH =
+    V1LayerParameter_LayerType_TANH;
+  static const LayerType WINDOW_DATA =
+    V1LayerParameter_LayerType_WINDOW_DATA;
+  static const LayerType THRESHOLD =
+    V1LayerParameter_LayerType_THRESHOLD;
   static inline bool LayerType_IsValid(int value) {
     return V1LayerParameter_LayerType_IsValid(value);
   }
@@ -10783,8 +11550,10 @@ class V1LayerParameter : public ::google::protobuf::Message {
   }
 
   typedef V1LayerParameter_DimCheckMode DimCheckMode;
-  static const DimCheckMode STRICT = V1LayerParameter_DimCheckMode_STRICT;
-  static const DimCheckMode PERMISSIVE = V1LayerParameter_DimCheckMode_PERMISSIVE;
+  static const DimCheckMode STRICT =
+    V1LayerParameter_DimCheckMode_STRICT;
+  static const DimCheckMode PERMISSIVE =
+    V1LayerParameter_DimCheckMode_PERMISSIVE;
   static inline bool DimCheckMode_IsValid(int value) {
     return V1LayerParameter_DimCheckMode_IsValid(value);
   }
@@ -10859,10 +11628,10 @@ class V1LayerParameter : public ::google::protobuf::Message {
   const ::caffe::NetStateRule& include(int index) const;
   ::caffe::NetStateRule* mutable_include(int index);
   ::caffe::NetStateRule* add_include();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      include() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
       mutable_include();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+      include() const;
 
   // repeated .caffe.NetStateRule exclude = 33;
   int exclude_size() const;
@@ -10871,10 +11640,10 @@ class V1LayerParameter : public ::google::protobuf::Message {
   const ::caffe::NetStateRule& exclude(int index) const;
   ::caffe::NetStateRule* mutable_exclude(int index);
   ::caffe::NetStateRule* add_exclude();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-      exclude() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
       mutable_exclude();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+      exclude() const;
 
   // optional .caffe.V1LayerParameter.LayerType type = 5;
   bool has_type() const;
@@ -10890,10 +11659,10 @@ class V1LayerParameter : public ::google::protobuf::Message {
   const ::caffe::BlobProto& blobs(int index) const;
   ::caffe::BlobProto* mutable_blobs(int index);
   ::caffe::BlobProto* add_blobs();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
       mutable_blobs();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+      blobs() const;
 
   // repeated string param = 1001;
   int param_size() const;
@@ -11360,7 +12129,7 @@ class V1LayerParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class V0LayerParameter : public ::google::protobuf::Message {
+class V0LayerParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.V0LayerParameter) */ {
  public:
   V0LayerParameter();
   virtual ~V0LayerParameter();
@@ -11402,7 +12171,11 @@ class V0LayerParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -11423,9 +12196,12 @@ class V0LayerParameter : public ::google::protobuf::Message {
   // nested types ----------------------------------------------------
 
   typedef V0LayerParameter_PoolMethod PoolMethod;
-  static const PoolMethod MAX = V0LayerParameter_PoolMethod_MAX;
-  static const PoolMethod AVE = V0LayerParameter_PoolMethod_AVE;
-  static const PoolMethod STOCHASTIC = V0LayerParameter_PoolMethod_STOCHASTIC;
+  static const PoolMethod MAX =
+    V0LayerParameter_PoolMethod_MAX;
+  static const PoolMethod AVE =
+    V0LayerParameter_PoolMethod_AVE;
+  static const PoolMethod STOCHASTIC =
+    V0LayerParameter_PoolMethod_STOCHASTIC;
   static inline bool PoolMethod_IsValid(int value) {
     return V0LayerParameter_PoolMethod_IsValid(value);
   }
@@ -11634,10 +12410,10 @@ class V0LayerParameter : public ::google::protobuf::Message {
   const ::caffe::BlobProto& blobs(int index) const;
   ::caffe::BlobProto* mutable_blobs(int index);
   ::caffe::BlobProto* add_blobs();
-  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-      blobs() const;
   ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
       mutable_blobs();
+  const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+      blobs() const;
 
   // repeated float blobs_lr = 51;
   int blobs_lr_size() const;
@@ -11885,7 +12661,7 @@ class V0LayerParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class PReLUParameter : public ::google::protobuf::Message {
+class PReLUParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.PReLUParameter) */ {
  public:
   PReLUParameter();
   virtual ~PReLUParameter();
@@ -11927,7 +12703,11 @@ class PReLUParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -11986,7 +12766,7 @@ class PReLUParameter : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class TransposeParameter : public ::google::protobuf::Message {
+class TransposeParameter : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:caffe.TransposeParameter) */ {
  public:
   TransposeParameter();
   virtual ~TransposeParameter();
@@ -12028,7 +12808,11 @@ class TransposeParameter : public ::google::protobuf::Message {
       ::google::protobuf::io::CodedInputStream* input);
   void SerializeWithCachedSizes(
       ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
   int GetCachedSize() const { return _cached_size_; }
   private:
   void SharedCtor();
@@ -12145,6 +12929,7 @@ inline ::caffe::BlobShape* BlobProto::mutable_shape() {
   return shape_;
 }
 inline ::caffe::BlobShape* BlobProto::release_shape() {
+  // @@protoc_insertion_point(field_release:caffe.BlobProto.shape)
   clear_has_shape();
   ::caffe::BlobShape* temp = shape_;
   shape_ = NULL;
@@ -12400,16 +13185,16 @@ inline ::caffe::BlobProto* BlobProtoVector::add_blobs() {
   // @@protoc_insertion_point(field_add:caffe.BlobProtoVector.blobs)
   return blobs_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-BlobProtoVector::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.BlobProtoVector.blobs)
-  return blobs_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
 BlobProtoVector::mutable_blobs() {
   // @@protoc_insertion_point(field_mutable_list:caffe.BlobProtoVector.blobs)
   return &blobs_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+BlobProtoVector::blobs() const {
+  // @@protoc_insertion_point(field_list:caffe.BlobProtoVector.blobs)
+  return blobs_;
+}
 
 // -------------------------------------------------------------------
 
@@ -12527,6 +13312,7 @@ inline ::std::string* Datum::mutable_data() {
   return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* Datum::release_data() {
+  // @@protoc_insertion_point(field_release:caffe.Datum.data)
   clear_has_data();
   return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -12668,6 +13454,7 @@ inline ::std::string* FillerParameter::mutable_type() {
   return type_.MutableNoArena(_default_type_);
 }
 inline ::std::string* FillerParameter::release_type() {
+  // @@protoc_insertion_point(field_release:caffe.FillerParameter.type)
   clear_has_type();
   return type_.ReleaseNoArena(_default_type_);
 }
@@ -12894,6 +13681,7 @@ inline ::std::string* NetParameter::mutable_name() {
   return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* NetParameter::release_name() {
+  // @@protoc_insertion_point(field_release:caffe.NetParameter.name)
   clear_has_name();
   return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -12936,6 +13724,7 @@ inline void NetParameter::set_input(int index, const char* value, size_t size) {
   // @@protoc_insertion_point(field_set_pointer:caffe.NetParameter.input)
 }
 inline ::std::string* NetParameter::add_input() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.NetParameter.input)
   return input_.Add();
 }
 inline void NetParameter::add_input(const ::std::string& value) {
@@ -12980,16 +13769,16 @@ inline ::caffe::BlobShape* NetParameter::add_input_shape() {
   // @@protoc_insertion_point(field_add:caffe.NetParameter.input_shape)
   return input_shape_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-NetParameter::input_shape() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.input_shape)
-  return input_shape_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
 NetParameter::mutable_input_shape() {
   // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.input_shape)
   return &input_shape_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
+NetParameter::input_shape() const {
+  // @@protoc_insertion_point(field_list:caffe.NetParameter.input_shape)
+  return input_shape_;
+}
 
 // repeated int32 input_dim = 4;
 inline int NetParameter::input_dim_size() const {
@@ -13072,6 +13861,7 @@ inline ::caffe::NetState* NetParameter::mutable_state() {
   return state_;
 }
 inline ::caffe::NetState* NetParameter::release_state() {
+  // @@protoc_insertion_point(field_release:caffe.NetParameter.state)
   clear_has_state();
   ::caffe::NetState* temp = state_;
   state_ = NULL;
@@ -13131,16 +13921,16 @@ inline ::caffe::LayerParameter* NetParameter::add_layer() {
   // @@protoc_insertion_point(field_add:caffe.NetParameter.layer)
   return layer_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >&
-NetParameter::layer() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.layer)
-  return layer_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >*
 NetParameter::mutable_layer() {
   // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.layer)
   return &layer_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::LayerParameter >&
+NetParameter::layer() const {
+  // @@protoc_insertion_point(field_list:caffe.NetParameter.layer)
+  return layer_;
+}
 
 // repeated .caffe.V1LayerParameter layers = 2;
 inline int NetParameter::layers_size() const {
@@ -13161,16 +13951,16 @@ inline ::caffe::V1LayerParameter* NetParameter::add_layers() {
   // @@protoc_insertion_point(field_add:caffe.NetParameter.layers)
   return layers_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >&
-NetParameter::layers() const {
-  // @@protoc_insertion_point(field_list:caffe.NetParameter.layers)
-  return layers_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >*
 NetParameter::mutable_layers() {
   // @@protoc_insertion_point(field_mutable_list:caffe.NetParameter.layers)
   return &layers_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::V1LayerParameter >&
+NetParameter::layers() const {
+  // @@protoc_insertion_point(field_list:caffe.NetParameter.layers)
+  return layers_;
+}
 
 // -------------------------------------------------------------------
 
@@ -13216,6 +14006,7 @@ inline ::std::string* SolverParameter::mutable_net() {
   return net_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* SolverParameter::release_net() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.net)
   clear_has_net();
   return net_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -13256,6 +14047,7 @@ inline ::caffe::NetParameter* SolverParameter::mutable_net_param() {
   return net_param_;
 }
 inline ::caffe::NetParameter* SolverParameter::release_net_param() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.net_param)
   clear_has_net_param();
   ::caffe::NetParameter* temp = net_param_;
   net_param_ = NULL;
@@ -13312,6 +14104,7 @@ inline ::std::string* SolverParameter::mutable_train_net() {
   return train_net_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* SolverParameter::release_train_net() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.train_net)
   clear_has_train_net();
   return train_net_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -13354,6 +14147,7 @@ inline void SolverParameter::set_test_net(int index, const char* value, size_t s
   // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.test_net)
 }
 inline ::std::string* SolverParameter::add_test_net() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.SolverParameter.test_net)
   return test_net_.Add();
 }
 inline void SolverParameter::add_test_net(const ::std::string& value) {
@@ -13406,6 +14200,7 @@ inline ::caffe::NetParameter* SolverParameter::mutable_train_net_param() {
   return train_net_param_;
 }
 inline ::caffe::NetParameter* SolverParameter::release_train_net_param() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.train_net_param)
   clear_has_train_net_param();
   ::caffe::NetParameter* temp = train_net_param_;
   train_net_param_ = NULL;
@@ -13441,16 +14236,16 @@ inline ::caffe::NetParameter* SolverParameter::add_test_net_param() {
   // @@protoc_insertion_point(field_add:caffe.SolverParameter.test_net_param)
   return test_net_param_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >&
-SolverParameter::test_net_param() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_net_param)
-  return test_net_param_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >*
 SolverParameter::mutable_test_net_param() {
   // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.test_net_param)
   return &test_net_param_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetParameter >&
+SolverParameter::test_net_param() const {
+  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_net_param)
+  return test_net_param_;
+}
 
 // optional .caffe.NetState train_state = 26;
 inline bool SolverParameter::has_train_state() const {
@@ -13479,6 +14274,7 @@ inline ::caffe::NetState* SolverParameter::mutable_train_state() {
   return train_state_;
 }
 inline ::caffe::NetState* SolverParameter::release_train_state() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.train_state)
   clear_has_train_state();
   ::caffe::NetState* temp = train_state_;
   train_state_ = NULL;
@@ -13514,16 +14310,16 @@ inline ::caffe::NetState* SolverParameter::add_test_state() {
   // @@protoc_insertion_point(field_add:caffe.SolverParameter.test_state)
   return test_state_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetState >&
-SolverParameter::test_state() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_state)
-  return test_state_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::NetState >*
 SolverParameter::mutable_test_state() {
   // @@protoc_insertion_point(field_mutable_list:caffe.SolverParameter.test_state)
   return &test_state_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetState >&
+SolverParameter::test_state() const {
+  // @@protoc_insertion_point(field_list:caffe.SolverParameter.test_state)
+  return test_state_;
+}
 
 // repeated int32 test_iter = 3;
 inline int SolverParameter::test_iter_size() const {
@@ -13627,15 +14423,63 @@ inline void SolverParameter::set_test_initialization(bool value) {
   // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_initialization)
 }
 
+// optional bool test_async = 44 [default = false];
+inline bool SolverParameter::has_test_async() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void SolverParameter::set_has_test_async() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void SolverParameter::clear_has_test_async() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void SolverParameter::clear_test_async() {
+  test_async_ = false;
+  clear_has_test_async();
+}
+inline bool SolverParameter::test_async() const {
+  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_async)
+  return test_async_;
+}
+inline void SolverParameter::set_test_async(bool value) {
+  set_has_test_async();
+  test_async_ = value;
+  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_async)
+}
+
+// optional int32 test_threads = 45 [default = 1];
+inline bool SolverParameter::has_test_threads() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void SolverParameter::set_has_test_threads() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void SolverParameter::clear_has_test_threads() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void SolverParameter::clear_test_threads() {
+  test_threads_ = 1;
+  clear_has_test_threads();
+}
+inline ::google::protobuf::int32 SolverParameter::test_threads() const {
+  // @@protoc_insertion_point(field_get:caffe.SolverParameter.test_threads)
+  return test_threads_;
+}
+inline void SolverParameter::set_test_threads(::google::protobuf::int32 value) {
+  set_has_test_threads();
+  test_threads_ = value;
+  // @@protoc_insertion_point(field_set:caffe.SolverParameter.test_threads)
+}
+
 // optional float base_lr = 5;
 inline bool SolverParameter::has_base_lr() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+  return (_has_bits_[0] & 0x00004000u) != 0;
 }
 inline void SolverParameter::set_has_base_lr() {
-  _has_bits_[0] |= 0x00001000u;
+  _has_bits_[0] |= 0x00004000u;
 }
 inline void SolverParameter::clear_has_base_lr() {
-  _has_bits_[0] &= ~0x00001000u;
+  _has_bits_[0] &= ~0x00004000u;
 }
 inline void SolverParameter::clear_base_lr() {
   base_lr_ = 0;
@@ -13653,13 +14497,13 @@ inline void SolverParameter::set_base_lr(float value) {
 
 // optional int32 display = 6;
 inline bool SolverParameter::has_display() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
+  return (_has_bits_[0] & 0x00008000u) != 0;
 }
 inline void SolverParameter::set_has_display() {
-  _has_bits_[0] |= 0x00002000u;
+  _has_bits_[0] |= 0x00008000u;
 }
 inline void SolverParameter::clear_has_display() {
-  _has_bits_[0] &= ~0x00002000u;
+  _has_bits_[0] &= ~0x00008000u;
 }
 inline void SolverParameter::clear_display() {
   display_ = 0;
@@ -13677,13 +14521,13 @@ inline void SolverParameter::set_display(::google::protobuf::int32 value) {
 
 // optional int32 average_loss = 33 [default = 1];
 inline bool SolverParameter::has_average_loss() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
+  return (_has_bits_[0] & 0x00010000u) != 0;
 }
 inline void SolverParameter::set_has_average_loss() {
-  _has_bits_[0] |= 0x00004000u;
+  _has_bits_[0] |= 0x00010000u;
 }
 inline void SolverParameter::clear_has_average_loss() {
-  _has_bits_[0] &= ~0x00004000u;
+  _has_bits_[0] &= ~0x00010000u;
 }
 inline void SolverParameter::clear_average_loss() {
   average_loss_ = 1;
@@ -13701,13 +14545,13 @@ inline void SolverParameter::set_average_loss(::google::protobuf::int32 value) {
 
 // optional int32 max_iter = 7;
 inline bool SolverParameter::has_max_iter() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
+  return (_has_bits_[0] & 0x00020000u) != 0;
 }
 inline void SolverParameter::set_has_max_iter() {
-  _has_bits_[0] |= 0x00008000u;
+  _has_bits_[0] |= 0x00020000u;
 }
 inline void SolverParameter::clear_has_max_iter() {
-  _has_bits_[0] &= ~0x00008000u;
+  _has_bits_[0] &= ~0x00020000u;
 }
 inline void SolverParameter::clear_max_iter() {
   max_iter_ = 0;
@@ -13725,13 +14569,13 @@ inline void SolverParameter::set_max_iter(::google::protobuf::int32 value) {
 
 // optional int32 iter_size = 36 [default = 1];
 inline bool SolverParameter::has_iter_size() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
+  return (_has_bits_[0] & 0x00040000u) != 0;
 }
 inline void SolverParameter::set_has_iter_size() {
-  _has_bits_[0] |= 0x00010000u;
+  _has_bits_[0] |= 0x00040000u;
 }
 inline void SolverParameter::clear_has_iter_size() {
-  _has_bits_[0] &= ~0x00010000u;
+  _has_bits_[0] &= ~0x00040000u;
 }
 inline void SolverParameter::clear_iter_size() {
   iter_size_ = 1;
@@ -13749,13 +14593,13 @@ inline void SolverParameter::set_iter_size(::google::protobuf::int32 value) {
 
 // optional string lr_policy = 8;
 inline bool SolverParameter::has_lr_policy() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
+  return (_has_bits_[0] & 0x00080000u) != 0;
 }
 inline void SolverParameter::set_has_lr_policy() {
-  _has_bits_[0] |= 0x00020000u;
+  _has_bits_[0] |= 0x00080000u;
 }
 inline void SolverParameter::clear_has_lr_policy() {
-  _has_bits_[0] &= ~0x00020000u;
+  _has_bits_[0] &= ~0x00080000u;
 }
 inline void SolverParameter::clear_lr_policy() {
   lr_policy_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -13787,6 +14631,7 @@ inline ::std::string* SolverParameter::mutable_lr_policy() {
   return lr_policy_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* SolverParameter::release_lr_policy() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.lr_policy)
   clear_has_lr_policy();
   return lr_policy_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -13802,13 +14647,13 @@ inline void SolverParameter::set_allocated_lr_policy(::std::string* lr_policy) {
 
 // optional float gamma = 9;
 inline bool SolverParameter::has_gamma() const {
-  return (_has_bits_[0] & 0x00040000u) != 0;
+  return (_has_bits_[0] & 0x00100000u) != 0;
 }
 inline void SolverParameter::set_has_gamma() {
-  _has_bits_[0] |= 0x00040000u;
+  _has_bits_[0] |= 0x00100000u;
 }
 inline void SolverParameter::clear_has_gamma() {
-  _has_bits_[0] &= ~0x00040000u;
+  _has_bits_[0] &= ~0x00100000u;
 }
 inline void SolverParameter::clear_gamma() {
   gamma_ = 0;
@@ -13826,13 +14671,13 @@ inline void SolverParameter::set_gamma(float value) {
 
 // optional float power = 10;
 inline bool SolverParameter::has_power() const {
-  return (_has_bits_[0] & 0x00080000u) != 0;
+  return (_has_bits_[0] & 0x00200000u) != 0;
 }
 inline void SolverParameter::set_has_power() {
-  _has_bits_[0] |= 0x00080000u;
+  _has_bits_[0] |= 0x00200000u;
 }
 inline void SolverParameter::clear_has_power() {
-  _has_bits_[0] &= ~0x00080000u;
+  _has_bits_[0] &= ~0x00200000u;
 }
 inline void SolverParameter::clear_power() {
   power_ = 0;
@@ -13850,13 +14695,13 @@ inline void SolverParameter::set_power(float value) {
 
 // optional float momentum = 11;
 inline bool SolverParameter::has_momentum() const {
-  return (_has_bits_[0] & 0x00100000u) != 0;
+  return (_has_bits_[0] & 0x00400000u) != 0;
 }
 inline void SolverParameter::set_has_momentum() {
-  _has_bits_[0] |= 0x00100000u;
+  _has_bits_[0] |= 0x00400000u;
 }
 inline void SolverParameter::clear_has_momentum() {
-  _has_bits_[0] &= ~0x00100000u;
+  _has_bits_[0] &= ~0x00400000u;
 }
 inline void SolverParameter::clear_momentum() {
   momentum_ = 0;
@@ -13874,13 +14719,13 @@ inline void SolverParameter::set_momentum(float value) {
 
 // optional float weight_decay = 12;
 inline bool SolverParameter::has_weight_decay() const {
-  return (_has_bits_[0] & 0x00200000u) != 0;
+  return (_has_bits_[0] & 0x00800000u) != 0;
 }
 inline void SolverParameter::set_has_weight_decay() {
-  _has_bits_[0] |= 0x00200000u;
+  _has_bits_[0] |= 0x00800000u;
 }
 inline void SolverParameter::clear_has_weight_decay() {
-  _has_bits_[0] &= ~0x00200000u;
+  _has_bits_[0] &= ~0x00800000u;
 }
 inline void SolverParameter::clear_weight_decay() {
   weight_decay_ = 0;
@@ -13898,13 +14743,13 @@ inline void SolverParameter::set_weight_decay(float value) {
 
 // optional string regularization_type = 29 [default = "L2"];
 inline bool SolverParameter::has_regularization_type() const {
-  return (_has_bits_[0] & 0x00400000u) != 0;
+  return (_has_bits_[0] & 0x01000000u) != 0;
 }
 inline void SolverParameter::set_has_regularization_type() {
-  _has_bits_[0] |= 0x00400000u;
+  _has_bits_[0] |= 0x01000000u;
 }
 inline void SolverParameter::clear_has_regularization_type() {
-  _has_bits_[0] &= ~0x00400000u;
+  _has_bits_[0] &= ~0x01000000u;
 }
 inline void SolverParameter::clear_regularization_type() {
   regularization_type_.ClearToDefaultNoArena(_default_regularization_type_);
@@ -13936,6 +14781,7 @@ inline ::std::string* SolverParameter::mutable_regularization_type() {
   return regularization_type_.MutableNoArena(_default_regularization_type_);
 }
 inline ::std::string* SolverParameter::release_regularization_type() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.regularization_type)
   clear_has_regularization_type();
   return regularization_type_.ReleaseNoArena(_default_regularization_type_);
 }
@@ -13951,13 +14797,13 @@ inline void SolverParameter::set_allocated_regularization_type(::std::string* re
 
 // optional int32 stepsize = 13;
 inline bool SolverParameter::has_stepsize() const {
-  return (_has_bits_[0] & 0x00800000u) != 0;
+  return (_has_bits_[0] & 0x02000000u) != 0;
 }
 inline void SolverParameter::set_has_stepsize() {
-  _has_bits_[0] |= 0x00800000u;
+  _has_bits_[0] |= 0x02000000u;
 }
 inline void SolverParameter::clear_has_stepsize() {
-  _has_bits_[0] &= ~0x00800000u;
+  _has_bits_[0] &= ~0x02000000u;
 }
 inline void SolverParameter::clear_stepsize() {
   stepsize_ = 0;
@@ -14005,13 +14851,13 @@ SolverParameter::mutable_stepvalue() {
 
 // optional float clip_gradients = 35 [default = -1];
 inline bool SolverParameter::has_clip_gradients() const {
-  return (_has_bits_[0] & 0x02000000u) != 0;
+  return (_has_bits_[0] & 0x08000000u) != 0;
 }
 inline void SolverParameter::set_has_clip_gradients() {
-  _has_bits_[0] |= 0x02000000u;
+  _has_bits_[0] |= 0x08000000u;
 }
 inline void SolverParameter::clear_has_clip_gradients() {
-  _has_bits_[0] &= ~0x02000000u;
+  _has_bits_[0] &= ~0x08000000u;
 }
 inline void SolverParameter::clear_clip_gradients() {
   clip_gradients_ = -1;
@@ -14029,13 +14875,13 @@ inline void SolverParameter::set_clip_gradients(float value) {
 
 // optional int32 snapshot = 14 [default = 0];
 inline bool SolverParameter::has_snapshot() const {
-  return (_has_bits_[0] & 0x04000000u) != 0;
+  return (_has_bits_[0] & 0x10000000u) != 0;
 }
 inline void SolverParameter::set_has_snapshot() {
-  _has_bits_[0] |= 0x04000000u;
+  _has_bits_[0] |= 0x10000000u;
 }
 inline void SolverParameter::clear_has_snapshot() {
-  _has_bits_[0] &= ~0x04000000u;
+  _has_bits_[0] &= ~0x10000000u;
 }
 inline void SolverParameter::clear_snapshot() {
   snapshot_ = 0;
@@ -14053,13 +14899,13 @@ inline void SolverParameter::set_snapshot(::google::protobuf::int32 value) {
 
 // optional string snapshot_prefix = 15;
 inline bool SolverParameter::has_snapshot_prefix() const {
-  return (_has_bits_[0] & 0x08000000u) != 0;
+  return (_has_bits_[0] & 0x20000000u) != 0;
 }
 inline void SolverParameter::set_has_snapshot_prefix() {
-  _has_bits_[0] |= 0x08000000u;
+  _has_bits_[0] |= 0x20000000u;
 }
 inline void SolverParameter::clear_has_snapshot_prefix() {
-  _has_bits_[0] &= ~0x08000000u;
+  _has_bits_[0] &= ~0x20000000u;
 }
 inline void SolverParameter::clear_snapshot_prefix() {
   snapshot_prefix_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
@@ -14091,6 +14937,7 @@ inline ::std::string* SolverParameter::mutable_snapshot_prefix() {
   return snapshot_prefix_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* SolverParameter::release_snapshot_prefix() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.snapshot_prefix)
   clear_has_snapshot_prefix();
   return snapshot_prefix_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -14106,13 +14953,13 @@ inline void SolverParameter::set_allocated_snapshot_prefix(::std::string* snapsh
 
 // optional bool snapshot_diff = 16 [default = false];
 inline bool SolverParameter::has_snapshot_diff() const {
-  return (_has_bits_[0] & 0x10000000u) != 0;
+  return (_has_bits_[0] & 0x40000000u) != 0;
 }
 inline void SolverParameter::set_has_snapshot_diff() {
-  _has_bits_[0] |= 0x10000000u;
+  _has_bits_[0] |= 0x40000000u;
 }
 inline void SolverParameter::clear_has_snapshot_diff() {
-  _has_bits_[0] &= ~0x10000000u;
+  _has_bits_[0] &= ~0x40000000u;
 }
 inline void SolverParameter::clear_snapshot_diff() {
   snapshot_diff_ = false;
@@ -14130,13 +14977,13 @@ inline void SolverParameter::set_snapshot_diff(bool value) {
 
 // optional .caffe.SolverParameter.SnapshotFormat snapshot_format = 37 [default = BINARYPROTO];
 inline bool SolverParameter::has_snapshot_format() const {
-  return (_has_bits_[0] & 0x20000000u) != 0;
+  return (_has_bits_[0] & 0x80000000u) != 0;
 }
 inline void SolverParameter::set_has_snapshot_format() {
-  _has_bits_[0] |= 0x20000000u;
+  _has_bits_[0] |= 0x80000000u;
 }
 inline void SolverParameter::clear_has_snapshot_format() {
-  _has_bits_[0] &= ~0x20000000u;
+  _has_bits_[0] &= ~0x80000000u;
 }
 inline void SolverParameter::clear_snapshot_format() {
   snapshot_format_ = 1;
@@ -14153,15 +15000,39 @@ inline void SolverParameter::set_snapshot_format(::caffe::SolverParameter_Snapsh
   // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot_format)
 }
 
+// optional bool snapshot_async = 43 [default = false];
+inline bool SolverParameter::has_snapshot_async() const {
+  return (_has_bits_[1] & 0x00000001u) != 0;
+}
+inline void SolverParameter::set_has_snapshot_async() {
+  _has_bits_[1] |= 0x00000001u;
+}
+inline void SolverParameter::clear_has_snapshot_async() {
+  _has_bits_[1] &= ~0x00000001u;
+}
+inline void SolverParameter::clear_snapshot_async() {
+  snapshot_async_ = false;
+  clear_has_snapshot_async();
+}
+inline bool SolverParameter::snapshot_async() const {
+  // @@protoc_insertion_point(field_get:caffe.SolverParameter.snapshot_async)
+  return snapshot_async_;
+}
+inline void SolverParameter::set_snapshot_async(bool value) {
+  set_has_snapshot_async();
+  snapshot_async_ = value;
+  // @@protoc_insertion_point(field_set:caffe.SolverParameter.snapshot_async)
+}
+
 // optional .caffe.SolverParameter.SolverMode solver_mode = 17 [default = GPU];
 inline bool SolverParameter::has_solver_mode() const {
-  return (_has_bits_[0] & 0x40000000u) != 0;
+  return (_has_bits_[1] & 0x00000002u) != 0;
 }
 inline void SolverParameter::set_has_solver_mode() {
-  _has_bits_[0] |= 0x40000000u;
+  _has_bits_[1] |= 0x00000002u;
 }
 inline void SolverParameter::clear_has_solver_mode() {
-  _has_bits_[0] &= ~0x40000000u;
+  _has_bits_[1] &= ~0x00000002u;
 }
 inline void SolverParameter::clear_solver_mode() {
   solver_mode_ = 1;
@@ -14180,13 +15051,13 @@ inline void SolverParameter::set_solver_mode(::caffe::SolverParameter_SolverMode
 
 // optional int32 device_id = 18 [default = 0];
 inline bool SolverParameter::has_device_id() const {
-  return (_has_bits_[0] & 0x80000000u) != 0;
+  return (_has_bits_[1] & 0x00000004u) != 0;
 }
 inline void SolverParameter::set_has_device_id() {
-  _has_bits_[0] |= 0x80000000u;
+  _has_bits_[1] |= 0x00000004u;
 }
 inline void SolverParameter::clear_has_device_id() {
-  _has_bits_[0] &= ~0x80000000u;
+  _has_bits_[1] &= ~0x00000004u;
 }
 inline void SolverParameter::clear_device_id() {
   device_id_ = 0;
@@ -14204,13 +15075,13 @@ inline void SolverParameter::set_device_id(::google::protobuf::int32 value) {
 
 // optional int64 random_seed = 20 [default = -1];
 inline bool SolverParameter::has_random_seed() const {
-  return (_has_bits_[1] & 0x00000001u) != 0;
+  return (_has_bits_[1] & 0x00000008u) != 0;
 }
 inline void SolverParameter::set_has_random_seed() {
-  _has_bits_[1] |= 0x00000001u;
+  _has_bits_[1] |= 0x00000008u;
 }
 inline void SolverParameter::clear_has_random_seed() {
-  _has_bits_[1] &= ~0x00000001u;
+  _has_bits_[1] &= ~0x00000008u;
 }
 inline void SolverParameter::clear_random_seed() {
   random_seed_ = GOOGLE_LONGLONG(-1);
@@ -14228,13 +15099,13 @@ inline void SolverParameter::set_random_seed(::google::protobuf::int64 value) {
 
 // optional string type = 40 [default = "SGD"];
 inline bool SolverParameter::has_type() const {
-  return (_has_bits_[1] & 0x00000002u) != 0;
+  return (_has_bits_[1] & 0x00000010u) != 0;
 }
 inline void SolverParameter::set_has_type() {
-  _has_bits_[1] |= 0x00000002u;
+  _has_bits_[1] |= 0x00000010u;
 }
 inline void SolverParameter::clear_has_type() {
-  _has_bits_[1] &= ~0x00000002u;
+  _has_bits_[1] &= ~0x00000010u;
 }
 inline void SolverParameter::clear_type() {
   type_.ClearToDefaultNoArena(_default_type_);
@@ -14266,6 +15137,7 @@ inline ::std::string* SolverParameter::mutable_type() {
   return type_.MutableNoArena(_default_type_);
 }
 inline ::std::string* SolverParameter::release_type() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.type)
   clear_has_type();
   return type_.ReleaseNoArena(_default_type_);
 }
@@ -14279,18 +15151,18 @@ inline void SolverParameter::set_allocated_type(::std::string* type) {
   // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.type)
 }
 
-// optional float delta = 31 [default = 1e-008];
+// optional float delta = 31 [default = 1e-08];
 inline bool SolverParameter::has_delta() const {
-  return (_has_bits_[1] & 0x00000004u) != 0;
+  return (_has_bits_[1] & 0x00000020u) != 0;
 }
 inline void SolverParameter::set_has_delta() {
-  _has_bits_[1] |= 0x00000004u;
+  _has_bits_[1] |= 0x00000020u;
 }
 inline void SolverParameter::clear_has_delta() {
-  _has_bits_[1] &= ~0x00000004u;
+  _has_bits_[1] &= ~0x00000020u;
 }
 inline void SolverParameter::clear_delta() {
-  delta_ = 1e-008f;
+  delta_ = 1e-08f;
   clear_has_delta();
 }
 inline float SolverParameter::delta() const {
@@ -14305,13 +15177,13 @@ inline void SolverParameter::set_delta(float value) {
 
 // optional float momentum2 = 39 [default = 0.999];
 inline bool SolverParameter::has_momentum2() const {
-  return (_has_bits_[1] & 0x00000008u) != 0;
+  return (_has_bits_[1] & 0x00000040u) != 0;
 }
 inline void SolverParameter::set_has_momentum2() {
-  _has_bits_[1] |= 0x00000008u;
+  _has_bits_[1] |= 0x00000040u;
 }
 inline void SolverParameter::clear_has_momentum2() {
-  _has_bits_[1] &= ~0x00000008u;
+  _has_bits_[1] &= ~0x00000040u;
 }
 inline void SolverParameter::clear_momentum2() {
   momentum2_ = 0.999f;
@@ -14329,13 +15201,13 @@ inline void SolverParameter::set_momentum2(float value) {
 
 // optional float rms_decay = 38;
 inline bool SolverParameter::has_rms_decay() const {
-  return (_has_bits_[1] & 0x00000010u) != 0;
+  return (_has_bits_[1] & 0x00000080u) != 0;
 }
 inline void SolverParameter::set_has_rms_decay() {
-  _has_bits_[1] |= 0x00000010u;
+  _has_bits_[1] |= 0x00000080u;
 }
 inline void SolverParameter::clear_has_rms_decay() {
-  _has_bits_[1] &= ~0x00000010u;
+  _has_bits_[1] &= ~0x00000080u;
 }
 inline void SolverParameter::clear_rms_decay() {
   rms_decay_ = 0;
@@ -14353,13 +15225,13 @@ inline void SolverParameter::set_rms_decay(float value) {
 
 // optional bool debug_info = 23 [default = false];
 inline bool SolverParameter::has_debug_info() const {
-  return (_has_bits_[1] & 0x00000020u) != 0;
+  return (_has_bits_[1] & 0x00000100u) != 0;
 }
 inline void SolverParameter::set_has_debug_info() {
-  _has_bits_[1] |= 0x00000020u;
+  _has_bits_[1] |= 0x00000100u;
 }
 inline void SolverParameter::clear_has_debug_info() {
-  _has_bits_[1] &= ~0x00000020u;
+  _has_bits_[1] &= ~0x00000100u;
 }
 inline void SolverParameter::clear_debug_info() {
   debug_info_ = false;
@@ -14377,13 +15249,13 @@ inline void SolverParameter::set_debug_info(bool value) {
 
 // optional bool snapshot_after_train = 28 [default = true];
 inline bool SolverParameter::has_snapshot_after_train() const {
-  return (_has_bits_[1] & 0x00000040u) != 0;
+  return (_has_bits_[1] & 0x00000200u) != 0;
 }
 inline void SolverParameter::set_has_snapshot_after_train() {
-  _has_bits_[1] |= 0x00000040u;
+  _has_bits_[1] |= 0x00000200u;
 }
 inline void SolverParameter::clear_has_snapshot_after_train() {
-  _has_bits_[1] &= ~0x00000040u;
+  _has_bits_[1] &= ~0x00000200u;
 }
 inline void SolverParameter::clear_snapshot_after_train() {
   snapshot_after_train_ = true;
@@ -14401,13 +15273,13 @@ inline void SolverParameter::set_snapshot_after_train(bool value) {
 
 // optional .caffe.SolverParameter.SolverType solver_type = 30 [default = SGD];
 inline bool SolverParameter::has_solver_type() const {
-  return (_has_bits_[1] & 0x00000080u) != 0;
+  return (_has_bits_[1] & 0x00000400u) != 0;
 }
 inline void SolverParameter::set_has_solver_type() {
-  _has_bits_[1] |= 0x00000080u;
+  _has_bits_[1] |= 0x00000400u;
 }
 inline void SolverParameter::clear_has_solver_type() {
-  _has_bits_[1] &= ~0x00000080u;
+  _has_bits_[1] &= ~0x00000400u;
 }
 inline void SolverParameter::clear_solver_type() {
   solver_type_ = 0;
@@ -14424,6 +15296,108 @@ inline void SolverParameter::set_solver_type(::caffe::SolverParameter_SolverType
   // @@protoc_insertion_point(field_set:caffe.SolverParameter.solver_type)
 }
 
+// optional string data_stats_file = 41;
+inline bool SolverParameter::has_data_stats_file() const {
+  return (_has_bits_[1] & 0x00000800u) != 0;
+}
+inline void SolverParameter::set_has_data_stats_file() {
+  _has_bits_[1] |= 0x00000800u;
+}
+inline void SolverParameter::clear_has_data_stats_file() {
+  _has_bits_[1] &= ~0x00000800u;
+}
+inline void SolverParameter::clear_data_stats_file() {
+  data_stats_file_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_data_stats_file();
+}
+inline const ::std::string& SolverParameter::data_stats_file() const {
+  // @@protoc_insertion_point(field_get:caffe.SolverParameter.data_stats_file)
+  return data_stats_file_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void SolverParameter::set_data_stats_file(const ::std::string& value) {
+  set_has_data_stats_file();
+  data_stats_file_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:caffe.SolverParameter.data_stats_file)
+}
+inline void SolverParameter::set_data_stats_file(const char* value) {
+  set_has_data_stats_file();
+  data_stats_file_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:caffe.SolverParameter.data_stats_file)
+}
+inline void SolverParameter::set_data_stats_file(const char* value, size_t size) {
+  set_has_data_stats_file();
+  data_stats_file_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:caffe.SolverParameter.data_stats_file)
+}
+inline ::std::string* SolverParameter::mutable_data_stats_file() {
+  set_has_data_stats_file();
+  // @@protoc_insertion_point(field_mutable:caffe.SolverParameter.data_stats_file)
+  return data_stats_file_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* SolverParameter::release_data_stats_file() {
+  // @@protoc_insertion_point(field_release:caffe.SolverParameter.data_stats_file)
+  clear_has_data_stats_file();
+  return data_stats_file_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void SolverParameter::set_allocated_data_stats_file(::std::string* data_stats_file) {
+  if (data_stats_file != NULL) {
+    set_has_data_stats_file();
+  } else {
+    clear_has_data_stats_file();
+  }
+  data_stats_file_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data_stats_file);
+  // @@protoc_insertion_point(field_set_allocated:caffe.SolverParameter.data_stats_file)
+}
+
+// optional bool flat_params = 42 [default = false];
+inline bool SolverParameter::has_flat_params() const {
+  return (_has_bits_[1] & 0x00001000u) != 0;
+}
+inline void SolverParameter::set_has_flat_params() {
+  _has_bits_[1] |= 0x00001000u;
+}
+inline void SolverParameter::clear_has_flat_params() {
+  _has_bits_[1] &= ~0x00001000u;
+}
+inline void SolverParameter::clear_flat_params() {
+  flat_params_ = false;
+  clear_has_flat_params();
+}
+inline bool SolverParameter::flat_params() const {
+  // @@protoc_insertion_point(field_get:caffe.SolverParameter.flat_params)
+  return flat_params_;
+}
+inline void SolverParameter::set_flat_params(bool value) {
+  set_has_flat_params();
+  flat_params_ = value;
+  // @@protoc_insertion_point(field_set:caffe.SolverParameter.flat_params)
+}
+
+// optional int32 hogwild_sync_interval = 46 [default = 0];
+inline bool SolverParameter::has_hogwild_sync_interval() const {
+  return (_has_bits_[1] & 0x00002000u) != 0;
+}
+inline void SolverParameter::set_has_hogwild_sync_interval() {
+  _has_bits_[1] |= 0x00002000u;
+}
+inline void SolverParameter::clear_has_hogwild_sync_interval() {
+  _has_bits_[1] &= ~0x00002000u;
+}
+inline void SolverParameter::clear_hogwild_sync_interval() {
+  hogwild_sync_interval_ = 0;
+  clear_has_hogwild_sync_interval();
+}
+inline ::google::protobuf::int32 SolverParameter::hogwild_sync_interval() const {
+  // @@protoc_insertion_point(field_get:caffe.SolverParameter.hogwild_sync_interval)
+  return hogwild_sync_interval_;
+}
+inline void SolverParameter::set_hogwild_sync_interval(::google::protobuf::int32 value) {
+  set_has_hogwild_sync_interval();
+  hogwild_sync_interval_ = value;
+  // @@protoc_insertion_point(field_set:caffe.SolverParameter.hogwild_sync_interval)
+}
+
 // -------------------------------------------------------------------
 
 // SolverState
@@ -14492,6 +15466,7 @@ inline ::std::string* SolverState::mutable_learned_net() {
   return learned_net_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* SolverState::release_learned_net() {
+  // @@protoc_insertion_point(field_release:caffe.SolverState.learned_net)
   clear_has_learned_net();
   return learned_net_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -14524,16 +15499,16 @@ inline ::caffe::BlobProto* SolverState::add_history() {
   // @@protoc_insertion_point(field_add:caffe.SolverState.history)
   return history_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-SolverState::history() const {
-  // @@protoc_insertion_point(field_list:caffe.SolverState.history)
-  return history_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
 SolverState::mutable_history() {
   // @@protoc_insertion_point(field_mutable_list:caffe.SolverState.history)
   return &history_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+SolverState::history() const {
+  // @@protoc_insertion_point(field_list:caffe.SolverState.history)
+  return history_;
+}
 
 // optional int32 current_step = 4 [default = 0];
 inline bool SolverState::has_current_step() const {
@@ -14641,6 +15616,7 @@ inline void NetState::set_stage(int index, const char* value, size_t size) {
   // @@protoc_insertion_point(field_set_pointer:caffe.NetState.stage)
 }
 inline ::std::string* NetState::add_stage() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.NetState.stage)
   return stage_.Add();
 }
 inline void NetState::add_stage(const ::std::string& value) {
@@ -14772,6 +15748,7 @@ inline void NetStateRule::set_stage(int index, const char* value, size_t size) {
   // @@protoc_insertion_point(field_set_pointer:caffe.NetStateRule.stage)
 }
 inline ::std::string* NetStateRule::add_stage() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.NetStateRule.stage)
   return stage_.Add();
 }
 inline void NetStateRule::add_stage(const ::std::string& value) {
@@ -14826,6 +15803,7 @@ inline void NetStateRule::set_not_stage(int index, const char* value, size_t siz
   // @@protoc_insertion_point(field_set_pointer:caffe.NetStateRule.not_stage)
 }
 inline ::std::string* NetStateRule::add_not_stage() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.NetStateRule.not_stage)
   return not_stage_.Add();
 }
 inline void NetStateRule::add_not_stage(const ::std::string& value) {
@@ -14895,6 +15873,7 @@ inline ::std::string* ParamSpec::mutable_name() {
   return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* ParamSpec::release_name() {
+  // @@protoc_insertion_point(field_release:caffe.ParamSpec.name)
   clear_has_name();
   return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -15025,6 +16004,7 @@ inline ::std::string* LayerParameter::mutable_name() {
   return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* LayerParameter::release_name() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.name)
   clear_has_name();
   return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -15078,6 +16058,7 @@ inline ::std::string* LayerParameter::mutable_type() {
   return type_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* LayerParameter::release_type() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.type)
   clear_has_type();
   return type_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -15120,6 +16101,7 @@ inline void LayerParameter::set_bottom(int index, const char* value, size_t size
   // @@protoc_insertion_point(field_set_pointer:caffe.LayerParameter.bottom)
 }
 inline ::std::string* LayerParameter::add_bottom() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.LayerParameter.bottom)
   return bottom_.Add();
 }
 inline void LayerParameter::add_bottom(const ::std::string& value) {
@@ -15174,6 +16156,7 @@ inline void LayerParameter::set_top(int index, const char* value, size_t size) {
   // @@protoc_insertion_point(field_set_pointer:caffe.LayerParameter.top)
 }
 inline ::std::string* LayerParameter::add_top() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.LayerParameter.top)
   return top_.Add();
 }
 inline void LayerParameter::add_top(const ::std::string& value) {
@@ -15273,16 +16256,16 @@ inline ::caffe::ParamSpec* LayerParameter::add_param() {
   // @@protoc_insertion_point(field_add:caffe.LayerParameter.param)
   return param_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >&
-LayerParameter::param() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.param)
-  return param_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >*
 LayerParameter::mutable_param() {
   // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.param)
   return &param_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::ParamSpec >&
+LayerParameter::param() const {
+  // @@protoc_insertion_point(field_list:caffe.LayerParameter.param)
+  return param_;
+}
 
 // repeated .caffe.BlobProto blobs = 7;
 inline int LayerParameter::blobs_size() const {
@@ -15303,16 +16286,16 @@ inline ::caffe::BlobProto* LayerParameter::add_blobs() {
   // @@protoc_insertion_point(field_add:caffe.LayerParameter.blobs)
   return blobs_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-LayerParameter::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.blobs)
-  return blobs_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
 LayerParameter::mutable_blobs() {
   // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.blobs)
   return &blobs_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+LayerParameter::blobs() const {
+  // @@protoc_insertion_point(field_list:caffe.LayerParameter.blobs)
+  return blobs_;
+}
 
 // repeated bool propagate_down = 11;
 inline int LayerParameter::propagate_down_size() const {
@@ -15363,16 +16346,16 @@ inline ::caffe::NetStateRule* LayerParameter::add_include() {
   // @@protoc_insertion_point(field_add:caffe.LayerParameter.include)
   return include_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-LayerParameter::include() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.include)
-  return include_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
 LayerParameter::mutable_include() {
   // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.include)
   return &include_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+LayerParameter::include() const {
+  // @@protoc_insertion_point(field_list:caffe.LayerParameter.include)
+  return include_;
+}
 
 // repeated .caffe.NetStateRule exclude = 9;
 inline int LayerParameter::exclude_size() const {
@@ -15393,16 +16376,16 @@ inline ::caffe::NetStateRule* LayerParameter::add_exclude() {
   // @@protoc_insertion_point(field_add:caffe.LayerParameter.exclude)
   return exclude_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-LayerParameter::exclude() const {
-  // @@protoc_insertion_point(field_list:caffe.LayerParameter.exclude)
-  return exclude_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
 LayerParameter::mutable_exclude() {
   // @@protoc_insertion_point(field_mutable_list:caffe.LayerParameter.exclude)
   return &exclude_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+LayerParameter::exclude() const {
+  // @@protoc_insertion_point(field_list:caffe.LayerParameter.exclude)
+  return exclude_;
+}
 
 // optional .caffe.TransformationParameter transform_param = 100;
 inline bool LayerParameter::has_transform_param() const {
@@ -15431,6 +16414,7 @@ inline ::caffe::TransformationParameter* LayerParameter::mutable_transform_param
   return transform_param_;
 }
 inline ::caffe::TransformationParameter* LayerParameter::release_transform_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.transform_param)
   clear_has_transform_param();
   ::caffe::TransformationParameter* temp = transform_param_;
   transform_param_ = NULL;
@@ -15474,6 +16458,7 @@ inline ::caffe::LossParameter* LayerParameter::mutable_loss_param() {
   return loss_param_;
 }
 inline ::caffe::LossParameter* LayerParameter::release_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.loss_param)
   clear_has_loss_param();
   ::caffe::LossParameter* temp = loss_param_;
   loss_param_ = NULL;
@@ -15517,6 +16502,7 @@ inline ::caffe::AccuracyParameter* LayerParameter::mutable_accuracy_param() {
   return accuracy_param_;
 }
 inline ::caffe::AccuracyParameter* LayerParameter::release_accuracy_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.accuracy_param)
   clear_has_accuracy_param();
   ::caffe::AccuracyParameter* temp = accuracy_param_;
   accuracy_param_ = NULL;
@@ -15560,6 +16546,7 @@ inline ::caffe::ArgMaxParameter* LayerParameter::mutable_argmax_param() {
   return argmax_param_;
 }
 inline ::caffe::ArgMaxParameter* LayerParameter::release_argmax_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.argmax_param)
   clear_has_argmax_param();
   ::caffe::ArgMaxParameter* temp = argmax_param_;
   argmax_param_ = NULL;
@@ -15603,6 +16590,7 @@ inline ::caffe::BatchNormParameter* LayerParameter::mutable_batch_norm_param() {
   return batch_norm_param_;
 }
 inline ::caffe::BatchNormParameter* LayerParameter::release_batch_norm_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.batch_norm_param)
   clear_has_batch_norm_param();
   ::caffe::BatchNormParameter* temp = batch_norm_param_;
   batch_norm_param_ = NULL;
@@ -15646,6 +16634,7 @@ inline ::caffe::BiasParameter* LayerParameter::mutable_bias_param() {
   return bias_param_;
 }
 inline ::caffe::BiasParameter* LayerParameter::release_bias_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.bias_param)
   clear_has_bias_param();
   ::caffe::BiasParameter* temp = bias_param_;
   bias_param_ = NULL;
@@ -15689,6 +16678,7 @@ inline ::caffe::ConcatParameter* LayerParameter::mutable_concat_param() {
   return concat_param_;
 }
 inline ::caffe::ConcatParameter* LayerParameter::release_concat_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.concat_param)
   clear_has_concat_param();
   ::caffe::ConcatParameter* temp = concat_param_;
   concat_param_ = NULL;
@@ -15732,6 +16722,7 @@ inline ::caffe::ContrastiveLossParameter* LayerParameter::mutable_contrastive_lo
   return contrastive_loss_param_;
 }
 inline ::caffe::ContrastiveLossParameter* LayerParameter::release_contrastive_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.contrastive_loss_param)
   clear_has_contrastive_loss_param();
   ::caffe::ContrastiveLossParameter* temp = contrastive_loss_param_;
   contrastive_loss_param_ = NULL;
@@ -15775,6 +16766,7 @@ inline ::caffe::ConvolutionParameter* LayerParameter::mutable_convolution_param(
   return convolution_param_;
 }
 inline ::caffe::ConvolutionParameter* LayerParameter::release_convolution_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.convolution_param)
   clear_has_convolution_param();
   ::caffe::ConvolutionParameter* temp = convolution_param_;
   convolution_param_ = NULL;
@@ -15818,6 +16810,7 @@ inline ::caffe::CropParameter* LayerParameter::mutable_crop_param() {
   return crop_param_;
 }
 inline ::caffe::CropParameter* LayerParameter::release_crop_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.crop_param)
   clear_has_crop_param();
   ::caffe::CropParameter* temp = crop_param_;
   crop_param_ = NULL;
@@ -15861,6 +16854,7 @@ inline ::caffe::DataParameter* LayerParameter::mutable_data_param() {
   return data_param_;
 }
 inline ::caffe::DataParameter* LayerParameter::release_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.data_param)
   clear_has_data_param();
   ::caffe::DataParameter* temp = data_param_;
   data_param_ = NULL;
@@ -15904,6 +16898,7 @@ inline ::caffe::DenseBlockParameter* LayerParameter::mutable_denseblock_param()
   return denseblock_param_;
 }
 inline ::caffe::DenseBlockParameter* LayerParameter::release_denseblock_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.denseblock_param)
   clear_has_denseblock_param();
   ::caffe::DenseBlockParameter* temp = denseblock_param_;
   denseblock_param_ = NULL;
@@ -15947,6 +16942,7 @@ inline ::caffe::DropoutParameter* LayerParameter::mutable_dropout_param() {
   return dropout_param_;
 }
 inline ::caffe::DropoutParameter* LayerParameter::release_dropout_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.dropout_param)
   clear_has_dropout_param();
   ::caffe::DropoutParameter* temp = dropout_param_;
   dropout_param_ = NULL;
@@ -15990,6 +16986,7 @@ inline ::caffe::DummyDataParameter* LayerParameter::mutable_dummy_data_param() {
   return dummy_data_param_;
 }
 inline ::caffe::DummyDataParameter* LayerParameter::release_dummy_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.dummy_data_param)
   clear_has_dummy_data_param();
   ::caffe::DummyDataParameter* temp = dummy_data_param_;
   dummy_data_param_ = NULL;
@@ -16033,6 +17030,7 @@ inline ::caffe::EltwiseParameter* LayerParameter::mutable_eltwise_param() {
   return eltwise_param_;
 }
 inline ::caffe::EltwiseParameter* LayerParameter::release_eltwise_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.eltwise_param)
   clear_has_eltwise_param();
   ::caffe::EltwiseParameter* temp = eltwise_param_;
   eltwise_param_ = NULL;
@@ -16076,6 +17074,7 @@ inline ::caffe::ELUParameter* LayerParameter::mutable_elu_param() {
   return elu_param_;
 }
 inline ::caffe::ELUParameter* LayerParameter::release_elu_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.elu_param)
   clear_has_elu_param();
   ::caffe::ELUParameter* temp = elu_param_;
   elu_param_ = NULL;
@@ -16119,6 +17118,7 @@ inline ::caffe::EmbedParameter* LayerParameter::mutable_embed_param() {
   return embed_param_;
 }
 inline ::caffe::EmbedParameter* LayerParameter::release_embed_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.embed_param)
   clear_has_embed_param();
   ::caffe::EmbedParameter* temp = embed_param_;
   embed_param_ = NULL;
@@ -16162,6 +17162,7 @@ inline ::caffe::ExpParameter* LayerParameter::mutable_exp_param() {
   return exp_param_;
 }
 inline ::caffe::ExpParameter* LayerParameter::release_exp_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.exp_param)
   clear_has_exp_param();
   ::caffe::ExpParameter* temp = exp_param_;
   exp_param_ = NULL;
@@ -16205,6 +17206,7 @@ inline ::caffe::FlattenParameter* LayerParameter::mutable_flatten_param() {
   return flatten_param_;
 }
 inline ::caffe::FlattenParameter* LayerParameter::release_flatten_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.flatten_param)
   clear_has_flatten_param();
   ::caffe::FlattenParameter* temp = flatten_param_;
   flatten_param_ = NULL;
@@ -16248,6 +17250,7 @@ inline ::caffe::HDF5DataParameter* LayerParameter::mutable_hdf5_data_param() {
   return hdf5_data_param_;
 }
 inline ::caffe::HDF5DataParameter* LayerParameter::release_hdf5_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.hdf5_data_param)
   clear_has_hdf5_data_param();
   ::caffe::HDF5DataParameter* temp = hdf5_data_param_;
   hdf5_data_param_ = NULL;
@@ -16291,6 +17294,7 @@ inline ::caffe::HDF5OutputParameter* LayerParameter::mutable_hdf5_output_param()
   return hdf5_output_param_;
 }
 inline ::caffe::HDF5OutputParameter* LayerParameter::release_hdf5_output_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.hdf5_output_param)
   clear_has_hdf5_output_param();
   ::caffe::HDF5OutputParameter* temp = hdf5_output_param_;
   hdf5_output_param_ = NULL;
@@ -16334,6 +17338,7 @@ inline ::caffe::HingeLossParameter* LayerParameter::mutable_hinge_loss_param() {
   return hinge_loss_param_;
 }
 inline ::caffe::HingeLossParameter* LayerParameter::release_hinge_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.hinge_loss_param)
   clear_has_hinge_loss_param();
   ::caffe::HingeLossParameter* temp = hinge_loss_param_;
   hinge_loss_param_ = NULL;
@@ -16377,6 +17382,7 @@ inline ::caffe::ImageDataParameter* LayerParameter::mutable_image_data_param() {
   return image_data_param_;
 }
 inline ::caffe::ImageDataParameter* LayerParameter::release_image_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.image_data_param)
   clear_has_image_data_param();
   ::caffe::ImageDataParameter* temp = image_data_param_;
   image_data_param_ = NULL;
@@ -16420,6 +17426,7 @@ inline ::caffe::InfogainLossParameter* LayerParameter::mutable_infogain_loss_par
   return infogain_loss_param_;
 }
 inline ::caffe::InfogainLossParameter* LayerParameter::release_infogain_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.infogain_loss_param)
   clear_has_infogain_loss_param();
   ::caffe::InfogainLossParameter* temp = infogain_loss_param_;
   infogain_loss_param_ = NULL;
@@ -16463,6 +17470,7 @@ inline ::caffe::InnerProductParameter* LayerParameter::mutable_inner_product_par
   return inner_product_param_;
 }
 inline ::caffe::InnerProductParameter* LayerParameter::release_inner_product_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.inner_product_param)
   clear_has_inner_product_param();
   ::caffe::InnerProductParameter* temp = inner_product_param_;
   inner_product_param_ = NULL;
@@ -16506,6 +17514,7 @@ inline ::caffe::InputParameter* LayerParameter::mutable_input_param() {
   return input_param_;
 }
 inline ::caffe::InputParameter* LayerParameter::release_input_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.input_param)
   clear_has_input_param();
   ::caffe::InputParameter* temp = input_param_;
   input_param_ = NULL;
@@ -16549,6 +17558,7 @@ inline ::caffe::LogParameter* LayerParameter::mutable_log_param() {
   return log_param_;
 }
 inline ::caffe::LogParameter* LayerParameter::release_log_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.log_param)
   clear_has_log_param();
   ::caffe::LogParameter* temp = log_param_;
   log_param_ = NULL;
@@ -16592,6 +17602,7 @@ inline ::caffe::LRNParameter* LayerParameter::mutable_lrn_param() {
   return lrn_param_;
 }
 inline ::caffe::LRNParameter* LayerParameter::release_lrn_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.lrn_param)
   clear_has_lrn_param();
   ::caffe::LRNParameter* temp = lrn_param_;
   lrn_param_ = NULL;
@@ -16635,6 +17646,7 @@ inline ::caffe::MemoryDataParameter* LayerParameter::mutable_memory_data_param()
   return memory_data_param_;
 }
 inline ::caffe::MemoryDataParameter* LayerParameter::release_memory_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.memory_data_param)
   clear_has_memory_data_param();
   ::caffe::MemoryDataParameter* temp = memory_data_param_;
   memory_data_param_ = NULL;
@@ -16678,6 +17690,7 @@ inline ::caffe::MVNParameter* LayerParameter::mutable_mvn_param() {
   return mvn_param_;
 }
 inline ::caffe::MVNParameter* LayerParameter::release_mvn_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.mvn_param)
   clear_has_mvn_param();
   ::caffe::MVNParameter* temp = mvn_param_;
   mvn_param_ = NULL;
@@ -16721,6 +17734,7 @@ inline ::caffe::ParameterParameter* LayerParameter::mutable_parameter_param() {
   return parameter_param_;
 }
 inline ::caffe::ParameterParameter* LayerParameter::release_parameter_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.parameter_param)
   clear_has_parameter_param();
   ::caffe::ParameterParameter* temp = parameter_param_;
   parameter_param_ = NULL;
@@ -16764,6 +17778,7 @@ inline ::caffe::PoolingParameter* LayerParameter::mutable_pooling_param() {
   return pooling_param_;
 }
 inline ::caffe::PoolingParameter* LayerParameter::release_pooling_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.pooling_param)
   clear_has_pooling_param();
   ::caffe::PoolingParameter* temp = pooling_param_;
   pooling_param_ = NULL;
@@ -16807,6 +17822,7 @@ inline ::caffe::PowerParameter* LayerParameter::mutable_power_param() {
   return power_param_;
 }
 inline ::caffe::PowerParameter* LayerParameter::release_power_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.power_param)
   clear_has_power_param();
   ::caffe::PowerParameter* temp = power_param_;
   power_param_ = NULL;
@@ -16850,6 +17866,7 @@ inline ::caffe::PReLUParameter* LayerParameter::mutable_prelu_param() {
   return prelu_param_;
 }
 inline ::caffe::PReLUParameter* LayerParameter::release_prelu_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.prelu_param)
   clear_has_prelu_param();
   ::caffe::PReLUParameter* temp = prelu_param_;
   prelu_param_ = NULL;
@@ -16893,6 +17910,7 @@ inline ::caffe::PythonParameter* LayerParameter::mutable_python_param() {
   return python_param_;
 }
 inline ::caffe::PythonParameter* LayerParameter::release_python_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.python_param)
   clear_has_python_param();
   ::caffe::PythonParameter* temp = python_param_;
   python_param_ = NULL;
@@ -16936,6 +17954,7 @@ inline ::caffe::RecurrentParameter* LayerParameter::mutable_recurrent_param() {
   return recurrent_param_;
 }
 inline ::caffe::RecurrentParameter* LayerParameter::release_recurrent_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.recurrent_param)
   clear_has_recurrent_param();
   ::caffe::RecurrentParameter* temp = recurrent_param_;
   recurrent_param_ = NULL;
@@ -16979,6 +17998,7 @@ inline ::caffe::ReductionParameter* LayerParameter::mutable_reduction_param() {
   return reduction_param_;
 }
 inline ::caffe::ReductionParameter* LayerParameter::release_reduction_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.reduction_param)
   clear_has_reduction_param();
   ::caffe::ReductionParameter* temp = reduction_param_;
   reduction_param_ = NULL;
@@ -17022,6 +18042,7 @@ inline ::caffe::ReLUParameter* LayerParameter::mutable_relu_param() {
   return relu_param_;
 }
 inline ::caffe::ReLUParameter* LayerParameter::release_relu_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.relu_param)
   clear_has_relu_param();
   ::caffe::ReLUParameter* temp = relu_param_;
   relu_param_ = NULL;
@@ -17065,6 +18086,7 @@ inline ::caffe::ReshapeParameter* LayerParameter::mutable_reshape_param() {
   return reshape_param_;
 }
 inline ::caffe::ReshapeParameter* LayerParameter::release_reshape_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.reshape_param)
   clear_has_reshape_param();
   ::caffe::ReshapeParameter* temp = reshape_param_;
   reshape_param_ = NULL;
@@ -17108,6 +18130,7 @@ inline ::caffe::ScaleParameter* LayerParameter::mutable_scale_param() {
   return scale_param_;
 }
 inline ::caffe::ScaleParameter* LayerParameter::release_scale_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.scale_param)
   clear_has_scale_param();
   ::caffe::ScaleParameter* temp = scale_param_;
   scale_param_ = NULL;
@@ -17151,6 +18174,7 @@ inline ::caffe::SigmoidParameter* LayerParameter::mutable_sigmoid_param() {
   return sigmoid_param_;
 }
 inline ::caffe::SigmoidParameter* LayerParameter::release_sigmoid_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.sigmoid_param)
   clear_has_sigmoid_param();
   ::caffe::SigmoidParameter* temp = sigmoid_param_;
   sigmoid_param_ = NULL;
@@ -17194,6 +18218,7 @@ inline ::caffe::SoftmaxParameter* LayerParameter::mutable_softmax_param() {
   return softmax_param_;
 }
 inline ::caffe::SoftmaxParameter* LayerParameter::release_softmax_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.softmax_param)
   clear_has_softmax_param();
   ::caffe::SoftmaxParameter* temp = softmax_param_;
   softmax_param_ = NULL;
@@ -17237,6 +18262,7 @@ inline ::caffe::SPPParameter* LayerParameter::mutable_spp_param() {
   return spp_param_;
 }
 inline ::caffe::SPPParameter* LayerParameter::release_spp_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.spp_param)
   clear_has_spp_param();
   ::caffe::SPPParameter* temp = spp_param_;
   spp_param_ = NULL;
@@ -17280,6 +18306,7 @@ inline ::caffe::SliceParameter* LayerParameter::mutable_slice_param() {
   return slice_param_;
 }
 inline ::caffe::SliceParameter* LayerParameter::release_slice_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.slice_param)
   clear_has_slice_param();
   ::caffe::SliceParameter* temp = slice_param_;
   slice_param_ = NULL;
@@ -17323,6 +18350,7 @@ inline ::caffe::TanHParameter* LayerParameter::mutable_tanh_param() {
   return tanh_param_;
 }
 inline ::caffe::TanHParameter* LayerParameter::release_tanh_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.tanh_param)
   clear_has_tanh_param();
   ::caffe::TanHParameter* temp = tanh_param_;
   tanh_param_ = NULL;
@@ -17366,6 +18394,7 @@ inline ::caffe::ThresholdParameter* LayerParameter::mutable_threshold_param() {
   return threshold_param_;
 }
 inline ::caffe::ThresholdParameter* LayerParameter::release_threshold_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.threshold_param)
   clear_has_threshold_param();
   ::caffe::ThresholdParameter* temp = threshold_param_;
   threshold_param_ = NULL;
@@ -17409,6 +18438,7 @@ inline ::caffe::TileParameter* LayerParameter::mutable_tile_param() {
   return tile_param_;
 }
 inline ::caffe::TileParameter* LayerParameter::release_tile_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.tile_param)
   clear_has_tile_param();
   ::caffe::TileParameter* temp = tile_param_;
   tile_param_ = NULL;
@@ -17452,6 +18482,7 @@ inline ::caffe::WindowDataParameter* LayerParameter::mutable_window_data_param()
   return window_data_param_;
 }
 inline ::caffe::WindowDataParameter* LayerParameter::release_window_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.window_data_param)
   clear_has_window_data_param();
   ::caffe::WindowDataParameter* temp = window_data_param_;
   window_data_param_ = NULL;
@@ -17495,6 +18526,7 @@ inline ::caffe::CTCDecoderParameter* LayerParameter::mutable_ctc_decoder_param()
   return ctc_decoder_param_;
 }
 inline ::caffe::CTCDecoderParameter* LayerParameter::release_ctc_decoder_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.ctc_decoder_param)
   clear_has_ctc_decoder_param();
   ::caffe::CTCDecoderParameter* temp = ctc_decoder_param_;
   ctc_decoder_param_ = NULL;
@@ -17538,6 +18570,7 @@ inline ::caffe::CTCLossParameter* LayerParameter::mutable_ctc_loss_param() {
   return ctc_loss_param_;
 }
 inline ::caffe::CTCLossParameter* LayerParameter::release_ctc_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.ctc_loss_param)
   clear_has_ctc_loss_param();
   ::caffe::CTCLossParameter* temp = ctc_loss_param_;
   ctc_loss_param_ = NULL;
@@ -17581,6 +18614,7 @@ inline ::caffe::ReverseParameter* LayerParameter::mutable_reverse_param() {
   return reverse_param_;
 }
 inline ::caffe::ReverseParameter* LayerParameter::release_reverse_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.reverse_param)
   clear_has_reverse_param();
   ::caffe::ReverseParameter* temp = reverse_param_;
   reverse_param_ = NULL;
@@ -17624,6 +18658,7 @@ inline ::caffe::ReverseTimeParameter* LayerParameter::mutable_reverse_time_param
   return reverse_time_param_;
 }
 inline ::caffe::ReverseTimeParameter* LayerParameter::release_reverse_time_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.reverse_time_param)
   clear_has_reverse_time_param();
   ::caffe::ReverseTimeParameter* temp = reverse_time_param_;
   reverse_time_param_ = NULL;
@@ -17667,6 +18702,7 @@ inline ::caffe::InterpParameter* LayerParameter::mutable_interp_param() {
   return interp_param_;
 }
 inline ::caffe::InterpParameter* LayerParameter::release_interp_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.interp_param)
   clear_has_interp_param();
   ::caffe::InterpParameter* temp = interp_param_;
   interp_param_ = NULL;
@@ -17683,15 +18719,59 @@ inline void LayerParameter::set_allocated_interp_param(::caffe::InterpParameter*
   // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.interp_param)
 }
 
+// optional .caffe.ShardDataParameter shard_data_param = 163;
+inline bool LayerParameter::has_shard_data_param() const {
+  return (_has_bits_[2] & 0x00000001u) != 0;
+}
+inline void LayerParameter::set_has_shard_data_param() {
+  _has_bits_[2] |= 0x00000001u;
+}
+inline void LayerParameter::clear_has_shard_data_param() {
+  _has_bits_[2] &= ~0x00000001u;
+}
+inline void LayerParameter::clear_shard_data_param() {
+  if (shard_data_param_ != NULL) shard_data_param_->::caffe::ShardDataParameter::Clear();
+  clear_has_shard_data_param();
+}
+inline const ::caffe::ShardDataParameter& LayerParameter::shard_data_param() const {
+  // @@protoc_insertion_point(field_get:caffe.LayerParameter.shard_data_param)
+  return shard_data_param_ != NULL ? *shard_data_param_ : *default_instance_->shard_data_param_;
+}
+inline ::caffe::ShardDataParameter* LayerParameter::mutable_shard_data_param() {
+  set_has_shard_data_param();
+  if (shard_data_param_ == NULL) {
+    shard_data_param_ = new ::caffe::ShardDataParameter;
+  }
+  // @@protoc_insertion_point(field_mutable:caffe.LayerParameter.shard_data_param)
+  return shard_data_param_;
+}
+inline ::caffe::ShardDataParameter* LayerParameter::release_shard_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.shard_data_param)
+  clear_has_shard_data_param();
+  ::caffe::ShardDataParameter* temp = shard_data_param_;
+  shard_data_param_ = NULL;
+  return temp;
+}
+inline void LayerParameter::set_allocated_shard_data_param(::caffe::ShardDataParameter* shard_data_param) {
+  delete shard_data_param_;
+  shard_data_param_ = shard_data_param;
+  if (shard_data_param) {
+    set_has_shard_data_param();
+  } else {
+    clear_has_shard_data_param();
+  }
+  // @@protoc_insertion_point(field_set_allocated:caffe.LayerParameter.shard_data_param)
+}
+
 // optional .caffe.TransposeParameter transpose_param = 8266710;
 inline bool LayerParameter::has_transpose_param() const {
-  return (_has_bits_[2] & 0x00000001u) != 0;
+  return (_has_bits_[2] & 0x00000002u) != 0;
 }
 inline void LayerParameter::set_has_transpose_param() {
-  _has_bits_[2] |= 0x00000001u;
+  _has_bits_[2] |= 0x00000002u;
 }
 inline void LayerParameter::clear_has_transpose_param() {
-  _has_bits_[2] &= ~0x00000001u;
+  _has_bits_[2] &= ~0x00000002u;
 }
 inline void LayerParameter::clear_transpose_param() {
   if (transpose_param_ != NULL) transpose_param_->::caffe::TransposeParameter::Clear();
@@ -17710,6 +18790,7 @@ inline ::caffe::TransposeParameter* LayerParameter::mutable_transpose_param() {
   return transpose_param_;
 }
 inline ::caffe::TransposeParameter* LayerParameter::release_transpose_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.transpose_param)
   clear_has_transpose_param();
   ::caffe::TransposeParameter* temp = transpose_param_;
   transpose_param_ = NULL;
@@ -17728,13 +18809,13 @@ inline void LayerParameter::set_allocated_transpose_param(::caffe::TransposePara
 
 // optional .caffe.LSTMParameter lstm_param = 8266711;
 inline bool LayerParameter::has_lstm_param() const {
-  return (_has_bits_[2] & 0x00000002u) != 0;
+  return (_has_bits_[2] & 0x00000004u) != 0;
 }
 inline void LayerParameter::set_has_lstm_param() {
-  _has_bits_[2] |= 0x00000002u;
+  _has_bits_[2] |= 0x00000004u;
 }
 inline void LayerParameter::clear_has_lstm_param() {
-  _has_bits_[2] &= ~0x00000002u;
+  _has_bits_[2] &= ~0x00000004u;
 }
 inline void LayerParameter::clear_lstm_param() {
   if (lstm_param_ != NULL) lstm_param_->::caffe::LSTMParameter::Clear();
@@ -17753,6 +18834,7 @@ inline ::caffe::LSTMParameter* LayerParameter::mutable_lstm_param() {
   return lstm_param_;
 }
 inline ::caffe::LSTMParameter* LayerParameter::release_lstm_param() {
+  // @@protoc_insertion_point(field_release:caffe.LayerParameter.lstm_param)
   clear_has_lstm_param();
   ::caffe::LSTMParameter* temp = lstm_param_;
   lstm_param_ = NULL;
@@ -18016,6 +19098,7 @@ inline ::caffe::FillerParameter* DenseBlockParameter::mutable_filter_filler() {
   return filter_filler_;
 }
 inline ::caffe::FillerParameter* DenseBlockParameter::release_filter_filler() {
+  // @@protoc_insertion_point(field_release:caffe.DenseBlockParameter.Filter_Filler)
   clear_has_filter_filler();
   ::caffe::FillerParameter* temp = filter_filler_;
   filter_filler_ = NULL;
@@ -18059,6 +19142,7 @@ inline ::caffe::FillerParameter* DenseBlockParameter::mutable_bn_scaler_filler()
   return bn_scaler_filler_;
 }
 inline ::caffe::FillerParameter* DenseBlockParameter::release_bn_scaler_filler() {
+  // @@protoc_insertion_point(field_release:caffe.DenseBlockParameter.BN_Scaler_Filler)
   clear_has_bn_scaler_filler();
   ::caffe::FillerParameter* temp = bn_scaler_filler_;
   bn_scaler_filler_ = NULL;
@@ -18102,6 +19186,7 @@ inline ::caffe::FillerParameter* DenseBlockParameter::mutable_bn_bias_filler() {
   return bn_bias_filler_;
 }
 inline ::caffe::FillerParameter* DenseBlockParameter::release_bn_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.DenseBlockParameter.BN_Bias_Filler)
   clear_has_bn_bias_filler();
   ::caffe::FillerParameter* temp = bn_bias_filler_;
   bn_bias_filler_ = NULL;
@@ -18402,6 +19487,7 @@ inline ::std::string* TransformationParameter::mutable_mean_file() {
   return mean_file_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* TransformationParameter::release_mean_file() {
+  // @@protoc_insertion_point(field_release:caffe.TransformationParameter.mean_file)
   clear_has_mean_file();
   return mean_file_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -18619,6 +19705,78 @@ inline void TransformationParameter::set_crop_height(::google::protobuf::uint32
   // @@protoc_insertion_point(field_set:caffe.TransformationParameter.crop_height)
 }
 
+// optional uint32 decode_height = 13 [default = 0];
+inline bool TransformationParameter::has_decode_height() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void TransformationParameter::set_has_decode_height() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void TransformationParameter::clear_has_decode_height() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void TransformationParameter::clear_decode_height() {
+  decode_height_ = 0u;
+  clear_has_decode_height();
+}
+inline ::google::protobuf::uint32 TransformationParameter::decode_height() const {
+  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.decode_height)
+  return decode_height_;
+}
+inline void TransformationParameter::set_decode_height(::google::protobuf::uint32 value) {
+  set_has_decode_height();
+  decode_height_ = value;
+  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.decode_height)
+}
+
+// optional int32 decode_width = 14 [default = 0];
+inline bool TransformationParameter::has_decode_width() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void TransformationParameter::set_has_decode_width() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void TransformationParameter::clear_has_decode_width() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void TransformationParameter::clear_decode_width() {
+  decode_width_ = 0;
+  clear_has_decode_width();
+}
+inline ::google::protobuf::int32 TransformationParameter::decode_width() const {
+  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.decode_width)
+  return decode_width_;
+}
+inline void TransformationParameter::set_decode_width(::google::protobuf::int32 value) {
+  set_has_decode_width();
+  decode_width_ = value;
+  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.decode_width)
+}
+
+// optional bool reduced_decode = 15 [default = false];
+inline bool TransformationParameter::has_reduced_decode() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void TransformationParameter::set_has_reduced_decode() {
+  _has_bits_[0] |= 0x00004000u;
+}
+inline void TransformationParameter::clear_has_reduced_decode() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline void TransformationParameter::clear_reduced_decode() {
+  reduced_decode_ = false;
+  clear_has_reduced_decode();
+}
+inline bool TransformationParameter::reduced_decode() const {
+  // @@protoc_insertion_point(field_get:caffe.TransformationParameter.reduced_decode)
+  return reduced_decode_;
+}
+inline void TransformationParameter::set_reduced_decode(bool value) {
+  set_has_reduced_decode();
+  reduced_decode_ = value;
+  // @@protoc_insertion_point(field_set:caffe.TransformationParameter.reduced_decode)
+}
+
 // -------------------------------------------------------------------
 
 // LossParameter
@@ -18952,7 +20110,7 @@ inline void BatchNormParameter::set_moving_average_fraction(float value) {
   // @@protoc_insertion_point(field_set:caffe.BatchNormParameter.moving_average_fraction)
 }
 
-// optional float eps = 3 [default = 1e-005];
+// optional float eps = 3 [default = 1e-05];
 inline bool BatchNormParameter::has_eps() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
@@ -18963,7 +20121,7 @@ inline void BatchNormParameter::clear_has_eps() {
   _has_bits_[0] &= ~0x00000004u;
 }
 inline void BatchNormParameter::clear_eps() {
-  eps_ = 1e-005f;
+  eps_ = 1e-05f;
   clear_has_eps();
 }
 inline float BatchNormParameter::eps() const {
@@ -19079,6 +20237,7 @@ inline ::caffe::FillerParameter* BiasParameter::mutable_filler() {
   return filler_;
 }
 inline ::caffe::FillerParameter* BiasParameter::release_filler() {
+  // @@protoc_insertion_point(field_release:caffe.BiasParameter.filler)
   clear_has_filler();
   ::caffe::FillerParameter* temp = filler_;
   filler_ = NULL;
@@ -19514,6 +20673,7 @@ inline ::caffe::FillerParameter* ConvolutionParameter::mutable_weight_filler() {
   return weight_filler_;
 }
 inline ::caffe::FillerParameter* ConvolutionParameter::release_weight_filler() {
+  // @@protoc_insertion_point(field_release:caffe.ConvolutionParameter.weight_filler)
   clear_has_weight_filler();
   ::caffe::FillerParameter* temp = weight_filler_;
   weight_filler_ = NULL;
@@ -19557,6 +20717,7 @@ inline ::caffe::FillerParameter* ConvolutionParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* ConvolutionParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.ConvolutionParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -19646,6 +20807,30 @@ inline void ConvolutionParameter::set_force_nd_im2col(bool value) {
   // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.force_nd_im2col)
 }
 
+// optional bool fused_relu = 19 [default = false];
+inline bool ConvolutionParameter::has_fused_relu() const {
+  return (_has_bits_[0] & 0x00040000u) != 0;
+}
+inline void ConvolutionParameter::set_has_fused_relu() {
+  _has_bits_[0] |= 0x00040000u;
+}
+inline void ConvolutionParameter::clear_has_fused_relu() {
+  _has_bits_[0] &= ~0x00040000u;
+}
+inline void ConvolutionParameter::clear_fused_relu() {
+  fused_relu_ = false;
+  clear_has_fused_relu();
+}
+inline bool ConvolutionParameter::fused_relu() const {
+  // @@protoc_insertion_point(field_get:caffe.ConvolutionParameter.fused_relu)
+  return fused_relu_;
+}
+inline void ConvolutionParameter::set_fused_relu(bool value) {
+  set_has_fused_relu();
+  fused_relu_ = value;
+  // @@protoc_insertion_point(field_set:caffe.ConvolutionParameter.fused_relu)
+}
+
 // -------------------------------------------------------------------
 
 // CropParameter
@@ -19880,6 +21065,30 @@ inline void CTCLossParameter::set_loss_calculation_t(::google::protobuf::int32 v
   // @@protoc_insertion_point(field_set:caffe.CTCLossParameter.loss_calculation_t)
 }
 
+// optional uint32 input_stride = 6 [default = 0];
+inline bool CTCLossParameter::has_input_stride() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void CTCLossParameter::set_has_input_stride() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void CTCLossParameter::clear_has_input_stride() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void CTCLossParameter::clear_input_stride() {
+  input_stride_ = 0u;
+  clear_has_input_stride();
+}
+inline ::google::protobuf::uint32 CTCLossParameter::input_stride() const {
+  // @@protoc_insertion_point(field_get:caffe.CTCLossParameter.input_stride)
+  return input_stride_;
+}
+inline void CTCLossParameter::set_input_stride(::google::protobuf::uint32 value) {
+  set_has_input_stride();
+  input_stride_ = value;
+  // @@protoc_insertion_point(field_set:caffe.CTCLossParameter.input_stride)
+}
+
 // -------------------------------------------------------------------
 
 // DataParameter
@@ -19924,6 +21133,7 @@ inline ::std::string* DataParameter::mutable_source() {
   return source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* DataParameter::release_source() {
+  // @@protoc_insertion_point(field_release:caffe.DataParameter.source)
   clear_has_source();
   return source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -20074,6 +21284,7 @@ inline ::std::string* DataParameter::mutable_mean_file() {
   return mean_file_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* DataParameter::release_mean_file() {
+  // @@protoc_insertion_point(field_release:caffe.DataParameter.mean_file)
   clear_has_mean_file();
   return mean_file_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -20207,6 +21418,306 @@ inline void DataParameter::set_task_class_num(::google::protobuf::uint32 value)
   // @@protoc_insertion_point(field_set:caffe.DataParameter.task_class_num)
 }
 
+// optional uint32 num_workers = 12 [default = 1];
+inline bool DataParameter::has_num_workers() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void DataParameter::set_has_num_workers() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void DataParameter::clear_has_num_workers() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void DataParameter::clear_num_workers() {
+  num_workers_ = 1u;
+  clear_has_num_workers();
+}
+inline ::google::protobuf::uint32 DataParameter::num_workers() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.num_workers)
+  return num_workers_;
+}
+inline void DataParameter::set_num_workers(::google::protobuf::uint32 value) {
+  set_has_num_workers();
+  num_workers_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.num_workers)
+}
+
+// repeated uint32 bucket_width = 13;
+inline int DataParameter::bucket_width_size() const {
+  return bucket_width_.size();
+}
+inline void DataParameter::clear_bucket_width() {
+  bucket_width_.Clear();
+}
+inline ::google::protobuf::uint32 DataParameter::bucket_width(int index) const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.bucket_width)
+  return bucket_width_.Get(index);
+}
+inline void DataParameter::set_bucket_width(int index, ::google::protobuf::uint32 value) {
+  bucket_width_.Set(index, value);
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.bucket_width)
+}
+inline void DataParameter::add_bucket_width(::google::protobuf::uint32 value) {
+  bucket_width_.Add(value);
+  // @@protoc_insertion_point(field_add:caffe.DataParameter.bucket_width)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+DataParameter::bucket_width() const {
+  // @@protoc_insertion_point(field_list:caffe.DataParameter.bucket_width)
+  return bucket_width_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+DataParameter::mutable_bucket_width() {
+  // @@protoc_insertion_point(field_mutable_list:caffe.DataParameter.bucket_width)
+  return &bucket_width_;
+}
+
+// optional uint32 bucket_window = 14 [default = 512];
+inline bool DataParameter::has_bucket_window() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void DataParameter::set_has_bucket_window() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void DataParameter::clear_has_bucket_window() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void DataParameter::clear_bucket_window() {
+  bucket_window_ = 512u;
+  clear_has_bucket_window();
+}
+inline ::google::protobuf::uint32 DataParameter::bucket_window() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.bucket_window)
+  return bucket_window_;
+}
+inline void DataParameter::set_bucket_window(::google::protobuf::uint32 value) {
+  set_has_bucket_window();
+  bucket_window_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.bucket_window)
+}
+
+// optional float bucket_pad_value = 15 [default = 0];
+inline bool DataParameter::has_bucket_pad_value() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void DataParameter::set_has_bucket_pad_value() {
+  _has_bits_[0] |= 0x00004000u;
+}
+inline void DataParameter::clear_has_bucket_pad_value() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline void DataParameter::clear_bucket_pad_value() {
+  bucket_pad_value_ = 0;
+  clear_has_bucket_pad_value();
+}
+inline float DataParameter::bucket_pad_value() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.bucket_pad_value)
+  return bucket_pad_value_;
+}
+inline void DataParameter::set_bucket_pad_value(float value) {
+  set_has_bucket_pad_value();
+  bucket_pad_value_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.bucket_pad_value)
+}
+
+// optional bool shuffle = 16 [default = false];
+inline bool DataParameter::has_shuffle() const {
+  return (_has_bits_[0] & 0x00008000u) != 0;
+}
+inline void DataParameter::set_has_shuffle() {
+  _has_bits_[0] |= 0x00008000u;
+}
+inline void DataParameter::clear_has_shuffle() {
+  _has_bits_[0] &= ~0x00008000u;
+}
+inline void DataParameter::clear_shuffle() {
+  shuffle_ = false;
+  clear_has_shuffle();
+}
+inline bool DataParameter::shuffle() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.shuffle)
+  return shuffle_;
+}
+inline void DataParameter::set_shuffle(bool value) {
+  set_has_shuffle();
+  shuffle_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.shuffle)
+}
+
+// optional string key_index = 17;
+inline bool DataParameter::has_key_index() const {
+  return (_has_bits_[0] & 0x00010000u) != 0;
+}
+inline void DataParameter::set_has_key_index() {
+  _has_bits_[0] |= 0x00010000u;
+}
+inline void DataParameter::clear_has_key_index() {
+  _has_bits_[0] &= ~0x00010000u;
+}
+inline void DataParameter::clear_key_index() {
+  key_index_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_key_index();
+}
+inline const ::std::string& DataParameter::key_index() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.key_index)
+  return key_index_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void DataParameter::set_key_index(const ::std::string& value) {
+  set_has_key_index();
+  key_index_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.key_index)
+}
+inline void DataParameter::set_key_index(const char* value) {
+  set_has_key_index();
+  key_index_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:caffe.DataParameter.key_index)
+}
+inline void DataParameter::set_key_index(const char* value, size_t size) {
+  set_has_key_index();
+  key_index_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:caffe.DataParameter.key_index)
+}
+inline ::std::string* DataParameter::mutable_key_index() {
+  set_has_key_index();
+  // @@protoc_insertion_point(field_mutable:caffe.DataParameter.key_index)
+  return key_index_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* DataParameter::release_key_index() {
+  // @@protoc_insertion_point(field_release:caffe.DataParameter.key_index)
+  clear_has_key_index();
+  return key_index_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void DataParameter::set_allocated_key_index(::std::string* key_index) {
+  if (key_index != NULL) {
+    set_has_key_index();
+  } else {
+    clear_has_key_index();
+  }
+  key_index_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key_index);
+  // @@protoc_insertion_point(field_set_allocated:caffe.DataParameter.key_index)
+}
+
+// optional uint32 shuffle_buffer = 18 [default = 0];
+inline bool DataParameter::has_shuffle_buffer() const {
+  return (_has_bits_[0] & 0x00020000u) != 0;
+}
+inline void DataParameter::set_has_shuffle_buffer() {
+  _has_bits_[0] |= 0x00020000u;
+}
+inline void DataParameter::clear_has_shuffle_buffer() {
+  _has_bits_[0] &= ~0x00020000u;
+}
+inline void DataParameter::clear_shuffle_buffer() {
+  shuffle_buffer_ = 0u;
+  clear_has_shuffle_buffer();
+}
+inline ::google::protobuf::uint32 DataParameter::shuffle_buffer() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.shuffle_buffer)
+  return shuffle_buffer_;
+}
+inline void DataParameter::set_shuffle_buffer(::google::protobuf::uint32 value) {
+  set_has_shuffle_buffer();
+  shuffle_buffer_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.shuffle_buffer)
+}
+
+// optional uint64 sample_cache_bytes = 19 [default = 0];
+inline bool DataParameter::has_sample_cache_bytes() const {
+  return (_has_bits_[0] & 0x00040000u) != 0;
+}
+inline void DataParameter::set_has_sample_cache_bytes() {
+  _has_bits_[0] |= 0x00040000u;
+}
+inline void DataParameter::clear_has_sample_cache_bytes() {
+  _has_bits_[0] &= ~0x00040000u;
+}
+inline void DataParameter::clear_sample_cache_bytes() {
+  sample_cache_bytes_ = GOOGLE_ULONGLONG(0);
+  clear_has_sample_cache_bytes();
+}
+inline ::google::protobuf::uint64 DataParameter::sample_cache_bytes() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.sample_cache_bytes)
+  return sample_cache_bytes_;
+}
+inline void DataParameter::set_sample_cache_bytes(::google::protobuf::uint64 value) {
+  set_has_sample_cache_bytes();
+  sample_cache_bytes_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.sample_cache_bytes)
+}
+
+// optional bool sample_cache_compress = 20 [default = false];
+inline bool DataParameter::has_sample_cache_compress() const {
+  return (_has_bits_[0] & 0x00080000u) != 0;
+}
+inline void DataParameter::set_has_sample_cache_compress() {
+  _has_bits_[0] |= 0x00080000u;
+}
+inline void DataParameter::clear_has_sample_cache_compress() {
+  _has_bits_[0] &= ~0x00080000u;
+}
+inline void DataParameter::clear_sample_cache_compress() {
+  sample_cache_compress_ = false;
+  clear_has_sample_cache_compress();
+}
+inline bool DataParameter::sample_cache_compress() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.sample_cache_compress)
+  return sample_cache_compress_;
+}
+inline void DataParameter::set_sample_cache_compress(bool value) {
+  set_has_sample_cache_compress();
+  sample_cache_compress_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.sample_cache_compress)
+}
+
+// optional bool adaptive_prefetch = 21 [default = false];
+inline bool DataParameter::has_adaptive_prefetch() const {
+  return (_has_bits_[0] & 0x00100000u) != 0;
+}
+inline void DataParameter::set_has_adaptive_prefetch() {
+  _has_bits_[0] |= 0x00100000u;
+}
+inline void DataParameter::clear_has_adaptive_prefetch() {
+  _has_bits_[0] &= ~0x00100000u;
+}
+inline void DataParameter::clear_adaptive_prefetch() {
+  adaptive_prefetch_ = false;
+  clear_has_adaptive_prefetch();
+}
+inline bool DataParameter::adaptive_prefetch() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.adaptive_prefetch)
+  return adaptive_prefetch_;
+}
+inline void DataParameter::set_adaptive_prefetch(bool value) {
+  set_has_adaptive_prefetch();
+  adaptive_prefetch_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.adaptive_prefetch)
+}
+
+// optional uint64 prefetch_max_bytes = 22 [default = 1073741824];
+inline bool DataParameter::has_prefetch_max_bytes() const {
+  return (_has_bits_[0] & 0x00200000u) != 0;
+}
+inline void DataParameter::set_has_prefetch_max_bytes() {
+  _has_bits_[0] |= 0x00200000u;
+}
+inline void DataParameter::clear_has_prefetch_max_bytes() {
+  _has_bits_[0] &= ~0x00200000u;
+}
+inline void DataParameter::clear_prefetch_max_bytes() {
+  prefetch_max_bytes_ = GOOGLE_ULONGLONG(1073741824);
+  clear_has_prefetch_max_bytes();
+}
+inline ::google::protobuf::uint64 DataParameter::prefetch_max_bytes() const {
+  // @@protoc_insertion_point(field_get:caffe.DataParameter.prefetch_max_bytes)
+  return prefetch_max_bytes_;
+}
+inline void DataParameter::set_prefetch_max_bytes(::google::protobuf::uint64 value) {
+  set_has_prefetch_max_bytes();
+  prefetch_max_bytes_ = value;
+  // @@protoc_insertion_point(field_set:caffe.DataParameter.prefetch_max_bytes)
+}
+
 // -------------------------------------------------------------------
 
 // DropoutParameter
@@ -20258,16 +21769,16 @@ inline ::caffe::FillerParameter* DummyDataParameter::add_data_filler() {
   // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.data_filler)
   return data_filler_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >&
-DummyDataParameter::data_filler() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.data_filler)
-  return data_filler_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >*
 DummyDataParameter::mutable_data_filler() {
   // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.data_filler)
   return &data_filler_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::FillerParameter >&
+DummyDataParameter::data_filler() const {
+  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.data_filler)
+  return data_filler_;
+}
 
 // repeated .caffe.BlobShape shape = 6;
 inline int DummyDataParameter::shape_size() const {
@@ -20288,16 +21799,16 @@ inline ::caffe::BlobShape* DummyDataParameter::add_shape() {
   // @@protoc_insertion_point(field_add:caffe.DummyDataParameter.shape)
   return shape_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-DummyDataParameter::shape() const {
-  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.shape)
-  return shape_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
 DummyDataParameter::mutable_shape() {
   // @@protoc_insertion_point(field_mutable_list:caffe.DummyDataParameter.shape)
   return &shape_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
+DummyDataParameter::shape() const {
+  // @@protoc_insertion_point(field_list:caffe.DummyDataParameter.shape)
+  return shape_;
+}
 
 // repeated uint32 num = 2;
 inline int DummyDataParameter::num_size() const {
@@ -20633,6 +22144,7 @@ inline ::caffe::FillerParameter* EmbedParameter::mutable_weight_filler() {
   return weight_filler_;
 }
 inline ::caffe::FillerParameter* EmbedParameter::release_weight_filler() {
+  // @@protoc_insertion_point(field_release:caffe.EmbedParameter.weight_filler)
   clear_has_weight_filler();
   ::caffe::FillerParameter* temp = weight_filler_;
   weight_filler_ = NULL;
@@ -20676,6 +22188,7 @@ inline ::caffe::FillerParameter* EmbedParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* EmbedParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.EmbedParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -20864,6 +22377,7 @@ inline ::std::string* HDF5DataParameter::mutable_source() {
   return source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* HDF5DataParameter::release_source() {
+  // @@protoc_insertion_point(field_release:caffe.HDF5DataParameter.source)
   clear_has_source();
   return source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -20969,6 +22483,7 @@ inline ::std::string* HDF5OutputParameter::mutable_file_name() {
   return file_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* HDF5OutputParameter::release_file_name() {
+  // @@protoc_insertion_point(field_release:caffe.HDF5OutputParameter.file_name)
   clear_has_file_name();
   return file_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -21055,6 +22570,7 @@ inline ::std::string* ImageDataParameter::mutable_source() {
   return source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* ImageDataParameter::release_source() {
+  // @@protoc_insertion_point(field_release:caffe.ImageDataParameter.source)
   clear_has_source();
   return source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -21276,6 +22792,7 @@ inline ::std::string* ImageDataParameter::mutable_mean_file() {
   return mean_file_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* ImageDataParameter::release_mean_file() {
+  // @@protoc_insertion_point(field_release:caffe.ImageDataParameter.mean_file)
   clear_has_mean_file();
   return mean_file_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -21377,6 +22894,7 @@ inline ::std::string* ImageDataParameter::mutable_root_folder() {
   return root_folder_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* ImageDataParameter::release_root_folder() {
+  // @@protoc_insertion_point(field_release:caffe.ImageDataParameter.root_folder)
   clear_has_root_folder();
   return root_folder_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -21428,14 +22946,92 @@ inline void ImageDataParameter::clear_regression() {
   regression_ = false;
   clear_has_regression();
 }
-inline bool ImageDataParameter::regression() const {
-  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.regression)
-  return regression_;
+inline bool ImageDataParameter::regression() const {
+  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.regression)
+  return regression_;
+}
+inline void ImageDataParameter::set_regression(bool value) {
+  set_has_regression();
+  regression_ = value;
+  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.regression)
+}
+
+// optional bool reduced_decode = 15 [default = false];
+inline bool ImageDataParameter::has_reduced_decode() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void ImageDataParameter::set_has_reduced_decode() {
+  _has_bits_[0] |= 0x00004000u;
+}
+inline void ImageDataParameter::clear_has_reduced_decode() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline void ImageDataParameter::clear_reduced_decode() {
+  reduced_decode_ = false;
+  clear_has_reduced_decode();
+}
+inline bool ImageDataParameter::reduced_decode() const {
+  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.reduced_decode)
+  return reduced_decode_;
+}
+inline void ImageDataParameter::set_reduced_decode(bool value) {
+  set_has_reduced_decode();
+  reduced_decode_ = value;
+  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.reduced_decode)
+}
+
+// optional string list_index = 16;
+inline bool ImageDataParameter::has_list_index() const {
+  return (_has_bits_[0] & 0x00008000u) != 0;
+}
+inline void ImageDataParameter::set_has_list_index() {
+  _has_bits_[0] |= 0x00008000u;
+}
+inline void ImageDataParameter::clear_has_list_index() {
+  _has_bits_[0] &= ~0x00008000u;
+}
+inline void ImageDataParameter::clear_list_index() {
+  list_index_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_list_index();
+}
+inline const ::std::string& ImageDataParameter::list_index() const {
+  // @@protoc_insertion_point(field_get:caffe.ImageDataParameter.list_index)
+  return list_index_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void ImageDataParameter::set_list_index(const ::std::string& value) {
+  set_has_list_index();
+  list_index_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.list_index)
+}
+inline void ImageDataParameter::set_list_index(const char* value) {
+  set_has_list_index();
+  list_index_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:caffe.ImageDataParameter.list_index)
+}
+inline void ImageDataParameter::set_list_index(const char* value, size_t size) {
+  set_has_list_index();
+  list_index_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:caffe.ImageDataParameter.list_index)
+}
+inline ::std::string* ImageDataParameter::mutable_list_index() {
+  set_has_list_index();
+  // @@protoc_insertion_point(field_mutable:caffe.ImageDataParameter.list_index)
+  return list_index_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* ImageDataParameter::release_list_index() {
+  // @@protoc_insertion_point(field_release:caffe.ImageDataParameter.list_index)
+  clear_has_list_index();
+  return list_index_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ImageDataParameter::set_regression(bool value) {
-  set_has_regression();
-  regression_ = value;
-  // @@protoc_insertion_point(field_set:caffe.ImageDataParameter.regression)
+inline void ImageDataParameter::set_allocated_list_index(::std::string* list_index) {
+  if (list_index != NULL) {
+    set_has_list_index();
+  } else {
+    clear_has_list_index();
+  }
+  list_index_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), list_index);
+  // @@protoc_insertion_point(field_set_allocated:caffe.ImageDataParameter.list_index)
 }
 
 // -------------------------------------------------------------------
@@ -21482,6 +23078,7 @@ inline ::std::string* InfogainLossParameter::mutable_source() {
   return source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* InfogainLossParameter::release_source() {
+  // @@protoc_insertion_point(field_release:caffe.InfogainLossParameter.source)
   clear_has_source();
   return source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -21574,6 +23171,7 @@ inline ::caffe::FillerParameter* InnerProductParameter::mutable_weight_filler()
   return weight_filler_;
 }
 inline ::caffe::FillerParameter* InnerProductParameter::release_weight_filler() {
+  // @@protoc_insertion_point(field_release:caffe.InnerProductParameter.weight_filler)
   clear_has_weight_filler();
   ::caffe::FillerParameter* temp = weight_filler_;
   weight_filler_ = NULL;
@@ -21617,6 +23215,7 @@ inline ::caffe::FillerParameter* InnerProductParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* InnerProductParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.InnerProductParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -21704,16 +23303,16 @@ inline ::caffe::BlobShape* InputParameter::add_shape() {
   // @@protoc_insertion_point(field_add:caffe.InputParameter.shape)
   return shape_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
-InputParameter::shape() const {
-  // @@protoc_insertion_point(field_list:caffe.InputParameter.shape)
-  return shape_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >*
 InputParameter::mutable_shape() {
   // @@protoc_insertion_point(field_mutable_list:caffe.InputParameter.shape)
   return &shape_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobShape >&
+InputParameter::shape() const {
+  // @@protoc_insertion_point(field_list:caffe.InputParameter.shape)
+  return shape_;
+}
 
 // -------------------------------------------------------------------
 
@@ -22265,7 +23864,7 @@ inline void MVNParameter::set_across_channels(bool value) {
   // @@protoc_insertion_point(field_set:caffe.MVNParameter.across_channels)
 }
 
-// optional float eps = 3 [default = 1e-009];
+// optional float eps = 3 [default = 1e-09];
 inline bool MVNParameter::has_eps() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
@@ -22276,7 +23875,7 @@ inline void MVNParameter::clear_has_eps() {
   _has_bits_[0] &= ~0x00000004u;
 }
 inline void MVNParameter::clear_eps() {
-  eps_ = 1e-009f;
+  eps_ = 1e-09f;
   clear_has_eps();
 }
 inline float MVNParameter::eps() const {
@@ -22320,6 +23919,7 @@ inline ::caffe::BlobShape* ParameterParameter::mutable_shape() {
   return shape_;
 }
 inline ::caffe::BlobShape* ParameterParameter::release_shape() {
+  // @@protoc_insertion_point(field_release:caffe.ParameterParameter.shape)
   clear_has_shape();
   ::caffe::BlobShape* temp = shape_;
   shape_ = NULL;
@@ -22750,6 +24350,7 @@ inline ::std::string* PythonParameter::mutable_module() {
   return module_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* PythonParameter::release_module() {
+  // @@protoc_insertion_point(field_release:caffe.PythonParameter.module)
   clear_has_module();
   return module_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -22803,6 +24404,7 @@ inline ::std::string* PythonParameter::mutable_layer() {
   return layer_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* PythonParameter::release_layer() {
+  // @@protoc_insertion_point(field_release:caffe.PythonParameter.layer)
   clear_has_layer();
   return layer_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -22856,6 +24458,7 @@ inline ::std::string* PythonParameter::mutable_param_str() {
   return param_str_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* PythonParameter::release_param_str() {
+  // @@protoc_insertion_point(field_release:caffe.PythonParameter.param_str)
   clear_has_param_str();
   return param_str_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -22948,6 +24551,7 @@ inline ::caffe::FillerParameter* RecurrentParameter::mutable_weight_filler() {
   return weight_filler_;
 }
 inline ::caffe::FillerParameter* RecurrentParameter::release_weight_filler() {
+  // @@protoc_insertion_point(field_release:caffe.RecurrentParameter.weight_filler)
   clear_has_weight_filler();
   ::caffe::FillerParameter* temp = weight_filler_;
   weight_filler_ = NULL;
@@ -22991,6 +24595,7 @@ inline ::caffe::FillerParameter* RecurrentParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* RecurrentParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.RecurrentParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -23134,6 +24739,7 @@ inline ::caffe::FillerParameter* LSTMParameter::mutable_weight_filler() {
   return weight_filler_;
 }
 inline ::caffe::FillerParameter* LSTMParameter::release_weight_filler() {
+  // @@protoc_insertion_point(field_release:caffe.LSTMParameter.weight_filler)
   clear_has_weight_filler();
   ::caffe::FillerParameter* temp = weight_filler_;
   weight_filler_ = NULL;
@@ -23177,6 +24783,7 @@ inline ::caffe::FillerParameter* LSTMParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* LSTMParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.LSTMParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -23378,6 +24985,7 @@ inline ::caffe::BlobShape* ReshapeParameter::mutable_shape() {
   return shape_;
 }
 inline ::caffe::BlobShape* ReshapeParameter::release_shape() {
+  // @@protoc_insertion_point(field_release:caffe.ReshapeParameter.shape)
   clear_has_shape();
   ::caffe::BlobShape* temp = shape_;
   shape_ = NULL;
@@ -23577,6 +25185,7 @@ inline ::caffe::FillerParameter* ScaleParameter::mutable_filler() {
   return filler_;
 }
 inline ::caffe::FillerParameter* ScaleParameter::release_filler() {
+  // @@protoc_insertion_point(field_release:caffe.ScaleParameter.filler)
   clear_has_filler();
   ::caffe::FillerParameter* temp = filler_;
   filler_ = NULL;
@@ -23644,6 +25253,7 @@ inline ::caffe::FillerParameter* ScaleParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* ScaleParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.ScaleParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -23662,6 +25272,137 @@ inline void ScaleParameter::set_allocated_bias_filler(::caffe::FillerParameter*
 
 // -------------------------------------------------------------------
 
+// ShardDataParameter
+
+// repeated string source = 1;
+inline int ShardDataParameter::source_size() const {
+  return source_.size();
+}
+inline void ShardDataParameter::clear_source() {
+  source_.Clear();
+}
+inline const ::std::string& ShardDataParameter::source(int index) const {
+  // @@protoc_insertion_point(field_get:caffe.ShardDataParameter.source)
+  return source_.Get(index);
+}
+inline ::std::string* ShardDataParameter::mutable_source(int index) {
+  // @@protoc_insertion_point(field_mutable:caffe.ShardDataParameter.source)
+  return source_.Mutable(index);
+}
+inline void ShardDataParameter::set_source(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:caffe.ShardDataParameter.source)
+  source_.Mutable(index)->assign(value);
+}
+inline void ShardDataParameter::set_source(int index, const char* value) {
+  source_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:caffe.ShardDataParameter.source)
+}
+inline void ShardDataParameter::set_source(int index, const char* value, size_t size) {
+  source_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:caffe.ShardDataParameter.source)
+}
+inline ::std::string* ShardDataParameter::add_source() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.ShardDataParameter.source)
+  return source_.Add();
+}
+inline void ShardDataParameter::add_source(const ::std::string& value) {
+  source_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:caffe.ShardDataParameter.source)
+}
+inline void ShardDataParameter::add_source(const char* value) {
+  source_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:caffe.ShardDataParameter.source)
+}
+inline void ShardDataParameter::add_source(const char* value, size_t size) {
+  source_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:caffe.ShardDataParameter.source)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ShardDataParameter::source() const {
+  // @@protoc_insertion_point(field_list:caffe.ShardDataParameter.source)
+  return source_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+ShardDataParameter::mutable_source() {
+  // @@protoc_insertion_point(field_mutable_list:caffe.ShardDataParameter.source)
+  return &source_;
+}
+
+// optional uint32 batch_size = 2 [default = 1];
+inline bool ShardDataParameter::has_batch_size() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ShardDataParameter::set_has_batch_size() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ShardDataParameter::clear_has_batch_size() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ShardDataParameter::clear_batch_size() {
+  batch_size_ = 1u;
+  clear_has_batch_size();
+}
+inline ::google::protobuf::uint32 ShardDataParameter::batch_size() const {
+  // @@protoc_insertion_point(field_get:caffe.ShardDataParameter.batch_size)
+  return batch_size_;
+}
+inline void ShardDataParameter::set_batch_size(::google::protobuf::uint32 value) {
+  set_has_batch_size();
+  batch_size_ = value;
+  // @@protoc_insertion_point(field_set:caffe.ShardDataParameter.batch_size)
+}
+
+// optional bool shuffle = 3 [default = true];
+inline bool ShardDataParameter::has_shuffle() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ShardDataParameter::set_has_shuffle() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ShardDataParameter::clear_has_shuffle() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ShardDataParameter::clear_shuffle() {
+  shuffle_ = true;
+  clear_has_shuffle();
+}
+inline bool ShardDataParameter::shuffle() const {
+  // @@protoc_insertion_point(field_get:caffe.ShardDataParameter.shuffle)
+  return shuffle_;
+}
+inline void ShardDataParameter::set_shuffle(bool value) {
+  set_has_shuffle();
+  shuffle_ = value;
+  // @@protoc_insertion_point(field_set:caffe.ShardDataParameter.shuffle)
+}
+
+// optional float pad_value = 4 [default = 0];
+inline bool ShardDataParameter::has_pad_value() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void ShardDataParameter::set_has_pad_value() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void ShardDataParameter::clear_has_pad_value() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void ShardDataParameter::clear_pad_value() {
+  pad_value_ = 0;
+  clear_has_pad_value();
+}
+inline float ShardDataParameter::pad_value() const {
+  // @@protoc_insertion_point(field_get:caffe.ShardDataParameter.pad_value)
+  return pad_value_;
+}
+inline void ShardDataParameter::set_pad_value(float value) {
+  set_has_pad_value();
+  pad_value_ = value;
+  // @@protoc_insertion_point(field_set:caffe.ShardDataParameter.pad_value)
+}
+
+// -------------------------------------------------------------------
+
 // SigmoidParameter
 
 // optional .caffe.SigmoidParameter.Engine engine = 1 [default = DEFAULT];
@@ -23977,6 +25718,7 @@ inline ::std::string* WindowDataParameter::mutable_source() {
   return source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* WindowDataParameter::release_source() {
+  // @@protoc_insertion_point(field_release:caffe.WindowDataParameter.source)
   clear_has_source();
   return source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -24054,6 +25796,7 @@ inline ::std::string* WindowDataParameter::mutable_mean_file() {
   return mean_file_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* WindowDataParameter::release_mean_file() {
+  // @@protoc_insertion_point(field_release:caffe.WindowDataParameter.mean_file)
   clear_has_mean_file();
   return mean_file_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -24275,6 +26018,7 @@ inline ::std::string* WindowDataParameter::mutable_crop_mode() {
   return crop_mode_.MutableNoArena(_default_crop_mode_);
 }
 inline ::std::string* WindowDataParameter::release_crop_mode() {
+  // @@protoc_insertion_point(field_release:caffe.WindowDataParameter.crop_mode)
   clear_has_crop_mode();
   return crop_mode_.ReleaseNoArena(_default_crop_mode_);
 }
@@ -24352,6 +26096,7 @@ inline ::std::string* WindowDataParameter::mutable_root_folder() {
   return root_folder_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* WindowDataParameter::release_root_folder() {
+  // @@protoc_insertion_point(field_release:caffe.WindowDataParameter.root_folder)
   clear_has_root_folder();
   return root_folder_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -24476,6 +26221,7 @@ inline void V1LayerParameter::set_bottom(int index, const char* value, size_t si
   // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.bottom)
 }
 inline ::std::string* V1LayerParameter::add_bottom() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.V1LayerParameter.bottom)
   return bottom_.Add();
 }
 inline void V1LayerParameter::add_bottom(const ::std::string& value) {
@@ -24530,6 +26276,7 @@ inline void V1LayerParameter::set_top(int index, const char* value, size_t size)
   // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.top)
 }
 inline ::std::string* V1LayerParameter::add_top() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.V1LayerParameter.top)
   return top_.Add();
 }
 inline void V1LayerParameter::add_top(const ::std::string& value) {
@@ -24595,6 +26342,7 @@ inline ::std::string* V1LayerParameter::mutable_name() {
   return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* V1LayerParameter::release_name() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.name)
   clear_has_name();
   return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -24627,16 +26375,16 @@ inline ::caffe::NetStateRule* V1LayerParameter::add_include() {
   // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.include)
   return include_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-V1LayerParameter::include() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.include)
-  return include_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
 V1LayerParameter::mutable_include() {
   // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.include)
   return &include_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+V1LayerParameter::include() const {
+  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.include)
+  return include_;
+}
 
 // repeated .caffe.NetStateRule exclude = 33;
 inline int V1LayerParameter::exclude_size() const {
@@ -24657,16 +26405,16 @@ inline ::caffe::NetStateRule* V1LayerParameter::add_exclude() {
   // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.exclude)
   return exclude_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
-V1LayerParameter::exclude() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.exclude)
-  return exclude_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >*
 V1LayerParameter::mutable_exclude() {
   // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.exclude)
   return &exclude_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::NetStateRule >&
+V1LayerParameter::exclude() const {
+  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.exclude)
+  return exclude_;
+}
 
 // optional .caffe.V1LayerParameter.LayerType type = 5;
 inline bool V1LayerParameter::has_type() const {
@@ -24712,16 +26460,16 @@ inline ::caffe::BlobProto* V1LayerParameter::add_blobs() {
   // @@protoc_insertion_point(field_add:caffe.V1LayerParameter.blobs)
   return blobs_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-V1LayerParameter::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.blobs)
-  return blobs_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
 V1LayerParameter::mutable_blobs() {
   // @@protoc_insertion_point(field_mutable_list:caffe.V1LayerParameter.blobs)
   return &blobs_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+V1LayerParameter::blobs() const {
+  // @@protoc_insertion_point(field_list:caffe.V1LayerParameter.blobs)
+  return blobs_;
+}
 
 // repeated string param = 1001;
 inline int V1LayerParameter::param_size() const {
@@ -24752,6 +26500,7 @@ inline void V1LayerParameter::set_param(int index, const char* value, size_t siz
   // @@protoc_insertion_point(field_set_pointer:caffe.V1LayerParameter.param)
 }
 inline ::std::string* V1LayerParameter::add_param() {
+  // @@protoc_insertion_point(field_add_mutable:caffe.V1LayerParameter.param)
   return param_.Add();
 }
 inline void V1LayerParameter::add_param(const ::std::string& value) {
@@ -24926,6 +26675,7 @@ inline ::caffe::AccuracyParameter* V1LayerParameter::mutable_accuracy_param() {
   return accuracy_param_;
 }
 inline ::caffe::AccuracyParameter* V1LayerParameter::release_accuracy_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.accuracy_param)
   clear_has_accuracy_param();
   ::caffe::AccuracyParameter* temp = accuracy_param_;
   accuracy_param_ = NULL;
@@ -24969,6 +26719,7 @@ inline ::caffe::ArgMaxParameter* V1LayerParameter::mutable_argmax_param() {
   return argmax_param_;
 }
 inline ::caffe::ArgMaxParameter* V1LayerParameter::release_argmax_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.argmax_param)
   clear_has_argmax_param();
   ::caffe::ArgMaxParameter* temp = argmax_param_;
   argmax_param_ = NULL;
@@ -25012,6 +26763,7 @@ inline ::caffe::ConcatParameter* V1LayerParameter::mutable_concat_param() {
   return concat_param_;
 }
 inline ::caffe::ConcatParameter* V1LayerParameter::release_concat_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.concat_param)
   clear_has_concat_param();
   ::caffe::ConcatParameter* temp = concat_param_;
   concat_param_ = NULL;
@@ -25055,6 +26807,7 @@ inline ::caffe::ContrastiveLossParameter* V1LayerParameter::mutable_contrastive_
   return contrastive_loss_param_;
 }
 inline ::caffe::ContrastiveLossParameter* V1LayerParameter::release_contrastive_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.contrastive_loss_param)
   clear_has_contrastive_loss_param();
   ::caffe::ContrastiveLossParameter* temp = contrastive_loss_param_;
   contrastive_loss_param_ = NULL;
@@ -25098,6 +26851,7 @@ inline ::caffe::ConvolutionParameter* V1LayerParameter::mutable_convolution_para
   return convolution_param_;
 }
 inline ::caffe::ConvolutionParameter* V1LayerParameter::release_convolution_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.convolution_param)
   clear_has_convolution_param();
   ::caffe::ConvolutionParameter* temp = convolution_param_;
   convolution_param_ = NULL;
@@ -25141,6 +26895,7 @@ inline ::caffe::DataParameter* V1LayerParameter::mutable_data_param() {
   return data_param_;
 }
 inline ::caffe::DataParameter* V1LayerParameter::release_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.data_param)
   clear_has_data_param();
   ::caffe::DataParameter* temp = data_param_;
   data_param_ = NULL;
@@ -25184,6 +26939,7 @@ inline ::caffe::DropoutParameter* V1LayerParameter::mutable_dropout_param() {
   return dropout_param_;
 }
 inline ::caffe::DropoutParameter* V1LayerParameter::release_dropout_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.dropout_param)
   clear_has_dropout_param();
   ::caffe::DropoutParameter* temp = dropout_param_;
   dropout_param_ = NULL;
@@ -25227,6 +26983,7 @@ inline ::caffe::DummyDataParameter* V1LayerParameter::mutable_dummy_data_param()
   return dummy_data_param_;
 }
 inline ::caffe::DummyDataParameter* V1LayerParameter::release_dummy_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.dummy_data_param)
   clear_has_dummy_data_param();
   ::caffe::DummyDataParameter* temp = dummy_data_param_;
   dummy_data_param_ = NULL;
@@ -25270,6 +27027,7 @@ inline ::caffe::EltwiseParameter* V1LayerParameter::mutable_eltwise_param() {
   return eltwise_param_;
 }
 inline ::caffe::EltwiseParameter* V1LayerParameter::release_eltwise_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.eltwise_param)
   clear_has_eltwise_param();
   ::caffe::EltwiseParameter* temp = eltwise_param_;
   eltwise_param_ = NULL;
@@ -25313,6 +27071,7 @@ inline ::caffe::ExpParameter* V1LayerParameter::mutable_exp_param() {
   return exp_param_;
 }
 inline ::caffe::ExpParameter* V1LayerParameter::release_exp_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.exp_param)
   clear_has_exp_param();
   ::caffe::ExpParameter* temp = exp_param_;
   exp_param_ = NULL;
@@ -25356,6 +27115,7 @@ inline ::caffe::HDF5DataParameter* V1LayerParameter::mutable_hdf5_data_param() {
   return hdf5_data_param_;
 }
 inline ::caffe::HDF5DataParameter* V1LayerParameter::release_hdf5_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.hdf5_data_param)
   clear_has_hdf5_data_param();
   ::caffe::HDF5DataParameter* temp = hdf5_data_param_;
   hdf5_data_param_ = NULL;
@@ -25399,6 +27159,7 @@ inline ::caffe::HDF5OutputParameter* V1LayerParameter::mutable_hdf5_output_param
   return hdf5_output_param_;
 }
 inline ::caffe::HDF5OutputParameter* V1LayerParameter::release_hdf5_output_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.hdf5_output_param)
   clear_has_hdf5_output_param();
   ::caffe::HDF5OutputParameter* temp = hdf5_output_param_;
   hdf5_output_param_ = NULL;
@@ -25442,6 +27203,7 @@ inline ::caffe::HingeLossParameter* V1LayerParameter::mutable_hinge_loss_param()
   return hinge_loss_param_;
 }
 inline ::caffe::HingeLossParameter* V1LayerParameter::release_hinge_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.hinge_loss_param)
   clear_has_hinge_loss_param();
   ::caffe::HingeLossParameter* temp = hinge_loss_param_;
   hinge_loss_param_ = NULL;
@@ -25485,6 +27247,7 @@ inline ::caffe::ImageDataParameter* V1LayerParameter::mutable_image_data_param()
   return image_data_param_;
 }
 inline ::caffe::ImageDataParameter* V1LayerParameter::release_image_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.image_data_param)
   clear_has_image_data_param();
   ::caffe::ImageDataParameter* temp = image_data_param_;
   image_data_param_ = NULL;
@@ -25528,6 +27291,7 @@ inline ::caffe::InfogainLossParameter* V1LayerParameter::mutable_infogain_loss_p
   return infogain_loss_param_;
 }
 inline ::caffe::InfogainLossParameter* V1LayerParameter::release_infogain_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.infogain_loss_param)
   clear_has_infogain_loss_param();
   ::caffe::InfogainLossParameter* temp = infogain_loss_param_;
   infogain_loss_param_ = NULL;
@@ -25571,6 +27335,7 @@ inline ::caffe::InnerProductParameter* V1LayerParameter::mutable_inner_product_p
   return inner_product_param_;
 }
 inline ::caffe::InnerProductParameter* V1LayerParameter::release_inner_product_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.inner_product_param)
   clear_has_inner_product_param();
   ::caffe::InnerProductParameter* temp = inner_product_param_;
   inner_product_param_ = NULL;
@@ -25614,6 +27379,7 @@ inline ::caffe::LRNParameter* V1LayerParameter::mutable_lrn_param() {
   return lrn_param_;
 }
 inline ::caffe::LRNParameter* V1LayerParameter::release_lrn_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.lrn_param)
   clear_has_lrn_param();
   ::caffe::LRNParameter* temp = lrn_param_;
   lrn_param_ = NULL;
@@ -25657,6 +27423,7 @@ inline ::caffe::MemoryDataParameter* V1LayerParameter::mutable_memory_data_param
   return memory_data_param_;
 }
 inline ::caffe::MemoryDataParameter* V1LayerParameter::release_memory_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.memory_data_param)
   clear_has_memory_data_param();
   ::caffe::MemoryDataParameter* temp = memory_data_param_;
   memory_data_param_ = NULL;
@@ -25700,6 +27467,7 @@ inline ::caffe::MVNParameter* V1LayerParameter::mutable_mvn_param() {
   return mvn_param_;
 }
 inline ::caffe::MVNParameter* V1LayerParameter::release_mvn_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.mvn_param)
   clear_has_mvn_param();
   ::caffe::MVNParameter* temp = mvn_param_;
   mvn_param_ = NULL;
@@ -25743,6 +27511,7 @@ inline ::caffe::PoolingParameter* V1LayerParameter::mutable_pooling_param() {
   return pooling_param_;
 }
 inline ::caffe::PoolingParameter* V1LayerParameter::release_pooling_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.pooling_param)
   clear_has_pooling_param();
   ::caffe::PoolingParameter* temp = pooling_param_;
   pooling_param_ = NULL;
@@ -25786,6 +27555,7 @@ inline ::caffe::PowerParameter* V1LayerParameter::mutable_power_param() {
   return power_param_;
 }
 inline ::caffe::PowerParameter* V1LayerParameter::release_power_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.power_param)
   clear_has_power_param();
   ::caffe::PowerParameter* temp = power_param_;
   power_param_ = NULL;
@@ -25829,6 +27599,7 @@ inline ::caffe::ReLUParameter* V1LayerParameter::mutable_relu_param() {
   return relu_param_;
 }
 inline ::caffe::ReLUParameter* V1LayerParameter::release_relu_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.relu_param)
   clear_has_relu_param();
   ::caffe::ReLUParameter* temp = relu_param_;
   relu_param_ = NULL;
@@ -25872,6 +27643,7 @@ inline ::caffe::SigmoidParameter* V1LayerParameter::mutable_sigmoid_param() {
   return sigmoid_param_;
 }
 inline ::caffe::SigmoidParameter* V1LayerParameter::release_sigmoid_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.sigmoid_param)
   clear_has_sigmoid_param();
   ::caffe::SigmoidParameter* temp = sigmoid_param_;
   sigmoid_param_ = NULL;
@@ -25915,6 +27687,7 @@ inline ::caffe::SoftmaxParameter* V1LayerParameter::mutable_softmax_param() {
   return softmax_param_;
 }
 inline ::caffe::SoftmaxParameter* V1LayerParameter::release_softmax_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.softmax_param)
   clear_has_softmax_param();
   ::caffe::SoftmaxParameter* temp = softmax_param_;
   softmax_param_ = NULL;
@@ -25958,6 +27731,7 @@ inline ::caffe::SliceParameter* V1LayerParameter::mutable_slice_param() {
   return slice_param_;
 }
 inline ::caffe::SliceParameter* V1LayerParameter::release_slice_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.slice_param)
   clear_has_slice_param();
   ::caffe::SliceParameter* temp = slice_param_;
   slice_param_ = NULL;
@@ -26001,6 +27775,7 @@ inline ::caffe::TanHParameter* V1LayerParameter::mutable_tanh_param() {
   return tanh_param_;
 }
 inline ::caffe::TanHParameter* V1LayerParameter::release_tanh_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.tanh_param)
   clear_has_tanh_param();
   ::caffe::TanHParameter* temp = tanh_param_;
   tanh_param_ = NULL;
@@ -26044,6 +27819,7 @@ inline ::caffe::ThresholdParameter* V1LayerParameter::mutable_threshold_param()
   return threshold_param_;
 }
 inline ::caffe::ThresholdParameter* V1LayerParameter::release_threshold_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.threshold_param)
   clear_has_threshold_param();
   ::caffe::ThresholdParameter* temp = threshold_param_;
   threshold_param_ = NULL;
@@ -26087,6 +27863,7 @@ inline ::caffe::WindowDataParameter* V1LayerParameter::mutable_window_data_param
   return window_data_param_;
 }
 inline ::caffe::WindowDataParameter* V1LayerParameter::release_window_data_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.window_data_param)
   clear_has_window_data_param();
   ::caffe::WindowDataParameter* temp = window_data_param_;
   window_data_param_ = NULL;
@@ -26130,6 +27907,7 @@ inline ::caffe::TransformationParameter* V1LayerParameter::mutable_transform_par
   return transform_param_;
 }
 inline ::caffe::TransformationParameter* V1LayerParameter::release_transform_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.transform_param)
   clear_has_transform_param();
   ::caffe::TransformationParameter* temp = transform_param_;
   transform_param_ = NULL;
@@ -26173,6 +27951,7 @@ inline ::caffe::LossParameter* V1LayerParameter::mutable_loss_param() {
   return loss_param_;
 }
 inline ::caffe::LossParameter* V1LayerParameter::release_loss_param() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.loss_param)
   clear_has_loss_param();
   ::caffe::LossParameter* temp = loss_param_;
   loss_param_ = NULL;
@@ -26216,6 +27995,7 @@ inline ::caffe::V0LayerParameter* V1LayerParameter::mutable_layer() {
   return layer_;
 }
 inline ::caffe::V0LayerParameter* V1LayerParameter::release_layer() {
+  // @@protoc_insertion_point(field_release:caffe.V1LayerParameter.layer)
   clear_has_layer();
   ::caffe::V0LayerParameter* temp = layer_;
   layer_ = NULL;
@@ -26276,6 +28056,7 @@ inline ::std::string* V0LayerParameter::mutable_name() {
   return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* V0LayerParameter::release_name() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.name)
   clear_has_name();
   return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -26329,6 +28110,7 @@ inline ::std::string* V0LayerParameter::mutable_type() {
   return type_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* V0LayerParameter::release_type() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.type)
   clear_has_type();
   return type_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -26417,6 +28199,7 @@ inline ::caffe::FillerParameter* V0LayerParameter::mutable_weight_filler() {
   return weight_filler_;
 }
 inline ::caffe::FillerParameter* V0LayerParameter::release_weight_filler() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.weight_filler)
   clear_has_weight_filler();
   ::caffe::FillerParameter* temp = weight_filler_;
   weight_filler_ = NULL;
@@ -26460,6 +28243,7 @@ inline ::caffe::FillerParameter* V0LayerParameter::mutable_bias_filler() {
   return bias_filler_;
 }
 inline ::caffe::FillerParameter* V0LayerParameter::release_bias_filler() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.bias_filler)
   clear_has_bias_filler();
   ::caffe::FillerParameter* temp = bias_filler_;
   bias_filler_ = NULL;
@@ -26757,6 +28541,7 @@ inline ::std::string* V0LayerParameter::mutable_source() {
   return source_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* V0LayerParameter::release_source() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.source)
   clear_has_source();
   return source_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -26834,6 +28619,7 @@ inline ::std::string* V0LayerParameter::mutable_meanfile() {
   return meanfile_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
 inline ::std::string* V0LayerParameter::release_meanfile() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.meanfile)
   clear_has_meanfile();
   return meanfile_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
@@ -26938,16 +28724,16 @@ inline ::caffe::BlobProto* V0LayerParameter::add_blobs() {
   // @@protoc_insertion_point(field_add:caffe.V0LayerParameter.blobs)
   return blobs_.Add();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
-V0LayerParameter::blobs() const {
-  // @@protoc_insertion_point(field_list:caffe.V0LayerParameter.blobs)
-  return blobs_;
-}
 inline ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >*
 V0LayerParameter::mutable_blobs() {
   // @@protoc_insertion_point(field_mutable_list:caffe.V0LayerParameter.blobs)
   return &blobs_;
 }
+inline const ::google::protobuf::RepeatedPtrField< ::caffe::BlobProto >&
+V0LayerParameter::blobs() const {
+  // @@protoc_insertion_point(field_list:caffe.V0LayerParameter.blobs)
+  return blobs_;
+}
 
 // repeated float blobs_lr = 51;
 inline int V0LayerParameter::blobs_lr_size() const {
@@ -27169,6 +28955,7 @@ inline ::std::string* V0LayerParameter::mutable_det_crop_mode() {
   return det_crop_mode_.MutableNoArena(_default_det_crop_mode_);
 }
 inline ::std::string* V0LayerParameter::release_det_crop_mode() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.det_crop_mode)
   clear_has_det_crop_mode();
   return det_crop_mode_.ReleaseNoArena(_default_det_crop_mode_);
 }
@@ -27353,6 +29140,7 @@ inline ::caffe::HDF5OutputParameter* V0LayerParameter::mutable_hdf5_output_param
   return hdf5_output_param_;
 }
 inline ::caffe::HDF5OutputParameter* V0LayerParameter::release_hdf5_output_param() {
+  // @@protoc_insertion_point(field_release:caffe.V0LayerParameter.hdf5_output_param)
   clear_has_hdf5_output_param();
   ::caffe::HDF5OutputParameter* temp = hdf5_output_param_;
   hdf5_output_param_ = NULL;
@@ -27400,6 +29188,7 @@ inline ::caffe::FillerParameter* PReLUParameter::mutable_filler() {
   return filler_;
 }
 inline ::caffe::FillerParameter* PReLUParameter::release_filler() {
+  // @@protoc_insertion_point(field_release:caffe.PReLUParameter.filler)
   clear_has_filler();
   ::caffe::FillerParameter* temp = filler_;
   filler_ = NULL;
@@ -27475,6 +29264,144 @@ TransposeParameter::mutable_dim() {
 }
 
 #endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
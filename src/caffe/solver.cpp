@@ -1,16 +1,88 @@
+#include <boost/thread.hpp>
+#include <algorithm>
 #include <cstdio>
 
+#include <fstream>  // NOLINT(readability/streams)
+
 #include <string>
 #include <vector>
 
+#include "caffe/internal_thread.hpp"
+#include "caffe/layers/base_data_layer.hpp"
 #include "caffe/solver.hpp"
 #include "caffe/util/format.hpp"
 #include "caffe/util/hdf5.hpp"
 #include "caffe/util/io.hpp"
+#include "caffe/util/snapshot_writer.hpp"
+#include "caffe/util/trace.hpp"
 #include "caffe/util/upgrade_proto.hpp"
 
 namespace caffe {
 
+/**
+ * @brief Evaluates the test nets on a copy of the weights, one request at a
+ *        time, while the solver keeps training.
+ */
+template <typename Dtype>
+class Solver<Dtype>::TestThread : public InternalThread {
+ public:
+  explicit TestThread(Solver* solver)
+      : solver_(solver), iter_(0), busy_(false) {
+    StartInternalThread();
+  }
+  virtual ~TestThread() { StopInternalThread(); }
+
+  /// Evaluates the test nets, which hold the weights of iteration iter.
+  void Start(int iter) {
+    boost::mutex::scoped_lock lock(mutex_);
+    CHECK(!busy_);
+    iter_ = iter;
+    busy_ = true;
+    queued_.notify_one();
+  }
+  /// Blocks until the last evaluation is done.
+  void Wait() {
+    boost::mutex::scoped_lock lock(mutex_);
+    while (busy_) {
+      done_.wait(lock);
+    }
+  }
+  inline int iter() const { return iter_; }
+  inline bool stopping() { return must_stop(); }
+
+ protected:
+  virtual void InternalThreadEntry() {
+    Caffe::set_cpu_threads(solver_->param().test_threads());
+    try {
+      while (!must_stop()) {
+        {
+          boost::mutex::scoped_lock lock(mutex_);
+          while (!busy_) {
+            queued_.wait(lock);
+          }
+        }
+        for (int i = 0; i < solver_->test_nets().size() && !must_stop();
+             ++i) {
+          solver_->Evaluate(i, this);
+        }
+        boost::mutex::scoped_lock lock(mutex_);
+        busy_ = false;
+        done_.notify_all();
+      }
+    } catch (boost::thread_interrupted&) {
+      // Interrupted exception is expected on shutdown
+    }
+  }
+
+ private:
+  Solver* solver_;
+  int iter_;
+  bool busy_;
+  boost::mutex mutex_;
+  boost::condition_variable queued_;
+  boost::condition_variable done_;
+};
+
 template<typename Dtype>
 void Solver<Dtype>::SetActionFunction(ActionCallback func) {
   action_request_function_ = func;
@@ -43,7 +115,7 @@ Solver<Dtype>::Solver(const string& param_file, const Solver* root_solver)
 
 template <typename Dtype>
 void Solver<Dtype>::Init(const SolverParameter& param) {
-  CHECK(Caffe::root_solver() || root_solver_)
+  CHECK(Caffe::root_solver() || root_solver_ || Caffe::multiprocess())
       << "root_solver_ needs to be set for all non-root solvers";
   LOG_IF(INFO, Caffe::root_solver()) << "Initializing solver from parameters: "
     << std::endl << param.DebugString();
@@ -101,11 +173,15 @@ void Solver<Dtype>::InitTrainNet() {
   net_state.MergeFrom(net_param.state());
   net_state.MergeFrom(param_.train_state());
   net_param.mutable_state()->CopyFrom(net_state);
-  if (Caffe::root_solver()) {
+  // Solvers in other processes (ShmSync) build their own net.
+  if (Caffe::root_solver() || !root_solver_) {
     net_.reset(new Net<Dtype>(net_param));
   } else {
     net_.reset(new Net<Dtype>(net_param, root_solver_->net_.get()));
   }
+  if (param_.flat_params()) {
+    net_->FlattenParams();
+  }
 }
 
 template <typename Dtype>
@@ -204,15 +280,21 @@ void Solver<Dtype>::Step(int iters) {
     if (param_.test_interval() && iter_ % param_.test_interval() == 0
         && (iter_ > 0 || param_.test_initialization())
         && Caffe::root_solver()) {
-      TestAll();
+      {
+        TraceScope trace("solver", "test");
+        TestAll();
+      }
       if (requested_early_exit_) {
         // Break out of the while loop because stop was requested while testing.
         break;
       }
     }
 
-    for (int i = 0; i < callbacks_.size(); ++i) {
-      callbacks_[i]->on_start();
+    {
+      TraceScope trace("solver", "on_start");
+      for (int i = 0; i < callbacks_.size(); ++i) {
+        callbacks_[i]->on_start();
+      }
     }
     const bool display = param_.display() && iter_ % param_.display() == 0;
     net_->set_debug_info(display && param_.debug_info());
@@ -221,8 +303,11 @@ void Solver<Dtype>::Step(int iters) {
 #endif
     // accumulate the loss and gradient
     Dtype loss = 0;
-    for (int i = 0; i < param_.iter_size(); ++i) {
-      loss += net_->ForwardBackward();
+    {
+      TraceScope trace("solver", "forward_backward");
+      for (int i = 0; i < param_.iter_size(); ++i) {
+        loss += net_->ForwardBackward();
+      }
     }
     loss /= param_.iter_size();
     // average the loss across iterations for smoothed reporting
@@ -251,11 +336,20 @@ void Solver<Dtype>::Step(int iters) {
               << result_vec[k] << loss_msg_stream.str();
         }
       }
+      if (Caffe::root_solver()) {
+        DisplayDataStats();
+      }
     }
-    for (int i = 0; i < callbacks_.size(); ++i) {
-      callbacks_[i]->on_gradients_ready();
+    {
+      TraceScope trace("solver", "on_gradients_ready");
+      for (int i = 0; i < callbacks_.size(); ++i) {
+        callbacks_[i]->on_gradients_ready();
+      }
+    }
+    {
+      TraceScope trace("solver", "update");
+      ApplyUpdate();
     }
-    ApplyUpdate();
 
     // Increment the internal iter_ counter -- its value should always indicate
     // the number of times the weights have been updated.
@@ -268,6 +362,7 @@ void Solver<Dtype>::Step(int iters) {
          && iter_ % param_.snapshot() == 0
          && Caffe::root_solver()) ||
          (request == SolverAction::SNAPSHOT)) {
+      TraceScope trace("solver", "snapshot");
       Snapshot();
     }
     if (SolverAction::STOP == request) {
@@ -278,6 +373,55 @@ void Solver<Dtype>::Step(int iters) {
   }
 }
 
+template <typename Dtype>
+void Solver<Dtype>::DisplayDataStats() {
+  const string& stats_file = param_.data_stats_file();
+  std::ofstream stats;
+  if (!stats_file.empty()) {
+    const bool exists = std::ifstream(stats_file.c_str()).good();
+    stats.open(stats_file.c_str(), std::ios::app);
+    CHECK(stats.good()) << "Cannot write " << stats_file;
+    if (!exists) {
+      stats << "iter\tlayer\tbatches\tdepth\tqueued\twaits\twait_us"
+          "\tread_us\ttransform_us\tload_us\n";
+    }
+  }
+  const vector<shared_ptr<Layer<Dtype> > >& layers = net_->layers();
+  for (int i = 0; i < layers.size(); ++i) {
+    BasePrefetchingDataLayer<Dtype>* layer =
+        dynamic_cast<BasePrefetchingDataLayer<Dtype>*>(layers[i].get());
+    if (!layer || layer->timings().batches == 0) {
+      continue;
+    }
+    // Averages per batch since the last display.
+    const PrefetchTimings& t = layer->timings();
+    const double n = t.batches;
+    LOG(INFO) << "    Data layer " << layer->layer_param().name() << ": "
+        << t.queued / n << " of " << layer->prefetch_depth()
+        << " batches ready, waited " << t.wait_us / n / 1000 << " ms ("
+        << t.waits << " of " << t.batches << " batches blocked); read "
+        << t.read_us / n / 1000 << " ms, transform "
+        << t.transform_us / n / 1000 << " ms, load "
+        << t.load_us / n / 1000 << " ms per batch";
+    const SampleCache* cache = layer->sample_cache();
+    if (cache) {
+      const SampleCacheStats c = cache->stats();
+      LOG(INFO) << "    Sample cache: " << c.samples << " samples in "
+          << c.bytes / (1 << 20) << " MB, hit rate "
+          << 100.0 * c.hits / std::max<uint64_t>(c.hits + c.misses, 1)
+          << "% since the start";
+    }
+    if (stats.is_open()) {
+      stats << iter_ << "\t" << layer->layer_param().name() << "\t"
+          << t.batches << "\t" << layer->prefetch_depth() << "\t"
+          << t.queued / n << "\t" << t.waits << "\t" << t.wait_us / n
+          << "\t" << t.read_us / n << "\t" << t.transform_us / n << "\t"
+          << t.load_us / n << "\n";
+    }
+    layer->ResetTimings();
+  }
+}
+
 template <typename Dtype>
 void Solver<Dtype>::Solve(const char* resume_file) {
   CHECK(Caffe::root_solver());
@@ -302,6 +446,7 @@ void Solver<Dtype>::Solve(const char* resume_file) {
       && (!param_.snapshot() || iter_ % param_.snapshot() != 0)) {
     Snapshot();
   }
+  WaitForSnapshots();
   if (requested_early_exit_) {
     LOG(INFO) << "Optimization stopped early.";
     return;
@@ -324,11 +469,29 @@ void Solver<Dtype>::Solve(const char* resume_file) {
   if (param_.test_interval() && iter_ % param_.test_interval() == 0) {
     TestAll();
   }
+  if (test_thread_) {
+    test_thread_->Wait();
+  }
   LOG(INFO) << "Optimization Done.";
 }
 
 template <typename Dtype>
 void Solver<Dtype>::TestAll() {
+  if (param_.test_async() && !test_nets_.empty()) {
+    if (!test_thread_) {
+      test_thread_.reset(new TestThread(this));
+    }
+    // Only copying the weights pauses training, unless the last
+    // evaluation is still running.
+    test_thread_->Wait();
+    for (int test_net_id = 0; test_net_id < test_nets_.size();
+         ++test_net_id) {
+      test_nets_[test_net_id]->CopyTrainedLayersFrom(net_.get());
+    }
+    LOG(INFO) << "Iteration " << iter_ << ", Testing nets in the background";
+    test_thread_->Start(iter_);
+    return;
+  }
   for (int test_net_id = 0;
        test_net_id < test_nets_.size() && !requested_early_exit_;
        ++test_net_id) {
@@ -343,24 +506,36 @@ void Solver<Dtype>::Test(const int test_net_id) {
             << ", Testing net (#" << test_net_id << ")";
   CHECK_NOTNULL(test_nets_[test_net_id].get())->
       ShareTrainedLayersWith(net_.get());
+  Evaluate(test_net_id, NULL);
+}
+
+template <typename Dtype>
+void Solver<Dtype>::Evaluate(const int test_net_id, TestThread* thread) {
   vector<Dtype> test_score;
   vector<int> test_score_output_id;
   const shared_ptr<Net<Dtype> >& test_net = test_nets_[test_net_id];
   Dtype loss = 0;
   for (int i = 0; i < param_.test_iter(test_net_id); ++i) {
-    SolverAction::Enum request = GetRequestedAction();
-    // Check to see if stoppage of testing/training has been requested.
-    while (request != SolverAction::NONE) {
-        if (SolverAction::SNAPSHOT == request) {
-          Snapshot();
-        } else if (SolverAction::STOP == request) {
-          requested_early_exit_ = true;
-        }
-        request = GetRequestedAction();
-    }
-    if (requested_early_exit_) {
-      // break out of test loop.
-      break;
+    if (thread) {
+      // Requested actions are left to the training loop.
+      if (thread->stopping()) {
+        return;
+      }
+    } else {
+      SolverAction::Enum request = GetRequestedAction();
+      // Check to see if stoppage of testing/training has been requested.
+      while (request != SolverAction::NONE) {
+          if (SolverAction::SNAPSHOT == request) {
+            Snapshot();
+          } else if (SolverAction::STOP == request) {
+            requested_early_exit_ = true;
+          }
+          request = GetRequestedAction();
+      }
+      if (requested_early_exit_) {
+        // break out of test loop.
+        break;
+      }
     }
 
     Dtype iter_loss;
@@ -387,10 +562,14 @@ void Solver<Dtype>::Test(const int test_net_id) {
       }
     }
   }
-  if (requested_early_exit_) {
+  if (!thread && requested_early_exit_) {
     LOG(INFO)     << "Test interrupted.";
     return;
   }
+  if (thread) {
+    LOG(INFO) << "Iteration " << thread->iter() << ", Test net (#"
+              << test_net_id << ") results";
+  }
   if (param_.test_compute_loss()) {
     loss /= param_.test_iter(test_net_id);
     LOG(INFO) << "Test loss: " << loss;
@@ -414,6 +593,13 @@ void Solver<Dtype>::Test(const int test_net_id) {
 template <typename Dtype>
 void Solver<Dtype>::Snapshot() {
   CHECK(Caffe::root_solver());
+  if (param_.snapshot_async()) {
+    if (!snapshot_writer_) {
+      snapshot_writer_.reset(new SnapshotWriter());
+    }
+    // Keep at most one snapshot in memory.
+    snapshot_writer_->Wait();
+  }
   string model_filename;
   switch (param_.snapshot_format()) {
   case caffe::SolverParameter_SnapshotFormat_BINARYPROTO:
@@ -457,9 +643,9 @@ template <typename Dtype>
 string Solver<Dtype>::SnapshotToBinaryProto() {
   string model_filename = SnapshotFilename(".caffemodel");
   LOG(INFO) << "Snapshotting to binary proto file " << model_filename;
-  NetParameter net_param;
-  net_->ToProto(&net_param, param_.snapshot_diff());
-  WriteProtoToBinaryFile(net_param, model_filename);
+  shared_ptr<NetParameter> net_param(new NetParameter());
+  net_->ToProto(net_param.get(), param_.snapshot_diff());
+  WriteSnapshotFile(model_filename, net_param);
   return model_filename;
 }
 
@@ -467,13 +653,46 @@ template <typename Dtype>
 string Solver<Dtype>::SnapshotToHDF5() {
   string model_filename = SnapshotFilename(".caffemodel.h5");
   LOG(INFO) << "Snapshotting to HDF5 file " << model_filename;
-  net_->ToHDF5(model_filename, param_.snapshot_diff());
+  shared_ptr<string> image(new string());
+  net_->ToHDF5Image(image.get(), param_.snapshot_diff());
+  WriteSnapshotFile(model_filename, image);
   return model_filename;
 }
 
+template <typename Dtype>
+void Solver<Dtype>::WriteSnapshotFile(const string& filename,
+    const shared_ptr<const google::protobuf::Message>& proto) {
+  if (snapshot_writer_) {
+    snapshot_writer_->Write(filename, proto);
+    return;
+  }
+  string contents;
+  CHECK(proto->SerializeToString(&contents))
+      << "Couldn't serialize " << filename;
+  WriteFileAtomically(contents, filename);
+}
+
+template <typename Dtype>
+void Solver<Dtype>::WriteSnapshotFile(const string& filename,
+    const shared_ptr<const string>& contents) {
+  if (snapshot_writer_) {
+    snapshot_writer_->Write(filename, contents);
+    return;
+  }
+  WriteFileAtomically(*contents, filename);
+}
+
+template <typename Dtype>
+void Solver<Dtype>::WaitForSnapshots() {
+  if (snapshot_writer_) {
+    snapshot_writer_->Wait();
+  }
+}
+
 template <typename Dtype>
 void Solver<Dtype>::Restore(const char* state_file) {
   CHECK(Caffe::root_solver());
+  WaitForSnapshots();
   string state_filename(state_file);
   if (state_filename.size() >= 3 &&
       state_filename.compare(state_filename.size() - 3, 3, ".h5") == 0) {
@@ -1,6 +1,8 @@
+#include <cmath>
 #include <vector>
 
 #include "caffe/sgd_solvers.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -10,6 +12,19 @@ void adagrad_update_gpu(int N, Dtype* g, Dtype* h, Dtype delta,
     Dtype local_rate);
 #endif
 
+template <typename Dtype>
+void adagrad_update_cpu(int N, Dtype* w, Dtype* g, Dtype* h,
+    const FusedGradient<Dtype>& grad, Dtype delta, Dtype local_rate) {
+  parallel_for(N, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const Dtype gi = grad(g[i], w[i]);
+      const Dtype hi = h[i] = h[i] + gi * gi;
+      const Dtype ui = g[i] = local_rate * gi / (std::sqrt(hi) + delta);
+      w[i] -= ui;
+    }
+  }, kElementwiseGrain);
+}
+
 template <typename Dtype>
 void AdaGradSolver<Dtype>::ComputeUpdateValue(int param_id, Dtype rate) {
   CHECK(Caffe::root_solver());
@@ -19,34 +34,11 @@ void AdaGradSolver<Dtype>::ComputeUpdateValue(int param_id, Dtype rate) {
   Dtype local_rate = rate * net_params_lr[param_id];
   switch (Caffe::mode()) {
   case Caffe::CPU: {
-    // compute square of gradient in update
-    caffe_powx(net_params[param_id]->count(),
-        net_params[param_id]->cpu_diff(), Dtype(2),
-        this->update_[param_id]->mutable_cpu_data());
-
-    // update history
-    caffe_add(net_params[param_id]->count(),
-        this->update_[param_id]->cpu_data(),
-        this->history_[param_id]->cpu_data(),
-        this->history_[param_id]->mutable_cpu_data());
-
-    // prepare update
-    caffe_powx(net_params[param_id]->count(),
-              this->history_[param_id]->cpu_data(), Dtype(0.5),
-              this->update_[param_id]->mutable_cpu_data());
-
-    caffe_add_scalar(net_params[param_id]->count(),
-              delta, this->update_[param_id]->mutable_cpu_data());
-
-    caffe_div(net_params[param_id]->count(),
-              net_params[param_id]->cpu_diff(),
-              this->update_[param_id]->cpu_data(),
-              this->update_[param_id]->mutable_cpu_data());
-
-    // scale and copy
-    caffe_cpu_axpby(net_params[param_id]->count(), local_rate,
-        this->update_[param_id]->cpu_data(), Dtype(0),
-        net_params[param_id]->mutable_cpu_diff());
+    adagrad_update_cpu(net_params[param_id]->count(),
+        net_params[param_id]->mutable_cpu_data(),
+        net_params[param_id]->mutable_cpu_diff(),
+        this->history_[param_id]->mutable_cpu_data(),
+        this->GetFusedGradient(param_id), delta, local_rate);
     break;
   }
   case Caffe::GPU: {
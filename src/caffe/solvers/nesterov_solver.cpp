@@ -1,6 +1,7 @@
 #include <vector>
 
 #include "caffe/sgd_solvers.hpp"
+#include "caffe/util/thread_pool.hpp"
 
 namespace caffe {
 
@@ -10,6 +11,21 @@ void nesterov_update_gpu(int N, Dtype* g, Dtype* h, Dtype momentum,
     Dtype local_rate);
 #endif
 
+template <typename Dtype>
+void nesterov_update_cpu(int N, Dtype* w, Dtype* g, Dtype* h,
+    const FusedGradient<Dtype>& grad, Dtype momentum, Dtype local_rate) {
+  parallel_for(N, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const Dtype hi = h[i];
+      const Dtype hi_new = h[i] = momentum * hi
+          + local_rate * grad(g[i], w[i]);
+      // step back then over step
+      const Dtype ui = g[i] = (Dtype(1) + momentum) * hi_new - momentum * hi;
+      w[i] -= ui;
+    }
+  }, kElementwiseGrain);
+}
+
 template <typename Dtype>
 void NesterovSolver<Dtype>::ComputeUpdateValue(int param_id, Dtype rate) {
   CHECK(Caffe::root_solver());
@@ -19,25 +35,11 @@ void NesterovSolver<Dtype>::ComputeUpdateValue(int param_id, Dtype rate) {
   Dtype local_rate = rate * net_params_lr[param_id];
   switch (Caffe::mode()) {
   case Caffe::CPU: {
-    // save history momentum for stepping back
-    caffe_copy(net_params[param_id]->count(),
-        this->history_[param_id]->cpu_data(),
-        this->update_[param_id]->mutable_cpu_data());
-
-    // update history
-    caffe_cpu_axpby(net_params[param_id]->count(), local_rate,
-              net_params[param_id]->cpu_diff(), momentum,
-              this->history_[param_id]->mutable_cpu_data());
-
-    // compute update: step back then over step
-    caffe_cpu_axpby(net_params[param_id]->count(), Dtype(1) + momentum,
-        this->history_[param_id]->cpu_data(), -momentum,
-        this->update_[param_id]->mutable_cpu_data());
-
-    // copy
-    caffe_copy(net_params[param_id]->count(),
-        this->update_[param_id]->cpu_data(),
-        net_params[param_id]->mutable_cpu_diff());
+    nesterov_update_cpu(net_params[param_id]->count(),
+        net_params[param_id]->mutable_cpu_data(),
+        net_params[param_id]->mutable_cpu_diff(),
+        this->history_[param_id]->mutable_cpu_data(),
+        this->GetFusedGradient(param_id), momentum, local_rate);
     break;
   }
   case Caffe::GPU: {
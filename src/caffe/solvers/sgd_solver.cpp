@@ -4,6 +4,7 @@
 #include "caffe/sgd_solvers.hpp"
 #include "caffe/util/hdf5.hpp"
 #include "caffe/util/io.hpp"
+#include "caffe/util/thread_pool.hpp"
 #include "caffe/util/upgrade_proto.hpp"
 
 namespace caffe {
@@ -82,6 +83,34 @@ void SGDSolver<Dtype>::ClipGradients() {
   const Dtype clip_gradients = this->param_.clip_gradients();
   if (clip_gradients < 0) { return; }
   const vector<Blob<Dtype>*>& net_params = this->net_->learnable_params();
+  if (this->net_->params_flat()) {
+    const int count = this->net_->flat_params_count();
+    Dtype* diff = this->net_->mutable_flat_diff();
+    Dtype sumsq_diff;
+    if (Caffe::mode() == Caffe::CPU) {
+      sumsq_diff = caffe_cpu_dot(count, diff, diff);
+    } else {
+#ifndef CPU_ONLY
+      caffe_gpu_dot(count, diff, diff, &sumsq_diff);
+#else
+      NO_GPU;
+#endif
+    }
+    const Dtype l2norm_diff = std::sqrt(sumsq_diff);
+    if (l2norm_diff > clip_gradients) {
+      const Dtype scale_factor = clip_gradients / l2norm_diff;
+      if (Caffe::mode() == Caffe::CPU) {
+        caffe_scal(count, scale_factor, diff);
+      } else {
+#ifndef CPU_ONLY
+        caffe_gpu_scal(count, scale_factor, diff);
+#else
+        NO_GPU;
+#endif
+      }
+    }
+    return;
+  }
   Dtype sumsq_diff = 0;
   for (int i = 0; i < net_params.size(); ++i) {
     sumsq_diff += net_params[i]->sumsq_diff();
@@ -106,9 +135,24 @@ void SGDSolver<Dtype>::ApplyUpdate() {
     LOG(INFO) << "Iteration " << this->iter_ << ", lr = " << rate;
   }
   ClipGradients();
+  if (Caffe::mode() == Caffe::CPU) {
+    // Normalize, Regularize and Net::Update are fused into the per-param
+    // CPU updates.
+    for (int param_id = 0; param_id < this->net_->learnable_params().size();
+         ++param_id) {
+      ComputeUpdateValue(param_id, rate);
+    }
+    return;
+  }
+  const bool flat = this->net_->params_flat();
+  if (flat) {
+    NormalizeFlat();
+  }
   for (int param_id = 0; param_id < this->net_->learnable_params().size();
        ++param_id) {
-    Normalize(param_id);
+    if (!flat) {
+      Normalize(param_id);
+    }
     Regularize(param_id);
     ComputeUpdateValue(param_id, rate);
   }
@@ -141,6 +185,49 @@ void SGDSolver<Dtype>::Normalize(int param_id) {
   }
 }
 
+template <typename Dtype>
+void SGDSolver<Dtype>::NormalizeFlat() {
+  if (this->param_.iter_size() == 1) { return; }
+  const Dtype accum_normalization = Dtype(1.) / this->param_.iter_size();
+  const int count = this->net_->flat_params_count();
+  Dtype* diff = this->net_->mutable_flat_diff();
+  switch (Caffe::mode()) {
+  case Caffe::CPU:
+    caffe_scal(count, accum_normalization, diff);
+    break;
+  case Caffe::GPU:
+#ifndef CPU_ONLY
+    caffe_gpu_scal(count, accum_normalization, diff);
+#else
+    NO_GPU;
+#endif
+    break;
+  default:
+    LOG(FATAL) << "Unknown caffe mode: " << Caffe::mode();
+  }
+}
+
+template <typename Dtype>
+FusedGradient<Dtype> SGDSolver<Dtype>::GetFusedGradient(int param_id) {
+  const Dtype local_decay = this->param_.weight_decay() *
+      this->net_->params_weight_decay()[param_id];
+  const string& regularization_type = this->param_.regularization_type();
+  FusedGradient<Dtype> grad;
+  grad.scale = Dtype(1.) / this->param_.iter_size();
+  grad.l2 = Dtype(0);
+  grad.l1 = Dtype(0);
+  if (local_decay) {
+    if (regularization_type == "L2") {
+      grad.l2 = local_decay;
+    } else if (regularization_type == "L1") {
+      grad.l1 = local_decay;
+    } else {
+      LOG(FATAL) << "Unknown regularization type: " << regularization_type;
+    }
+  }
+  return grad;
+}
+
 template <typename Dtype>
 void SGDSolver<Dtype>::Regularize(int param_id) {
   const vector<Blob<Dtype>*>& net_params = this->net_->learnable_params();
@@ -209,6 +296,18 @@ void sgd_update_gpu(int N, Dtype* g, Dtype* h, Dtype momentum,
     Dtype local_rate);
 #endif
 
+template <typename Dtype>
+void sgd_update_cpu(int N, Dtype* w, Dtype* g, Dtype* h,
+    const FusedGradient<Dtype>& grad, Dtype momentum, Dtype local_rate) {
+  parallel_for(N, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      const Dtype hi = h[i] = momentum * h[i] + local_rate * grad(g[i], w[i]);
+      g[i] = hi;
+      w[i] -= hi;
+    }
+  }, kElementwiseGrain);
+}
+
 template <typename Dtype>
 void SGDSolver<Dtype>::ComputeUpdateValue(int param_id, Dtype rate) {
   const vector<Blob<Dtype>*>& net_params = this->net_->learnable_params();
@@ -218,12 +317,11 @@ void SGDSolver<Dtype>::ComputeUpdateValue(int param_id, Dtype rate) {
   // Compute the update to history, then copy it to the parameter diff.
   switch (Caffe::mode()) {
   case Caffe::CPU: {
-    caffe_cpu_axpby(net_params[param_id]->count(), local_rate,
-              net_params[param_id]->cpu_diff(), momentum,
-              history_[param_id]->mutable_cpu_data());
-    caffe_copy(net_params[param_id]->count(),
-        history_[param_id]->cpu_data(),
-        net_params[param_id]->mutable_cpu_diff());
+    sgd_update_cpu(net_params[param_id]->count(),
+        net_params[param_id]->mutable_cpu_data(),
+        net_params[param_id]->mutable_cpu_diff(),
+        history_[param_id]->mutable_cpu_data(),
+        GetFusedGradient(param_id), momentum, local_rate);
     break;
   }
   case Caffe::GPU: {
@@ -259,20 +357,20 @@ void SGDSolver<Dtype>::SnapshotSolverState(const string& model_filename) {
 template <typename Dtype>
 void SGDSolver<Dtype>::SnapshotSolverStateToBinaryProto(
     const string& model_filename) {
-  SolverState state;
-  state.set_iter(this->iter_);
-  state.set_learned_net(model_filename);
-  state.set_current_step(this->current_step_);
-  state.clear_history();
+  shared_ptr<SolverState> state(new SolverState());
+  state->set_iter(this->iter_);
+  state->set_learned_net(model_filename);
+  state->set_current_step(this->current_step_);
+  state->clear_history();
   for (int i = 0; i < history_.size(); ++i) {
     // Add history
-    BlobProto* history_blob = state.add_history();
+    BlobProto* history_blob = state->add_history();
     history_[i]->ToProto(history_blob);
   }
   string snapshot_filename = Solver<Dtype>::SnapshotFilename(".solverstate");
   LOG(INFO)
     << "Snapshotting solver state to binary proto file " << snapshot_filename;
-  WriteProtoToBinaryFile(state, snapshot_filename.c_str());
+  this->WriteSnapshotFile(snapshot_filename, state);
 }
 
 template <typename Dtype>
@@ -281,10 +379,7 @@ void SGDSolver<Dtype>::SnapshotSolverStateToHDF5(
   string snapshot_filename =
       Solver<Dtype>::SnapshotFilename(".solverstate.h5");
   LOG(INFO) << "Snapshotting solver state to HDF5 file " << snapshot_filename;
-  hid_t file_hid = H5Fcreate(snapshot_filename.c_str(), H5F_ACC_TRUNC,
-      H5P_DEFAULT, H5P_DEFAULT);
-  CHECK_GE(file_hid, 0)
-      << "Couldn't open " << snapshot_filename << " to save solver state.";
+  hid_t file_hid = hdf5_create_in_memory();
   hdf5_save_int(file_hid, "iter", this->iter_);
   hdf5_save_string(file_hid, "learned_net", model_filename);
   hdf5_save_int(file_hid, "current_step", this->current_step_);
@@ -298,7 +393,9 @@ void SGDSolver<Dtype>::SnapshotSolverStateToHDF5(
     hdf5_save_nd_dataset<Dtype>(history_hid, oss.str(), *history_[i]);
   }
   H5Gclose(history_hid);
+  shared_ptr<string> image(new string(hdf5_file_image(file_hid)));
   H5Fclose(file_hid);
+  this->WriteSnapshotFile(snapshot_filename, image);
 }
 
 template <typename Dtype>
@@ -1,6 +1,7 @@
 #include "caffe/common.hpp"
 #include "caffe/syncedmem.hpp"
 #include "caffe/util/math_functions.hpp"
+#include "caffe/util/trace.hpp"
 
 namespace caffe {
 
@@ -36,7 +37,10 @@ inline void SyncedMemory::to_cpu() {
       CaffeMallocHost(&cpu_ptr_, size_, &cpu_malloc_use_cuda_);
       own_cpu_data_ = true;
     }
-    caffe_gpu_memcpy(size_, gpu_ptr_, cpu_ptr_);
+    {
+      TraceScope trace("memcpy", "device_to_host");
+      caffe_gpu_memcpy(size_, gpu_ptr_, cpu_ptr_);
+    }
     head_ = SYNCED;
 #else
     NO_GPU;
@@ -64,7 +68,10 @@ inline void SyncedMemory::to_gpu() {
       CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
       own_gpu_data_ = true;
     }
-    caffe_gpu_memcpy(size_, cpu_ptr_, gpu_ptr_);
+    {
+      TraceScope trace("memcpy", "host_to_device");
+      caffe_gpu_memcpy(size_, cpu_ptr_, gpu_ptr_);
+    }
     head_ = SYNCED;
     break;
   case HEAD_AT_GPU:
@@ -87,4 +87,51 @@ TYPED_TEST(BenchmarkTest, TestTimerSeconds) {
   EXPECT_TRUE(timer.has_run_at_least_once());
 }
 
+TEST(PercentileTest, TestPercentile) {
+  std::vector<double> samples;
+  EXPECT_EQ(0, Percentile(samples, 50));
+  for (int i = 10; i > 0; --i) {
+    samples.push_back(i);
+  }
+  EXPECT_DOUBLE_EQ(1, Percentile(samples, 0));
+  EXPECT_DOUBLE_EQ(5.5, Percentile(samples, 50));
+  EXPECT_DOUBLE_EQ(9.1, Percentile(samples, 90));
+  EXPECT_DOUBLE_EQ(10, Percentile(samples, 100));
+}
+
+TEST(PercentileTest, TestJsonPercentiles) {
+  EXPECT_EQ("{\"mean\": 0, \"min\": 0, \"p50\": 0, \"p90\": 0, \"p99\": 0}",
+      JsonPercentiles(std::vector<double>()));
+  std::vector<double> samples;
+  for (int i = 1; i <= 100; ++i) {
+    samples.push_back(i);
+  }
+  EXPECT_EQ(
+      "{\"mean\": 50.5, \"min\": 1, \"p50\": 50.5, \"p90\": 90.1, "
+      "\"p99\": 99.01}", JsonPercentiles(samples));
+}
+
+TEST(JsonStringTest, TestEscape) {
+  EXPECT_EQ("\"conv1\"", JsonString("conv1"));
+  EXPECT_EQ("\"a\\\"b\\\\c\"", JsonString("a\"b\\c"));
+  EXPECT_EQ("\"a\\u000ab\\u001f\"", JsonString("a\nb\x1f"));
+}
+
+TEST(ParseIntListTest, TestParse) {
+  const std::vector<int> values = ParseIntList("1,8,64");
+  ASSERT_EQ(3, values.size());
+  EXPECT_EQ(1, values[0]);
+  EXPECT_EQ(8, values[1]);
+  EXPECT_EQ(64, values[2]);
+}
+
+TEST(PeakMemoryTest, TestPeakMemory) {
+  const size_t peak = PeakMemoryBytes();
+  {
+    std::vector<char> buffer(64 << 20, 1);
+    EXPECT_GE(PeakMemoryBytes(), buffer.size());
+  }
+  EXPECT_GE(PeakMemoryBytes(), peak);
+}
+
 }  // namespace caffe
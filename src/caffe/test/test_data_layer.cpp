@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "boost/scoped_ptr.hpp"
+#include "boost/thread.hpp"
 #include "gtest/gtest.h"
 
 #include "caffe/blob.hpp"
@@ -19,6 +20,22 @@ namespace caffe {
 
 using boost::scoped_ptr;
 
+// Sleeps before loading every batch, so that a consumer calling Forward back
+// to back always finds the prefetch queue empty.
+template <typename Dtype>
+class SlowDataLayer : public DataLayer<Dtype> {
+ public:
+  explicit SlowDataLayer(const LayerParameter& param)
+      : DataLayer<Dtype>(param) {}
+  virtual ~SlowDataLayer() { this->StopInternalThread(); }
+
+ protected:
+  virtual void load_batch(Batch<Dtype>* batch) {
+    boost::this_thread::sleep(boost::posix_time::milliseconds(2));
+    DataLayer<Dtype>::load_batch(batch);
+  }
+};
+
 template <typename TypeParam>
 class DataLayerTest : public MultiDeviceTest<TypeParam> {
   typedef typename TypeParam::Dtype Dtype;
@@ -67,12 +84,13 @@ class DataLayerTest : public MultiDeviceTest<TypeParam> {
     db->Close();
   }
 
-  void TestRead() {
+  void TestRead(int num_workers = 1) {
     const Dtype scale = 3;
     LayerParameter param;
     param.set_phase(TRAIN);
     DataParameter* data_param = param.mutable_data_param();
     data_param->set_batch_size(5);
+    data_param->set_num_workers(num_workers);
     data_param->set_source(filename_->c_str());
     data_param->set_backend(backend_);
 
@@ -103,6 +121,40 @@ class DataLayerTest : public MultiDeviceTest<TypeParam> {
         }
       }
     }
+    EXPECT_EQ(100, layer.timings().batches);
+  }
+
+  void TestAdaptivePrefetch() {
+    LayerParameter param;
+    param.set_phase(TRAIN);
+    DataParameter* data_param = param.mutable_data_param();
+    data_param->set_batch_size(5);
+    data_param->set_source(filename_->c_str());
+    data_param->set_backend(backend_);
+    data_param->set_prefetch(1);
+    data_param->set_adaptive_prefetch(true);
+    // Room for three batches of data and labels.
+    data_param->set_prefetch_max_bytes(3 * 5 * (24 + 1) * sizeof(Dtype));
+
+    SlowDataLayer<Dtype> layer(param);
+    layer.SetUp(blob_bottom_vec_, blob_top_vec_);
+    EXPECT_EQ(1, layer.prefetch_depth());
+    for (int iter = 0; iter < 200; ++iter) {
+      layer.Forward(blob_bottom_vec_, blob_top_vec_);
+      for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(i, blob_top_label_->cpu_data()[i]);
+        EXPECT_EQ(i, blob_top_data_->cpu_data()[i * 24]);
+      }
+    }
+    // The queue grew on the waits but stayed within prefetch_max_bytes.
+    EXPECT_GT(layer.prefetch_depth(), 1);
+    EXPECT_LE(layer.prefetch_depth(), 3);
+    const PrefetchTimings& timings = layer.timings();
+    EXPECT_EQ(200, timings.batches);
+    EXPECT_GT(timings.waits, 0);
+    EXPECT_LE(timings.waits, timings.batches);
+    EXPECT_GE(timings.wait_us, 0);
+    EXPECT_LE(timings.queued, 200 * layer.prefetch_depth());
   }
 
   void TestReshape(DataParameter_DB backend) {
@@ -224,11 +276,12 @@ class DataLayerTest : public MultiDeviceTest<TypeParam> {
     }
   }
 
-  void TestReadCropTrainSequenceSeeded() {
+  void TestReadCropTrainSequenceSeeded(int num_workers = 1) {
     LayerParameter param;
     param.set_phase(TRAIN);
     DataParameter* data_param = param.mutable_data_param();
     data_param->set_batch_size(5);
+    data_param->set_num_workers(num_workers);
     data_param->set_source(filename_->c_str());
     data_param->set_backend(backend_);
 
@@ -279,6 +332,51 @@ class DataLayerTest : public MultiDeviceTest<TypeParam> {
     }
   }
 
+  // Fill(false) first: the label of every record matches its pixels.
+  void TestShuffle(int num_workers, int shuffle_buffer,
+      const string& key_index) {
+    const Dtype scale = 3;
+    LayerParameter param;
+    param.set_phase(TRAIN);
+    DataParameter* data_param = param.mutable_data_param();
+    data_param->set_batch_size(5);
+    data_param->set_num_workers(num_workers);
+    data_param->set_source(filename_->c_str());
+    data_param->set_backend(backend_);
+    data_param->set_shuffle(true);
+    data_param->set_shuffle_buffer(shuffle_buffer);
+    if (!key_index.empty()) {
+      data_param->set_key_index(key_index);
+    }
+    param.mutable_transform_param()->set_scale(scale);
+
+    DataLayer<Dtype> layer(param);
+    layer.SetUp(blob_bottom_vec_, blob_top_vec_);
+    bool reordered = false;
+    for (int iter = 0; iter < 20; ++iter) {
+      layer.Forward(blob_bottom_vec_, blob_top_vec_);
+      vector<int> counts(5, 0);
+      for (int i = 0; i < 5; ++i) {
+        const int label = blob_top_label_->cpu_data()[i];
+        ASSERT_GE(label, 0);
+        ASSERT_LT(label, 5);
+        ++counts[label];
+        reordered |= label != i;
+        for (int j = 0; j < 24; ++j) {
+          EXPECT_EQ(scale * label, blob_top_data_->cpu_data()[i * 24 + j])
+              << "debug: iter " << iter << " i " << i << " j " << j;
+        }
+      }
+      if (shuffle_buffer == 0) {
+        // Every batch is one epoch over the 5 records.
+        for (int i = 0; i < 5; ++i) {
+          EXPECT_EQ(1, counts[i]);
+        }
+      }
+    }
+    EXPECT_TRUE(reordered);
+  }
+
   void TestReadCropTrainSequenceUnseeded() {
     LayerParameter param;
     param.set_phase(TRAIN);
@@ -336,6 +434,84 @@ class DataLayerTest : public MultiDeviceTest<TypeParam> {
     }
   }
 
+  // With adaptive_prefetch, a slow layer grows the prefetch queue, and the
+  // batches added on the way must carry the lengths too.
+  void TestBuckets(DataParameter_DB backend, bool adaptive_prefetch) {
+    // Samples of width 2, 3, ..., 9; bucket bounds 4 and 6, so the buckets
+    // get 3, 2 and 3 samples.
+    const int num_inputs = 8;
+    scoped_ptr<db::DB> db(db::GetDB(backend));
+    db->Open(*filename_, db::NEW);
+    scoped_ptr<db::Transaction> txn(db->NewTransaction());
+    for (int i = 0; i < num_inputs; ++i) {
+      Datum datum;
+      datum.add_label(i);
+      datum.set_channels(1);
+      datum.set_height(2);
+      datum.set_width(i + 2);
+      std::string* data = datum.mutable_data();
+      for (int j = 0; j < 2 * (i + 2); ++j) {
+        data->push_back(static_cast<uint8_t>(i + 1));
+      }
+      stringstream ss;
+      ss << i;
+      string out;
+      CHECK(datum.SerializeToString(&out));
+      txn->Put(ss.str(), out);
+    }
+    txn->Commit();
+    db->Close();
+
+    LayerParameter param;
+    param.set_phase(TRAIN);
+    DataParameter* data_param = param.mutable_data_param();
+    data_param->set_batch_size(2);
+    data_param->set_source(filename_->c_str());
+    data_param->set_backend(backend);
+    data_param->add_bucket_width(4);
+    data_param->add_bucket_width(6);
+    data_param->set_bucket_window(num_inputs);
+    data_param->set_bucket_pad_value(-1);
+    if (adaptive_prefetch) {
+      data_param->set_prefetch(1);
+      data_param->set_adaptive_prefetch(true);
+    }
+
+    Blob<Dtype> blob_top_length;
+    blob_top_vec_.push_back(&blob_top_length);
+    scoped_ptr<DataLayer<Dtype> > layer(adaptive_prefetch ?
+        new SlowDataLayer<Dtype>(param) : new DataLayer<Dtype>(param));
+    layer->SetUp(blob_bottom_vec_, blob_top_vec_);
+    EXPECT_EQ(blob_top_data_->width(), 6);
+    const int iterations = adaptive_prefetch ? 100 : 20;
+    for (int iter = 0; iter < iterations; ++iter) {
+      layer->Forward(blob_bottom_vec_, blob_top_vec_);
+      const int padded_width = blob_top_data_->width();
+      EXPECT_EQ(blob_top_length.count(), blob_top_data_->num());
+      for (int n = 0; n < blob_top_data_->num(); ++n) {
+        const int label = blob_top_label_->cpu_data()[n];
+        const int width = label + 2;
+        EXPECT_EQ(width, blob_top_length.cpu_data()[n]);
+        if (width <= 4) {
+          EXPECT_EQ(4, padded_width);
+        } else if (width <= 6) {
+          EXPECT_EQ(6, padded_width);
+        } else {
+          EXPECT_GE(padded_width, width);
+        }
+        for (int h = 0; h < 2; ++h) {
+          for (int w = 0; w < padded_width; ++w) {
+            EXPECT_EQ(w < width ? label + 1 : -1,
+                      blob_top_data_->data_at(n, 0, h, w));
+          }
+        }
+      }
+    }
+    if (adaptive_prefetch) {
+      EXPECT_GT(layer->prefetch_depth(), 1);
+    }
+  }
+
   virtual ~DataLayerTest() { delete blob_top_data_; delete blob_top_label_; }
 
   DataParameter_DB backend_;
@@ -428,6 +604,61 @@ TYPED_TEST(DataLayerTest, TestReadCropTestLMDB) {
   this->TestReadCrop(TEST);
 }
 
+TYPED_TEST(DataLayerTest, TestReadWorkersLMDB) {
+  const bool unique_pixels = false;  // all pixels the same; images different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  this->TestRead(3);
+}
+
+// Test that the crops stay reproducible when items are decoded concurrently.
+TYPED_TEST(DataLayerTest, TestReadCropTrainSequenceSeededWorkersLMDB) {
+  const bool unique_pixels = true;  // all images the same; pixels different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  this->TestReadCropTrainSequenceSeeded(3);
+}
+
+TYPED_TEST(DataLayerTest, TestAdaptivePrefetchLMDB) {
+  const bool unique_pixels = false;  // all pixels the same; images different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  this->TestAdaptivePrefetch();
+}
+
+TYPED_TEST(DataLayerTest, TestShuffleLMDB) {
+  const bool unique_pixels = false;  // all pixels the same; images different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  this->TestShuffle(1, 0, "");
+}
+
+TYPED_TEST(DataLayerTest, TestShuffleWorkersLMDB) {
+  const bool unique_pixels = false;  // all pixels the same; images different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  this->TestShuffle(3, 0, "");
+}
+
+TYPED_TEST(DataLayerTest, TestShuffleKeyIndexLMDB) {
+  const bool unique_pixels = false;  // all pixels the same; images different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  const string key_index = *this->filename_ + ".keys";
+  // Written by the first layer, read by the second.
+  this->TestShuffle(1, 0, key_index);
+  EXPECT_TRUE(boost::filesystem::exists(key_index));
+  this->TestShuffle(1, 0, key_index);
+}
+
+TYPED_TEST(DataLayerTest, TestShuffleBufferLMDB) {
+  const bool unique_pixels = false;  // all pixels the same; images different
+  this->Fill(unique_pixels, DataParameter_DB_LMDB);
+  this->TestShuffle(1, 3, "");
+}
+
+TYPED_TEST(DataLayerTest, TestBucketsLMDB) {
+  this->TestBuckets(DataParameter_DB_LMDB, false);
+}
+
+TYPED_TEST(DataLayerTest, TestBucketsAdaptivePrefetchLMDB) {
+  this->TestBuckets(DataParameter_DB_LMDB, true);
+}
+
 #endif  // USE_LMDB
 }  // namespace caffe
 #endif  // USE_OPENCV
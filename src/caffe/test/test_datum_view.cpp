@@ -0,0 +1,98 @@
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "caffe/blob.hpp"
+#include "caffe/common.hpp"
+#include "caffe/data_transformer.hpp"
+#include "caffe/proto/caffe.pb.h"
+#include "caffe/util/datum_view.hpp"
+
+#include "caffe/test/test_caffe_main.hpp"
+
+namespace caffe {
+
+class DatumViewTest : public ::testing::Test {
+ protected:
+  DatumViewTest() {
+    datum_.set_channels(2);
+    datum_.set_height(3);
+    datum_.set_width(4);
+    for (int i = 0; i < 24; ++i) {
+      datum_.mutable_data()->push_back(static_cast<char>(i * 10));
+    }
+    datum_.add_label(7);
+    datum_.add_label(-1);
+    datum_.add_label(300);
+    datum_.SerializeToString(&value_);
+  }
+
+  Datum datum_;
+  string value_;
+};
+
+TEST_F(DatumViewTest, TestParse) {
+  DatumView view;
+  ASSERT_TRUE(ParseDatumView(value_.data(), value_.size(), &view));
+  EXPECT_EQ(2, view.channels);
+  EXPECT_EQ(3, view.height);
+  EXPECT_EQ(4, view.width);
+  EXPECT_FALSE(view.encoded);
+  EXPECT_EQ(NULL, view.float_data);
+  // The pixels are not copied.
+  EXPECT_GE(view.data, value_.data());
+  EXPECT_LE(view.data + view.data_size, value_.data() + value_.size());
+  EXPECT_EQ(datum_.data(), string(view.data, view.data_size));
+  ASSERT_EQ(3, view.labels.size());
+  EXPECT_EQ(7, view.labels[0]);
+  EXPECT_EQ(-1, view.labels[1]);
+  EXPECT_EQ(300, view.labels[2]);
+}
+
+TEST_F(DatumViewTest, TestEncoded) {
+  datum_.set_encoded(true);
+  datum_.SerializeToString(&value_);
+  DatumView view;
+  ASSERT_TRUE(ParseDatumView(value_.data(), value_.size(), &view));
+  EXPECT_TRUE(view.encoded);
+  EXPECT_EQ(24, view.data_size);
+}
+
+TEST_F(DatumViewTest, TestFloatDataNotViewed) {
+  Datum datum;
+  datum.set_channels(1);
+  datum.set_height(1);
+  datum.set_width(2);
+  datum.add_float_data(0.5);
+  datum.add_float_data(1.5);
+  datum.SerializeToString(&value_);
+  DatumView view;
+  EXPECT_FALSE(ParseDatumView(value_.data(), value_.size(), &view));
+  // A view of the parsed Datum still works.
+  DatumView datum_view(datum);
+  ASSERT_TRUE(datum_view.float_data != NULL);
+  EXPECT_EQ(1.5, datum_view.float_data[1]);
+}
+
+TEST_F(DatumViewTest, TestTransformMatchesDatum) {
+  TransformationParameter param;
+  param.set_scale(0.5);
+  param.add_mean_value(10);
+  DataTransformer<float> transformer(param, TEST);
+  transformer.InitRand();
+  DatumView view;
+  ASSERT_TRUE(ParseDatumView(value_.data(), value_.size(), &view));
+  vector<int> shape = transformer.InferBlobShape(view);
+  EXPECT_TRUE(shape == transformer.InferBlobShape(datum_));
+  Blob<float> from_view(shape);
+  Blob<float> from_datum(shape);
+  transformer.Transform(view, &from_view);
+  transformer.Transform(datum_, &from_datum);
+  for (int i = 0; i < from_view.count(); ++i) {
+    EXPECT_EQ(from_datum.cpu_data()[i], from_view.cpu_data()[i]);
+  }
+  EXPECT_EQ((230 - 10) * 0.5, from_view.cpu_data()[23]);
+}
+
+}  // namespace caffe
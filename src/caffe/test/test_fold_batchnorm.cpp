@@ -0,0 +1,137 @@
+#include <string>
+#include <vector>
+
+#include "google/protobuf/text_format.h"
+
+#include "gtest/gtest.h"
+
+#include "caffe/common.hpp"
+#include "caffe/filler.hpp"
+#include "caffe/net.hpp"
+#include "caffe/util/fold_batchnorm.hpp"
+
+#include "caffe/test/test_caffe_main.hpp"
+
+namespace caffe {
+
+class FoldBatchNormTest : public ::testing::Test {
+ protected:
+  FoldBatchNormTest() {
+    Caffe::set_mode(Caffe::CPU);
+    Caffe::set_random_seed(1701);
+  }
+
+  // Fill all parameters with random values; variances and the moving
+  // average factor have to stay positive.
+  void RandomizeParams(Net<float>* net) {
+    FillerParameter filler_param;
+    filler_param.set_min(-1);
+    filler_param.set_max(1);
+    UniformFiller<float> filler(filler_param);
+    FillerParameter positive_param;
+    positive_param.set_min(0.5);
+    positive_param.set_max(2);
+    UniformFiller<float> positive_filler(positive_param);
+    for (int i = 0; i < net->layers().size(); ++i) {
+      const vector<shared_ptr<Blob<float> > >& blobs =
+          net->layers()[i]->blobs();
+      const bool is_bn = string(net->layers()[i]->type()) == "BatchNorm";
+      for (int j = 0; j < blobs.size(); ++j) {
+        if (is_bn && j > 0) {
+          positive_filler.Fill(blobs[j].get());
+        } else {
+          filler.Fill(blobs[j].get());
+        }
+      }
+    }
+  }
+
+  void CheckFolding(const string& proto, const int expected_folded) {
+    NetParameter param;
+    CHECK(google::protobuf::TextFormat::ParseFromString(proto, &param));
+    param.mutable_state()->set_phase(TEST);
+    Net<float> net(param);
+    RandomizeParams(&net);
+    NetParameter weights;
+    net.ToProto(&weights);
+
+    NetParameter folded_param, folded_weights;
+    EXPECT_EQ(expected_folded,
+        FoldBatchNorm(param, weights, &folded_param, &folded_weights));
+    Net<float> folded_net(folded_param);
+    folded_net.CopyTrainedLayersFrom(folded_weights);
+    EXPECT_EQ(net.layers().size() - expected_folded,
+        folded_net.layers().size());
+
+    FillerParameter filler_param;
+    GaussianFiller<float> filler(filler_param);
+    filler.Fill(net.input_blobs()[0]);
+    folded_net.input_blobs()[0]->CopyFrom(*net.input_blobs()[0]);
+    net.Forward();
+    folded_net.Forward();
+
+    const Blob<float>* output = net.output_blobs()[0];
+    const Blob<float>* folded_output = folded_net.output_blobs()[0];
+    ASSERT_EQ(output->count(), folded_output->count());
+    for (int i = 0; i < output->count(); ++i) {
+      EXPECT_NEAR(output->cpu_data()[i], folded_output->cpu_data()[i], 1e-4);
+    }
+  }
+};
+
+TEST_F(FoldBatchNormTest, TestConvBatchNormScaleReLU) {
+  const string proto =
+      "name: 'ConvBN' "
+      "input: 'data' "
+      "input_shape { dim: 2 dim: 3 dim: 6 dim: 8 } "
+      "layer { name: 'conv' type: 'Convolution' bottom: 'data' top: 'conv' "
+      "  convolution_param { num_output: 4 kernel_size: 3 pad: 1 "
+      "    bias_term: false } } "
+      "layer { name: 'bn' type: 'BatchNorm' bottom: 'conv' top: 'conv' } "
+      "layer { name: 'scale' type: 'Scale' bottom: 'conv' top: 'conv' "
+      "  scale_param { bias_term: true } } "
+      "layer { name: 'relu' type: 'ReLU' bottom: 'conv' top: 'conv' } "
+      "layer { name: 'pool' type: 'Pooling' bottom: 'conv' top: 'pool' "
+      "  pooling_param { pool: MAX kernel_size: 2 stride: 2 } } ";
+  CheckFolding(proto, 3);
+}
+
+TEST_F(FoldBatchNormTest, TestNotInPlaceChain) {
+  const string proto =
+      "name: 'ConvBN' "
+      "input: 'data' "
+      "input_shape { dim: 2 dim: 3 dim: 6 dim: 8 } "
+      "layer { name: 'conv' type: 'Convolution' bottom: 'data' top: 'conv' "
+      "  convolution_param { num_output: 4 kernel_size: 3 } } "
+      "layer { name: 'bn' type: 'BatchNorm' bottom: 'conv' top: 'bn' } "
+      "layer { name: 'relu' type: 'ReLU' bottom: 'bn' top: 'relu' } ";
+  CheckFolding(proto, 2);
+}
+
+TEST_F(FoldBatchNormTest, TestSharedBlobIsNotFolded) {
+  // conv is read by the eltwise layer as well, so BatchNorm must stay.
+  const string proto =
+      "name: 'ConvBN' "
+      "input: 'data' "
+      "input_shape { dim: 2 dim: 3 dim: 6 dim: 8 } "
+      "layer { name: 'conv' type: 'Convolution' bottom: 'data' top: 'conv' "
+      "  convolution_param { num_output: 4 kernel_size: 3 } } "
+      "layer { name: 'bn' type: 'BatchNorm' bottom: 'conv' top: 'bn' } "
+      "layer { name: 'sum' type: 'Eltwise' bottom: 'bn' bottom: 'conv' "
+      "  top: 'sum' } ";
+  CheckFolding(proto, 0);
+}
+
+TEST_F(FoldBatchNormTest, TestInnerProductBatchNorm) {
+  const string proto =
+      "name: 'IPBN' "
+      "input: 'data' "
+      "input_shape { dim: 3 dim: 10 } "
+      "layer { name: 'ip' type: 'InnerProduct' bottom: 'data' top: 'ip' "
+      "  inner_product_param { num_output: 5 } } "
+      "layer { name: 'bn' type: 'BatchNorm' bottom: 'ip' top: 'ip' } "
+      "layer { name: 'scale' type: 'Scale' bottom: 'ip' top: 'ip' } ";
+  CheckFolding(proto, 2);
+}
+
+}  // namespace caffe
@@ -186,6 +186,64 @@ TYPED_TEST(ImageDataLayerTest, TestShuffle) {
   }
 }
 
+TYPED_TEST(ImageDataLayerTest, TestSampleCache) {
+  typedef typename TypeParam::Dtype Dtype;
+  LayerParameter param;
+  ImageDataParameter* image_data_param = param.mutable_image_data_param();
+  image_data_param->set_batch_size(5);
+  image_data_param->set_source(this->filename_.c_str());
+  image_data_param->set_new_height(32);
+  image_data_param->set_new_width(48);
+  image_data_param->set_shuffle(false);
+  ImageDataLayer<Dtype> plain_layer(param);
+  plain_layer.SetUp(this->blob_bottom_vec_, this->blob_top_vec_);
+  plain_layer.Forward(this->blob_bottom_vec_, this->blob_top_vec_);
+  vector<Dtype> expected(this->blob_top_data_->cpu_data(),
+      this->blob_top_data_->cpu_data() + this->blob_top_data_->count());
+  param.mutable_data_param()->set_sample_cache_bytes(1 << 20);
+  ImageDataLayer<Dtype> layer(param);
+  layer.SetUp(this->blob_bottom_vec_, this->blob_top_vec_);
+  ASSERT_TRUE(layer.sample_cache() != NULL);
+  for (int iter = 0; iter < 2; ++iter) {
+    layer.Forward(this->blob_bottom_vec_, this->blob_top_vec_);
+    for (int i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i], this->blob_top_data_->cpu_data()[i]);
+    }
+  }
+  // Every line names the same image.
+  const SampleCacheStats stats = layer.sample_cache()->stats();
+  EXPECT_EQ(1u, stats.samples);
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_GT(stats.hits, 0u);
+  EXPECT_LE(stats.bytes, 1u << 20);
+}
+
+TYPED_TEST(ImageDataLayerTest, TestListIndex) {
+  typedef typename TypeParam::Dtype Dtype;
+  string index;
+  MakeTempFilename(&index);
+  // The first layer parses the list and writes the index, the second one
+  // maps it; both read the same lines.
+  for (int run = 0; run < 2; ++run) {
+    LayerParameter param;
+    ImageDataParameter* image_data_param = param.mutable_image_data_param();
+    image_data_param->set_batch_size(1);
+    image_data_param->set_source(this->filename_space_.c_str());
+    image_data_param->set_list_index(index);
+    image_data_param->set_shuffle(false);
+    ImageDataLayer<Dtype> layer(param);
+    layer.SetUp(this->blob_bottom_vec_, this->blob_top_vec_);
+    EXPECT_TRUE(std::ifstream(index.c_str()).good());
+    EXPECT_EQ(this->blob_top_label_->channels(), 1);
+    for (int i = 0; i < 2; ++i) {
+      layer.Forward(this->blob_bottom_vec_, this->blob_top_vec_);
+      EXPECT_EQ(this->blob_top_data_->height(), 360);
+      EXPECT_EQ(this->blob_top_data_->width(), 480);
+      EXPECT_EQ(this->blob_top_label_->cpu_data()[0], i);
+    }
+  }
+}
+
 TYPED_TEST(ImageDataLayerTest, TestSpace) {
   typedef typename TypeParam::Dtype Dtype;
   LayerParameter param;
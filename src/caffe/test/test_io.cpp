@@ -229,6 +229,36 @@ TEST_F(IOTest, TestReadImageToCVMatResizedGray) {
   EXPECT_EQ(cv_img.cols, 256);
 }
 
+TEST_F(IOTest, TestReadImageToCVMatReduced) {
+  string filename = EXAMPLES_SOURCE_DIR "images/cat.jpg";
+  // 360 x 480 is decoded at 90 x 120 before it is resized to 60 x 80.
+  cv::Mat cv_img = ReadImageToCVMat(filename, 60, 80, true, true);
+  EXPECT_EQ(cv_img.channels(), 3);
+  EXPECT_EQ(cv_img.rows, 60);
+  EXPECT_EQ(cv_img.cols, 80);
+  cv::Mat cv_img_ref = ReadImageToCVMat(filename, 60, 80, true);
+  EXPECT_LT(cv::norm(cv_img, cv_img_ref, cv::NORM_L1) / cv_img.total(), 24);
+}
+
+TEST_F(IOTest, TestReadImageToCVMatReducedGray) {
+  string filename = EXAMPLES_SOURCE_DIR "images/cat.jpg";
+  const bool is_color = false;
+  cv::Mat cv_img = ReadImageToCVMat(filename, 32, -1, is_color, true);
+  EXPECT_EQ(cv_img.channels(), 1);
+  EXPECT_EQ(cv_img.rows, 32);
+  EXPECT_EQ(cv_img.cols, 42);
+  cv::Mat cv_img_ref = ReadImageToCVMat(filename, 32, -1, is_color);
+  EXPECT_LT(cv::norm(cv_img, cv_img_ref, cv::NORM_L1) / cv_img.total(), 8);
+}
+
+TEST_F(IOTest, TestReadImageToCVMatReducedNotSmaller) {
+  string filename = EXAMPLES_SOURCE_DIR "images/cat.jpg";
+  // Not even half the size is needed, so nothing is reduced.
+  cv::Mat cv_img = ReadImageToCVMat(filename, 256, 256, true, true);
+  cv::Mat cv_img_ref = ReadImageToCVMat(filename, 256, 256, true);
+  EXPECT_EQ(0, cv::norm(cv_img, cv_img_ref, cv::NORM_L1));
+}
+
 TEST_F(IOTest, TestCVMatToDatum) {
   string filename = EXAMPLES_SOURCE_DIR "images/cat.jpg";
   cv::Mat cv_img = ReadImageToCVMat(filename);
@@ -320,6 +350,27 @@ TEST_F(IOTest, TestDecodeDatumToCVMat) {
   EXPECT_EQ(cv_img.cols, 480);
 }
 
+TEST_F(IOTest, TestDecodeBufferToCVMatReduced) {
+  string filename = EXAMPLES_SOURCE_DIR "images/cat.jpg";
+  Datum datum;
+  EXPECT_TRUE(ReadFileToDatum(filename, &datum));
+  const string& buffer = datum.data();
+  cv::Mat cv_img = DecodeBufferToCVMat(buffer.data(), buffer.size(), 40, 50,
+      false, true);
+  EXPECT_EQ(cv_img.channels(), 1);
+  EXPECT_EQ(cv_img.rows, 40);
+  EXPECT_EQ(cv_img.cols, 50);
+  cv_img = DecodeBufferToCVMatNative(buffer.data(), buffer.size(), 32, -1,
+      true);
+  EXPECT_EQ(cv_img.channels(), 3);
+  EXPECT_EQ(cv_img.rows, 32);
+  EXPECT_EQ(cv_img.cols, 42);
+  // Without a size nothing is reduced.
+  cv_img = DecodeBufferToCVMatNative(buffer.data(), buffer.size(), 0, 0, true);
+  EXPECT_EQ(cv_img.rows, 360);
+  EXPECT_EQ(cv_img.cols, 480);
+}
+
 TEST_F(IOTest, TestDecodeDatumToCVMatContent) {
   string filename = EXAMPLES_SOURCE_DIR "images/cat.jpg";
   Datum datum;
@@ -2446,6 +2446,58 @@ TYPED_TEST(NetTest, TestReshape) {
   EXPECT_FALSE(same_spatial_shape);
 }
 
+TYPED_TEST(NetTest, TestShareActivationMemory) {
+  typedef typename TypeParam::Dtype Dtype;
+  // Record the output and an intermediate blob for two input sizes, then
+  // check that sharing activation memory reproduces both while using fewer
+  // bytes, including after the larger input forces a new plan.
+  Caffe::set_random_seed(this->seed_);
+  FillerParameter filler_param;
+  filler_param.set_std(1);
+  GaussianFiller<Dtype> filler(filler_param);
+  Blob<Dtype> blob1(2, 3, 12, 10);
+  Blob<Dtype> blob2(4, 3, 9, 11);
+  filler.Fill(&blob1);
+  filler.Fill(&blob2);
+  Blob<Dtype>* inputs[] = { &blob1, &blob2 };
+
+  this->InitReshapableNet();
+  shared_ptr<Blob<Dtype> > input_blob = this->net_->blob_by_name("data");
+  shared_ptr<Blob<Dtype> > pool_blob = this->net_->blob_by_name("pool1");
+  Blob<Dtype>* output_blob = this->net_->output_blobs()[0];
+  Blob<Dtype> outputs[2], pools[2];
+  for (int i = 0; i < 2; ++i) {
+    input_blob->ReshapeLike(*inputs[i]);
+    caffe_copy(inputs[i]->count(), inputs[i]->cpu_data(),
+        input_blob->mutable_cpu_data());
+    this->net_->Forward();
+    outputs[i].CopyFrom(*output_blob, false, true);
+    pools[i].CopyFrom(*pool_blob, false, true);
+  }
+
+  this->net_->ShareActivationMemory(vector<string>(1, "pool1"));
+  EXPECT_LT(this->net_->shared_activation_bytes(),
+      this->net_->activation_bytes());
+  const int kOrder[] = { 0, 1, 0 };
+  for (int n = 0; n < 3; ++n) {
+    const int i = kOrder[n];
+    input_blob->ReshapeLike(*inputs[i]);
+    caffe_copy(inputs[i]->count(), inputs[i]->cpu_data(),
+        input_blob->mutable_cpu_data());
+    this->net_->Forward();
+    ASSERT_EQ(outputs[i].count(), output_blob->count());
+    for (int j = 0; j < outputs[i].count(); ++j) {
+      EXPECT_FLOAT_EQ(outputs[i].cpu_data()[j], output_blob->cpu_data()[j]);
+    }
+    ASSERT_EQ(pools[i].count(), pool_blob->count());
+    for (int j = 0; j < pools[i].count(); ++j) {
+      EXPECT_FLOAT_EQ(pools[i].cpu_data()[j], pool_blob->cpu_data()[j]);
+    }
+  }
+  EXPECT_LT(this->net_->shared_activation_bytes(),
+      this->net_->activation_bytes());
+}
+
 TYPED_TEST(NetTest, TestSkipPropagateDown) {
   // check bottom_need_backward if propagate_down is true
   this->InitSkipPropNet(false);
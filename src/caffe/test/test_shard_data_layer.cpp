@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "caffe/blob.hpp"
+#include "caffe/common.hpp"
+#include "caffe/layers/shard_data_layer.hpp"
+#include "caffe/proto/caffe.pb.h"
+#include "caffe/util/io.hpp"
+#include "caffe/util/shard.hpp"
+
+#include "caffe/test/test_caffe_main.hpp"
+
+namespace caffe {
+
+template <typename TypeParam>
+class ShardDataLayerTest : public MultiDeviceTest<TypeParam> {
+  typedef typename TypeParam::Dtype Dtype;
+
+ protected:
+  ShardDataLayerTest()
+      : blob_top_data_(new Blob<Dtype>()),
+        blob_top_label_(new Blob<Dtype>()) {}
+  virtual void SetUp() {
+    MakeTempDir(&dirname_);
+    blob_top_vec_.push_back(blob_top_data_);
+    blob_top_vec_.push_back(blob_top_label_);
+  }
+  virtual ~ShardDataLayerTest() {
+    delete blob_top_data_;
+    delete blob_top_label_;
+  }
+
+  // Writes 5 samples of 2 x 3 x width; every pixel of sample i is i, its
+  // first label is i and its second label is only set for even samples.
+  // With variable width sample i is i + 1 pixels wide.
+  string Fill(const string& name, int width) {
+    const string filename = dirname_ + "/" + name;
+    ShardWriter writer;
+    writer.Open(filename, 2, 3, width, 2);
+    for (int i = 0; i < 5; ++i) {
+      const int sample_width = width ? width : i + 1;
+      vector<uint8_t> pixels(2 * 3 * sample_width, static_cast<uint8_t>(i));
+      vector<int> labels(1, i);
+      if (i % 2 == 0) {
+        labels.push_back(10 + i);
+      }
+      writer.Write(pixels.data(), sample_width, labels);
+    }
+    writer.Close();
+    return filename;
+  }
+
+  string dirname_;
+  Blob<Dtype>* const blob_top_data_;
+  Blob<Dtype>* const blob_top_label_;
+  vector<Blob<Dtype>*> blob_bottom_vec_;
+  vector<Blob<Dtype>*> blob_top_vec_;
+};
+
+TYPED_TEST_CASE(ShardDataLayerTest, TestDtypesAndDevices);
+
+TYPED_TEST(ShardDataLayerTest, TestReadFixedWidth) {
+  typedef typename TypeParam::Dtype Dtype;
+  LayerParameter param;
+  ShardDataParameter* shard_param = param.mutable_shard_data_param();
+  shard_param->add_source(this->Fill("fixed", 4));
+  shard_param->set_batch_size(5);
+  shard_param->set_shuffle(false);
+  param.mutable_transform_param()->set_scale(3);
+  param.mutable_transform_param()->add_mean_value(1);
+  ShardDataLayer<Dtype> layer(param);
+  layer.SetUp(this->blob_bottom_vec_, this->blob_top_vec_);
+  EXPECT_EQ(5, this->blob_top_data_->num());
+  EXPECT_EQ(2, this->blob_top_data_->channels());
+  EXPECT_EQ(3, this->blob_top_data_->height());
+  EXPECT_EQ(4, this->blob_top_data_->width());
+  EXPECT_EQ(5, this->blob_top_label_->num());
+  EXPECT_EQ(2, this->blob_top_label_->channels());
+
+  for (int iter = 0; iter < 3; ++iter) {
+    layer.Forward(this->blob_bottom_vec_, this->blob_top_vec_);
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(i, this->blob_top_label_->cpu_data()[2 * i]);
+      EXPECT_EQ(i % 2 ? -1 : 10 + i,
+          this->blob_top_label_->cpu_data()[2 * i + 1]);
+      for (int j = 0; j < 24; ++j) {
+        EXPECT_EQ((i - 1) * 3, this->blob_top_data_->cpu_data()[i * 24 + j]);
+      }
+    }
+  }
+}
+
+TYPED_TEST(ShardDataLayerTest, TestReadVariableWidth) {
+  typedef typename TypeParam::Dtype Dtype;
+  LayerParameter param;
+  ShardDataParameter* shard_param = param.mutable_shard_data_param();
+  shard_param->add_source(this->Fill("variable", 0));
+  shard_param->set_batch_size(2);
+  shard_param->set_shuffle(false);
+  shard_param->set_pad_value(-2);
+  ShardDataLayer<Dtype> layer(param);
+  layer.SetUp(this->blob_bottom_vec_, this->blob_top_vec_);
+  // Shaped for the widest sample, batches are as wide as their widest one.
+  EXPECT_EQ(5, this->blob_top_data_->width());
+
+  for (int iter = 0; iter < 5; ++iter) {
+    layer.Forward(this->blob_bottom_vec_, this->blob_top_vec_);
+    const int first = (2 * iter) % 5;
+    const int second = (2 * iter + 1) % 5;
+    const int width = std::max(first, second) + 1;
+    ASSERT_EQ(width, this->blob_top_data_->width());
+    const int samples[] = { first, second };
+    for (int n = 0; n < 2; ++n) {
+      const int i = samples[n];
+      EXPECT_EQ(i, this->blob_top_label_->cpu_data()[2 * n]);
+      for (int c = 0; c < 2; ++c) {
+        for (int h = 0; h < 3; ++h) {
+          for (int w = 0; w < width; ++w) {
+            EXPECT_EQ(w <= i ? i : -2,
+                this->blob_top_data_->data_at(n, c, h, w));
+          }
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(ShardDataLayerTest, TestShuffleAcrossShards) {
+  typedef typename TypeParam::Dtype Dtype;
+  LayerParameter param;
+  ShardDataParameter* shard_param = param.mutable_shard_data_param();
+  shard_param->add_source(this->Fill("first", 4));
+  shard_param->add_source(this->Fill("second", 4));
+  shard_param->set_batch_size(5);
+  ShardDataLayer<Dtype> layer(param);
+  layer.SetUp(this->blob_bottom_vec_, this->blob_top_vec_);
+  for (int epoch = 0; epoch < 2; ++epoch) {
+    // Each epoch visits every sample of both shards once.
+    vector<int> counts(5, 0);
+    for (int iter = 0; iter < 2; ++iter) {
+      layer.Forward(this->blob_bottom_vec_, this->blob_top_vec_);
+      for (int i = 0; i < 5; ++i) {
+        const int label = this->blob_top_label_->cpu_data()[2 * i];
+        ASSERT_GE(label, 0);
+        ASSERT_LT(label, 5);
+        EXPECT_EQ(label, this->blob_top_data_->data_at(i, 1, 2, 3));
+        ++counts[label];
+      }
+    }
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(2, counts[i]);
+    }
+  }
+}
+
+}  // namespace caffe
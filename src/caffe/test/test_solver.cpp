@@ -1,14 +1,19 @@
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "boost/thread.hpp"
 #include "google/protobuf/text_format.h"
 #include "gtest/gtest.h"
 
 #include "caffe/common.hpp"
+#include "caffe/parallel.hpp"
 #include "caffe/proto/caffe.pb.h"
 #include "caffe/sgd_solvers.hpp"
 #include "caffe/solver.hpp"
+#include "caffe/util/math_functions.hpp"
 
 #include "caffe/test/test_caffe_main.hpp"
 
@@ -106,4 +111,161 @@ TYPED_TEST(SolverTest, TestInitTrainTestNets) {
   EXPECT_TRUE(this->solver_->test_nets()[1]->has_layer("accuracy"));
 }
 
+// A small net with a data layer that needs no source.
+static const char* kTrainNet =
+     "net_param { "
+     "  name: 'TestNetwork' "
+     "  layer { "
+     "    name: 'data' "
+     "    type: 'DummyData' "
+     "    dummy_data_param { "
+     "      shape { dim: 5 dim: 2 dim: 3 dim: 4 } "
+     "      shape { dim: 5 } "
+     "      data_filler { type: 'gaussian' } "
+     "      data_filler { type: 'constant' value: 1 } "
+     "    } "
+     "    top: 'data' "
+     "    top: 'label' "
+     "  } "
+     "  layer { "
+     "    name: 'innerprod' "
+     "    type: 'InnerProduct' "
+     "    inner_product_param { "
+     "      num_output: 10 "
+     "      weight_filler { type: 'gaussian' } "
+     "    } "
+     "    bottom: 'data' "
+     "    top: 'innerprod' "
+     "  } "
+     "  layer { "
+     "    name: 'loss' "
+     "    type: 'SoftmaxWithLoss' "
+     "    bottom: 'innerprod' "
+     "    bottom: 'label' "
+     "  } "
+     "} ";
+
+TYPED_TEST(SolverTest, TestAsyncTest) {
+  typedef typename TypeParam::Dtype Dtype;
+  const string proto = string(
+     "base_lr: 0.01 "
+     "lr_policy: 'fixed' "
+     "max_iter: 20 "
+     "snapshot_after_train: false "
+     "test_interval: 10 "
+     "test_iter: 3 "
+     "test_async: true ") + kTrainNet;
+  this->InitSolverFromProtoString(proto);
+  this->solver_->Solve();
+  // The test net holds its own copy of the final weights.
+  const vector<Blob<Dtype>*>& params =
+      this->solver_->net()->learnable_params();
+  const vector<Blob<Dtype>*>& test_params =
+      this->solver_->test_nets()[0]->learnable_params();
+  ASSERT_EQ(params.size(), test_params.size());
+  for (int i = 0; i < params.size(); ++i) {
+    ASSERT_EQ(params[i]->count(), test_params[i]->count());
+    EXPECT_NE(params[i]->cpu_data(), test_params[i]->cpu_data());
+    for (int j = 0; j < params[i]->count(); ++j) {
+      EXPECT_EQ(params[i]->cpu_data()[j], test_params[i]->cpu_data()[j]);
+    }
+  }
+}
+
+TYPED_TEST(SolverTest, TestHogwild) {
+  if (Caffe::mode() != Caffe::CPU) {
+    return;
+  }
+  const string proto = string(
+     "base_lr: 0.01 "
+     "lr_policy: 'fixed' "
+     "momentum: 0.9 "
+     "max_iter: 20 "
+     "snapshot_after_train: false "
+     "hogwild_sync_interval: 5 ") + kTrainNet;
+  Caffe::set_solver_count(3);
+  this->InitSolverFromProtoString(proto);
+  {
+    HogwildSync<typename TypeParam::Dtype> sync(this->solver_);
+    sync.Run();
+  }
+  Caffe::set_solver_count(1);
+  EXPECT_EQ(20, this->solver_->iter());
+}
+
+// One worker process of ShmSync, run on a thread of its own.
+template <typename Dtype>
+static void RunShmWorker(const SolverParameter& param, const string& name,
+    int rank, int ranks) {
+  Caffe::set_mode(Caffe::CPU);
+  Caffe::set_solver_count(ranks);
+  Caffe::set_solver_rank(rank);
+  Caffe::set_multiprocess(true);
+  shared_ptr<Solver<Dtype> > solver(new WorkerSolver<Dtype>(param));
+  ShmSync<Dtype> sync(solver, name);
+  sync.Run();
+}
+
+TYPED_TEST(SolverTest, TestShmSync) {
+  typedef typename TypeParam::Dtype Dtype;
+  if (Caffe::mode() != Caffe::CPU) {
+    return;
+  }
+  // Constant data gives every rank the same gradients, so the reduced
+  // gradient and the trained weights match those of a single solver.
+  string proto = string(
+     "base_lr: 0.01 "
+     "lr_policy: 'fixed' "
+     "momentum: 0.9 "
+     "max_iter: 10 "
+     "random_seed: 1701 "
+     "snapshot_after_train: false ") + kTrainNet;
+  const string gaussian = "data_filler { type: 'gaussian' }";
+  proto.replace(proto.find(gaussian), gaussian.size(),
+      "data_filler { type: 'constant' value: 0.5 }");
+  this->InitSolverFromProtoString(proto);
+  this->solver_->Solve();
+  vector<shared_ptr<Blob<Dtype> > > expected;
+  const vector<Blob<Dtype>*>& single = this->solver_->net()->learnable_params();
+  for (int i = 0; i < single.size(); ++i) {
+    expected.push_back(shared_ptr<Blob<Dtype> >(new Blob<Dtype>()));
+    expected.back()->CopyFrom(*single[i], false, true);
+  }
+
+  // Three ranks on threads of this process; each maps the shared memory.
+  const int ranks = 3;
+  ostringstream name;
+  name << "caffe_test_shm_" << caffe_rng_rand();
+  Caffe::set_solver_count(ranks);
+  Caffe::set_multiprocess(true);
+  this->InitSolverFromProtoString(proto);
+  {
+    ShmSync<Dtype> sync(this->solver_, name.str());
+    vector<shared_ptr<boost::thread> > workers;
+    for (int rank = 1; rank < ranks; ++rank) {
+      workers.push_back(shared_ptr<boost::thread>(new boost::thread(
+          &RunShmWorker<Dtype>, this->solver_->param(), name.str(), rank,
+          ranks)));
+    }
+    sync.Run();
+    for (int i = 0; i < workers.size(); ++i) {
+      workers[i]->join();
+    }
+    EXPECT_EQ(10, this->solver_->iter());
+    const vector<Blob<Dtype>*>& params =
+        this->solver_->net()->learnable_params();
+    ASSERT_EQ(expected.size(), params.size());
+    for (int i = 0; i < params.size(); ++i) {
+      ASSERT_EQ(expected[i]->count(), params[i]->count());
+      for (int j = 0; j < params[i]->count(); ++j) {
+        const Dtype value = expected[i]->cpu_data()[j];
+        EXPECT_NEAR(value, params[i]->cpu_data()[j],
+            1e-4 * std::max(Dtype(1), std::abs(value)));
+      }
+    }
+  }
+  Caffe::set_multiprocess(false);
+  Caffe::set_solver_count(1);
+}
+
 }  // namespace caffe
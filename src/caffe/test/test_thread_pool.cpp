@@ -0,0 +1,65 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "caffe/common.hpp"
+#include "caffe/util/thread_pool.hpp"
+
+#include "caffe/test/test_caffe_main.hpp"
+
+namespace caffe {
+
+class ThreadPoolTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() { Caffe::set_cpu_threads(4); }
+  virtual void TearDown() { Caffe::set_cpu_threads(1); }
+};
+
+TEST_F(ThreadPoolTest, TestReserve) {
+  EXPECT_GE(ThreadPool::num_workers(), 3);
+  EXPECT_FALSE(ThreadPool::InParallelRegion());
+}
+
+TEST_F(ThreadPoolTest, TestCoversRangeOnce) {
+  const int n = 1001;
+  vector<int> hits(n, 0);
+  parallel_for(n, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      ++hits[i];
+    }
+  });
+  for (int i = 0; i < n; ++i) {
+    EXPECT_EQ(1, hits[i]);
+  }
+}
+
+TEST_F(ThreadPoolTest, TestGrain) {
+  int calls = 0;
+  parallel_for(100, [&](int begin, int end) {
+    EXPECT_EQ(0, begin);
+    EXPECT_EQ(100, end);
+    ++calls;
+  }, 64);
+  EXPECT_EQ(1, calls);
+}
+
+TEST_F(ThreadPoolTest, TestNestedRunsSerially) {
+  const int n = 8;
+  vector<int> inner_calls(n, 0);
+  parallel_for(n, [&](int begin, int end) {
+    EXPECT_TRUE(ThreadPool::InParallelRegion());
+    for (int i = begin; i < end; ++i) {
+      parallel_for(100, [&](int inner_begin, int inner_end) {
+        EXPECT_EQ(0, inner_begin);
+        EXPECT_EQ(100, inner_end);
+        ++inner_calls[i];
+      });
+    }
+  });
+  for (int i = 0; i < n; ++i) {
+    EXPECT_EQ(1, inner_calls[i]);
+  }
+  EXPECT_FALSE(ThreadPool::InParallelRegion());
+}
+
+}  // namespace caffe
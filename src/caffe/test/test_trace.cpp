@@ -0,0 +1,65 @@
+#include <boost/thread.hpp>
+
+#include <fstream>  // NOLINT(readability/streams)
+#include <iterator>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "caffe/common.hpp"
+#include "caffe/util/io.hpp"
+#include "caffe/util/trace.hpp"
+
+#include "caffe/test/test_caffe_main.hpp"
+
+namespace caffe {
+
+class TraceTest : public ::testing::Test {
+ protected:
+  // Writes the trace and returns its contents.
+  string WriteTrace() {
+    string filename;
+    MakeTempFilename(&filename);
+    Trace::Write(filename);
+    std::ifstream file(filename.c_str());
+    return string(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+  }
+};
+
+static void RecordOnThread() {
+  const string name("trace_test_thread");
+  TraceScope trace("test", name);
+}
+
+TEST_F(TraceTest, TestRecord) {
+  EXPECT_FALSE(Trace::enabled());
+  { TraceScope trace("test", "trace_test_before"); }
+  Trace::Start(16);
+  EXPECT_TRUE(Trace::enabled());
+  { TraceScope trace("test", "trace_test_main"); }
+  boost::thread thread(&RecordOnThread);
+  thread.join();
+  Trace::Stop();
+  { TraceScope trace("test", "trace_test_after"); }
+  const string trace = WriteTrace();
+  EXPECT_EQ(string::npos, trace.find("trace_test_before"));
+  EXPECT_NE(string::npos, trace.find("\"trace_test_main\""));
+  EXPECT_NE(string::npos, trace.find("\"trace_test_thread\""));
+  EXPECT_EQ(string::npos, trace.find("trace_test_after"));
+  EXPECT_NE(string::npos, trace.find("\"ph\": \"X\""));
+}
+
+TEST_F(TraceTest, TestRingBuffer) {
+  Trace::Start(2);
+  { TraceScope trace("test", "trace_test_first"); }
+  { TraceScope trace("test", "trace_test_second"); }
+  { TraceScope trace("test", "trace_test_third"); }
+  Trace::Stop();
+  const string trace = WriteTrace();
+  EXPECT_EQ(string::npos, trace.find("trace_test_first"));
+  EXPECT_NE(string::npos, trace.find("trace_test_second"));
+  EXPECT_NE(string::npos, trace.find("trace_test_third"));
+}
+
+}  // namespace caffe
@@ -1,5 +1,22 @@
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+#include <boost/algorithm/string.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "caffe/common.hpp"
 #include "caffe/util/benchmark.hpp"
 
@@ -165,4 +182,94 @@ float CPUTimer::MicroSeconds() {
   return this->elapsed_microseconds_;
 }
 
+double Percentile(std::vector<double> samples, double p) {
+  CHECK_GE(p, 0);
+  CHECK_LE(p, 100);
+  if (samples.empty()) {
+    return 0;
+  }
+  std::sort(samples.begin(), samples.end());
+  const double rank = p / 100 * (samples.size() - 1);
+  const size_t below = static_cast<size_t>(rank);
+  if (below + 1 >= samples.size()) {
+    return samples.back();
+  }
+  return samples[below] +
+      (rank - below) * (samples[below + 1] - samples[below]);
+}
+
+PercentileSummary Summarize(const std::vector<double>& samples) {
+  PercentileSummary summary;
+  double sum = 0;
+  for (int i = 0; i < samples.size(); ++i) {
+    sum += samples[i];
+  }
+  summary.mean = samples.empty() ? 0 : sum / samples.size();
+  summary.min = Percentile(samples, 0);
+  summary.p50 = Percentile(samples, 50);
+  summary.p90 = Percentile(samples, 90);
+  summary.p99 = Percentile(samples, 99);
+  return summary;
+}
+
+std::string JsonPercentiles(const std::vector<double>& samples) {
+  const PercentileSummary summary = Summarize(samples);
+  std::ostringstream out;
+  out << "{\"mean\": " << summary.mean << ", \"min\": " << summary.min
+      << ", \"p50\": " << summary.p50 << ", \"p90\": " << summary.p90
+      << ", \"p99\": " << summary.p99 << "}";
+  return out.str();
+}
+
+std::string JsonString(const std::string& value) {
+  std::ostringstream out;
+  out << '"';
+  for (int i = 0; i < value.size(); ++i) {
+    const unsigned char c = value[i];
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (c < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+          << static_cast<int>(c) << std::dec;
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
+std::vector<int> ParseIntList(const std::string& list) {
+  std::vector<std::string> items;
+  boost::split(items, list, boost::is_any_of(","));
+  std::vector<int> values;
+  for (int i = 0; i < items.size(); ++i) {
+    values.push_back(atoi(items[i].c_str()));
+    CHECK_GT(values.back(), 0) << "Invalid value in " << list;
+  }
+  return values;
+}
+
+size_t PeakMemoryBytes() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+      sizeof(counters))) {
+    return 0;
+  }
+  return counters.PeakWorkingSetSize;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return usage.ru_maxrss;
+#else
+  // Linux reports kilobytes.
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
 }  // namespace caffe
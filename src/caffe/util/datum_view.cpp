@@ -0,0 +1,90 @@
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <stdint.h>
+
+#include "caffe/util/datum_view.hpp"
+
+namespace caffe {
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+DatumView::DatumView(const Datum& datum)
+    : channels(datum.channels()), height(datum.height()),
+      width(datum.width()), encoded(datum.encoded()),
+      data(datum.data().data()), data_size(datum.data().size()),
+      float_data(datum.float_data_size() ? datum.float_data().data() : NULL),
+      labels(datum.label().begin(), datum.label().end()) {}
+
+namespace {
+
+bool ReadInt32(CodedInputStream* input, int* value) {
+  uint64_t raw;
+  if (!input->ReadVarint64(&raw)) { return false; }
+  *value = static_cast<int32_t>(raw);
+  return true;
+}
+
+}  // namespace
+
+bool ParseDatumView(const char* buffer, size_t size, DatumView* view) {
+  *view = DatumView();
+  CodedInputStream input(reinterpret_cast<const uint8_t*>(buffer), size);
+  while (true) {
+    const uint32_t tag = input.ReadTag();
+    if (tag == 0) { break; }
+    const int field = WireFormatLite::GetTagFieldNumber(tag);
+    const WireFormatLite::WireType type = WireFormatLite::GetTagWireType(tag);
+    bool ok = true;
+    if (field == Datum::kChannelsFieldNumber &&
+        type == WireFormatLite::WIRETYPE_VARINT) {
+      ok = ReadInt32(&input, &view->channels);
+    } else if (field == Datum::kHeightFieldNumber &&
+               type == WireFormatLite::WIRETYPE_VARINT) {
+      ok = ReadInt32(&input, &view->height);
+    } else if (field == Datum::kWidthFieldNumber &&
+               type == WireFormatLite::WIRETYPE_VARINT) {
+      ok = ReadInt32(&input, &view->width);
+    } else if (field == Datum::kEncodedFieldNumber &&
+               type == WireFormatLite::WIRETYPE_VARINT) {
+      int encoded;
+      ok = ReadInt32(&input, &encoded);
+      view->encoded = encoded != 0;
+    } else if (field == Datum::kDataFieldNumber &&
+               type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      // The bytes stay where they are; only remember where they start.
+      uint32_t length;
+      ok = input.ReadVarint32(&length);
+      view->data = buffer + input.CurrentPosition();
+      view->data_size = length;
+      ok = ok && input.Skip(length);
+    } else if (field == Datum::kLabelFieldNumber &&
+               type == WireFormatLite::WIRETYPE_VARINT) {
+      int label;
+      ok = ReadInt32(&input, &label);
+      view->labels.push_back(label);
+    } else if (field == Datum::kLabelFieldNumber &&
+               type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      uint32_t length;
+      ok = input.ReadVarint32(&length);
+      const CodedInputStream::Limit limit = input.PushLimit(length);
+      while (ok && input.BytesUntilLimit() > 0) {
+        int label;
+        ok = ReadInt32(&input, &label);
+        view->labels.push_back(label);
+      }
+      input.PopLimit(limit);
+    } else if (field == Datum::kFloatDataFieldNumber) {
+      return false;
+    } else {
+      ok = WireFormatLite::SkipField(&input, tag);
+    }
+    if (!ok) {
+      LOG(ERROR) << "Could not parse datum";
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace caffe
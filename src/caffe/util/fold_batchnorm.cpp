@@ -0,0 +1,223 @@
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "caffe/blob.hpp"
+#include "caffe/common.hpp"
+#include "caffe/net.hpp"
+#include "caffe/util/fold_batchnorm.hpp"
+#include "caffe/util/math_functions.hpp"
+
+namespace caffe {
+
+namespace {
+
+typedef map<string, const LayerParameter*> WeightMap;
+
+const LayerParameter* FindWeights(const WeightMap& weight_map,
+    const LayerParameter& layer_param) {
+  WeightMap::const_iterator it = weight_map.find(layer_param.name());
+  return it == weight_map.end() ? NULL : it->second;
+}
+
+// The layer consumes the output of the chain built so far. If it does not
+// work in place, nobody else may read the intermediate blob.
+bool ContinuesChain(const LayerParameter& layer_param, const string& top,
+    const map<string, int>& bottom_counts) {
+  if (layer_param.bottom_size() != 1 || layer_param.top_size() != 1 ||
+      layer_param.bottom(0) != top) {
+    return false;
+  }
+  return layer_param.top(0) == top || bottom_counts.find(top)->second == 1;
+}
+
+bool IsFoldableBatchNorm(const LayerParameter& layer_param,
+    const LayerParameter* weights) {
+  if (layer_param.type() != "BatchNorm" || !weights ||
+      weights->blobs_size() != 3) {
+    return false;
+  }
+  const BatchNormParameter& bn_param = layer_param.batch_norm_param();
+  return !bn_param.has_use_global_stats() || bn_param.use_global_stats();
+}
+
+bool IsFoldableScale(const LayerParameter& layer_param,
+    const LayerParameter* weights) {
+  if (layer_param.type() != "Scale" || !weights ||
+      weights->blobs_size() < 1) {
+    return false;
+  }
+  const ScaleParameter& scale_param = layer_param.scale_param();
+  return scale_param.axis() == 1 && scale_param.num_axes() == 1;
+}
+
+bool IsFusableReLU(const LayerParameter& layer_param) {
+  return layer_param.type() == "ReLU" &&
+      layer_param.relu_param().negative_slope() == 0;
+}
+
+}  // namespace
+
+int FoldBatchNorm(const NetParameter& param, const NetParameter& weights,
+    NetParameter* folded_param, NetParameter* folded_weights) {
+  NetParameter filtered_param(param);
+  filtered_param.mutable_state()->set_phase(TEST);
+  NetParameter test_param;
+  Net<float>::FilterNet(filtered_param, &test_param);
+
+  WeightMap weight_map;
+  for (int i = 0; i < weights.layer_size(); ++i) {
+    weight_map[weights.layer(i).name()] = &weights.layer(i);
+  }
+  map<string, int> bottom_counts;
+  for (int i = 0; i < test_param.layer_size(); ++i) {
+    for (int j = 0; j < test_param.layer(i).bottom_size(); ++j) {
+      ++bottom_counts[test_param.layer(i).bottom(j)];
+    }
+  }
+
+  folded_param->CopyFrom(test_param);
+  folded_param->clear_layer();
+  folded_weights->Clear();
+  folded_weights->set_name(test_param.name());
+
+  int num_folded = 0;
+  const int num_layers = test_param.layer_size();
+  for (int i = 0; i < num_layers; ) {
+    const LayerParameter& layer_param = test_param.layer(i);
+    const LayerParameter* layer_weights = FindWeights(weight_map, layer_param);
+    const bool is_conv = layer_param.type() == "Convolution";
+    const bool is_ip = layer_param.type() == "InnerProduct" &&
+        layer_param.inner_product_param().axis() == 1;
+    const LayerParameter* bn = NULL;
+    const LayerParameter* scale = NULL;
+    const LayerParameter* relu = NULL;
+    int next = i + 1;
+    if ((is_conv || is_ip) && layer_weights && layer_param.top_size() == 1) {
+      string top = layer_param.top(0);
+      if (next < num_layers &&
+          ContinuesChain(test_param.layer(next), top, bottom_counts) &&
+          IsFoldableBatchNorm(test_param.layer(next),
+              FindWeights(weight_map, test_param.layer(next)))) {
+        bn = &test_param.layer(next++);
+        top = bn->top(0);
+        if (next < num_layers &&
+            ContinuesChain(test_param.layer(next), top, bottom_counts) &&
+            IsFoldableScale(test_param.layer(next),
+                FindWeights(weight_map, test_param.layer(next)))) {
+          scale = &test_param.layer(next++);
+          top = scale->top(0);
+        }
+      }
+      if (is_conv && next < num_layers &&
+          ContinuesChain(test_param.layer(next), top, bottom_counts) &&
+          IsFusableReLU(test_param.layer(next))) {
+        relu = &test_param.layer(next++);
+      }
+    }
+    if (!bn && !relu) {
+      folded_param->add_layer()->CopyFrom(layer_param);
+      if (layer_weights) {
+        folded_weights->add_layer()->CopyFrom(*layer_weights);
+      }
+      ++i;
+      continue;
+    }
+
+    // Load the trained blobs of the chain.
+    Blob<float> weight, bias;
+    weight.FromProto(layer_weights->blobs(0));
+    const int num_output = is_conv ?
+        layer_param.convolution_param().num_output() :
+        layer_param.inner_product_param().num_output();
+    vector<int> bias_shape(1, num_output);
+    if (layer_weights->blobs_size() > 1) {
+      bias.FromProto(layer_weights->blobs(1));
+    } else {
+      bias.Reshape(bias_shape);
+      caffe_set(bias.count(), 0.f, bias.mutable_cpu_data());
+    }
+    CHECK_EQ(bias.count(), num_output) << layer_param.name();
+
+    if (bn) {
+      const LayerParameter* bn_weights = FindWeights(weight_map, *bn);
+      Blob<float> mean, variance, factor;
+      mean.FromProto(bn_weights->blobs(0));
+      variance.FromProto(bn_weights->blobs(1));
+      factor.FromProto(bn_weights->blobs(2));
+      CHECK_EQ(mean.count(), num_output) << bn->name();
+      const float f = factor.cpu_data()[0];
+      const double scale_factor = f == 0 ? 0 : 1. / f;
+      const double eps = bn->batch_norm_param().eps();
+
+      vector<double> gamma(num_output, 1.), beta(num_output, 0.);
+      if (scale) {
+        const LayerParameter* scale_weights = FindWeights(weight_map, *scale);
+        Blob<float> scale_blob;
+        scale_blob.FromProto(scale_weights->blobs(0));
+        CHECK_EQ(scale_blob.count(), num_output) << scale->name();
+        for (int c = 0; c < num_output; ++c) {
+          gamma[c] = scale_blob.cpu_data()[c];
+        }
+        if (scale_weights->blobs_size() > 1) {
+          Blob<float> beta_blob;
+          beta_blob.FromProto(scale_weights->blobs(1));
+          for (int c = 0; c < num_output; ++c) {
+            beta[c] = beta_blob.cpu_data()[c];
+          }
+        }
+      }
+
+      // y = gamma * (x - mean) / sqrt(var + eps) + beta
+      //   = a * x + (beta - a * mean),  a = gamma / sqrt(var + eps)
+      float* weight_data = weight.mutable_cpu_data();
+      float* bias_data = bias.mutable_cpu_data();
+      const bool transpose = is_ip &&
+          layer_param.inner_product_param().transpose();
+      const int inner = weight.count() / num_output;
+      for (int c = 0; c < num_output; ++c) {
+        const double m = mean.cpu_data()[c] * scale_factor;
+        const double v = variance.cpu_data()[c] * scale_factor;
+        const double a = gamma[c] / std::sqrt(v + eps);
+        if (transpose) {
+          for (int k = 0; k < inner; ++k) {
+            weight_data[k * num_output + c] *= a;
+          }
+        } else {
+          for (int k = 0; k < inner; ++k) {
+            weight_data[c * inner + k] *= a;
+          }
+        }
+        bias_data[c] = static_cast<float>(beta[c] + a * (bias_data[c] - m));
+      }
+    }
+
+    LayerParameter* folded_layer = folded_param->add_layer();
+    folded_layer->CopyFrom(layer_param);
+    folded_layer->set_top(0, test_param.layer(next - 1).top(0));
+    if (is_conv) {
+      folded_layer->mutable_convolution_param()->set_bias_term(true);
+      if (relu) {
+        folded_layer->mutable_convolution_param()->set_fused_relu(true);
+      }
+    } else {
+      folded_layer->mutable_inner_product_param()->set_bias_term(true);
+    }
+    LayerParameter* folded_layer_weights = folded_weights->add_layer();
+    folded_layer_weights->set_name(layer_param.name());
+    folded_layer_weights->set_type(layer_param.type());
+    weight.ToProto(folded_layer_weights->add_blobs());
+    bias.ToProto(folded_layer_weights->add_blobs());
+
+    LOG(INFO) << "Folded " << (bn ? bn->name() : "")
+              << (scale ? ", " + scale->name() : "")
+              << (relu ? (bn ? ", " : "") + relu->name() : "")
+              << " into " << layer_param.name();
+    num_folded += next - i - 1;
+    i = next;
+  }
+  return num_folded;
+}
+
+}  // namespace caffe
@@ -163,6 +163,31 @@ void hdf5_save_int(hid_t loc_id, const string& dataset_name, int i) {
     << "Failed to save int dataset with name " << dataset_name;
 }
 
+hid_t hdf5_create_in_memory() {
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  CHECK_GE(fapl, 0) << "Error creating HDF5 file access properties.";
+  // Grow the image 1 MB at a time and never back it with a file.
+  CHECK_GE(H5Pset_fapl_core(fapl, 1 << 20, 0), 0)
+      << "Error selecting the HDF5 core driver.";
+  hid_t file_id = H5Fcreate("in_memory.h5", H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  H5Pclose(fapl);
+  CHECK_GE(file_id, 0) << "Error creating in-memory HDF5 file.";
+  return file_id;
+}
+
+string hdf5_file_image(hid_t file_id) {
+  CHECK_GE(H5Fflush(file_id, H5F_SCOPE_LOCAL), 0)
+      << "Error flushing HDF5 file.";
+  ssize_t size = H5Fget_file_image(file_id, NULL, 0);
+  CHECK_GE(size, 0) << "Error sizing HDF5 file image.";
+  string image(size, '\0');
+  if (size > 0) {
+    CHECK_EQ(H5Fget_file_image(file_id, &image[0], size), size)
+        << "Error reading HDF5 file image.";
+  }
+  return image;
+}
+
 int hdf5_get_num_links(hid_t loc_id) {
   H5G_info_t info;
   herr_t status = H5Gget_info(loc_id, &info);
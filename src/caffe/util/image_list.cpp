@@ -0,0 +1,196 @@
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>  // NOLINT(readability/streams)
+#include <string>
+#include <vector>
+
+#include "caffe/util/image_list.hpp"
+
+namespace caffe {
+
+namespace {
+
+const char kImageListMagic[8] = {'C', 'A', 'F', 'F', 'E', 'I', 'D', 'X'};
+const uint32_t kImageListVersion = 1;
+
+template <typename T>
+void WriteArray(std::ofstream* file, const T* data, size_t count) {
+  file->write(reinterpret_cast<const char*>(data), count * sizeof(T));
+}
+
+}  // namespace
+
+ImageList::ImageList()
+    : num_images_(0), name_offsets_(NULL), label_offsets_(NULL),
+      labels_(NULL), pool_(NULL) {}
+
+ImageList::~ImageList() {}
+
+void ImageList::Clear() {
+  num_images_ = 0;
+  name_offsets_ = NULL;
+  label_offsets_ = NULL;
+  labels_ = NULL;
+  pool_ = NULL;
+  parsed_name_offsets_.clear();
+  parsed_label_offsets_.clear();
+  parsed_labels_.clear();
+  parsed_pool_.clear();
+  region_.reset();
+  mapping_.reset();
+}
+
+void ImageList::Load(const string& source, bool regression,
+    const string& index) {
+  Clear();
+  ImageListHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kImageListMagic, sizeof(kImageListMagic));
+  header.version = kImageListVersion;
+  header.regression = regression;
+  struct stat source_stat;
+  CHECK_EQ(stat(source.c_str(), &source_stat), 0)
+      << "Failed to open list " << source;
+  header.source_size = source_stat.st_size;
+  header.source_mtime = source_stat.st_mtime;
+  if (!index.empty() && Map(index, header)) {
+    LOG(INFO) << "Mapped list index " << index << " with " << num_images_
+        << " images";
+    return;
+  }
+  Parse(source, regression);
+  if (!index.empty()) {
+    header.num_images = num_images_;
+    header.num_labels = parsed_labels_.size();
+    header.pool_size = parsed_pool_.size();
+    Write(index, header);
+  }
+}
+
+void ImageList::Parse(const string& source, bool regression) {
+  std::ifstream infile(source.c_str());
+  CHECK(infile.is_open()) << "Failed to open list " << source;
+  parsed_label_offsets_.push_back(0);
+  string line;
+  while (std::getline(infile, line)) {
+    while (!line.empty() && (line[line.size() - 1] == '\r' ||
+        line[line.size() - 1] == ' ')) {
+      line.erase(line.size() - 1);
+    }
+    if (line.empty()) { continue; }
+    // Names of classification lists may hold spaces: they end at the first
+    // blank after the extension, as in convert_imageset.
+    const size_t name_begin = line.find_first_not_of(" \t");
+    if (name_begin == string::npos) { continue; }
+    const size_t dot = regression ? string::npos : line.rfind('.');
+    size_t name_end = line.find_first_of(" \t",
+        dot == string::npos ? name_begin : dot + 1);
+    if (name_end == string::npos) {
+      name_end = line.size();
+    }
+    parsed_name_offsets_.push_back(parsed_pool_.size());
+    parsed_pool_.insert(parsed_pool_.end(), line.begin() + name_begin,
+        line.begin() + name_end);
+    parsed_pool_.push_back('\0');
+
+    const char* p = line.c_str() + name_end;
+    for (;;) {
+      char* end;
+      int32_t label;
+      if (regression) {
+        const float value = strtof(p, &end);
+        memcpy(&label, &value, sizeof(label));
+      } else {
+        label = strtol(p, &end, 10);
+      }
+      if (end == p) { break; }
+      parsed_labels_.push_back(label);
+      p = end;
+    }
+    parsed_label_offsets_.push_back(parsed_labels_.size());
+  }
+  num_images_ = parsed_name_offsets_.size();
+  name_offsets_ = parsed_name_offsets_.data();
+  label_offsets_ = parsed_label_offsets_.data();
+  labels_ = parsed_labels_.data();
+  pool_ = parsed_pool_.data();
+}
+
+bool ImageList::Map(const string& index, const ImageListHeader& expected) {
+  using boost::interprocess::file_mapping;
+  using boost::interprocess::mapped_region;
+  try {
+    mapping_.reset(new file_mapping(index.c_str(),
+        boost::interprocess::read_only));
+    region_.reset(new mapped_region(*mapping_,
+        boost::interprocess::read_only));
+  } catch (const boost::interprocess::interprocess_exception&) {
+    Clear();
+    return false;
+  }
+  const char* base = static_cast<const char*>(region_->get_address());
+  const uint64_t size = region_->get_size();
+  ImageListHeader header;
+  if (size < sizeof(header)) {
+    Clear();
+    return false;
+  }
+  memcpy(&header, base, sizeof(header));
+  const uint64_t labels_offset = sizeof(header) +
+      (2 * header.num_images + 1) * sizeof(uint64_t);
+  const uint64_t pool_offset = labels_offset +
+      header.num_labels * sizeof(int32_t);
+  if (memcmp(header.magic, expected.magic, sizeof(header.magic)) ||
+      header.version != expected.version ||
+      header.regression != expected.regression ||
+      header.source_size != expected.source_size ||
+      header.source_mtime != expected.source_mtime ||
+      pool_offset + header.pool_size > size) {
+    LOG(INFO) << "List index " << index << " is out of date";
+    Clear();
+    return false;
+  }
+  num_images_ = header.num_images;
+  name_offsets_ = reinterpret_cast<const uint64_t*>(base + sizeof(header));
+  label_offsets_ = name_offsets_ + header.num_images;
+  labels_ = base + labels_offset;
+  pool_ = base + pool_offset;
+  return true;
+}
+
+void ImageList::Write(const string& index,
+    const ImageListHeader& header) const {
+  // Written aside and renamed so that a reader never maps half an index.
+  const string temp = index + ".tmp";
+  {
+    std::ofstream file(temp.c_str(), std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+      LOG(WARNING) << "Failed to write list index " << index;
+      return;
+    }
+    WriteArray(&file, &header, 1);
+    WriteArray(&file, parsed_name_offsets_.data(), parsed_name_offsets_.size());
+    WriteArray(&file, parsed_label_offsets_.data(),
+        parsed_label_offsets_.size());
+    WriteArray(&file, parsed_labels_.data(), parsed_labels_.size());
+    WriteArray(&file, parsed_pool_.data(), parsed_pool_.size());
+    if (!file.good()) {
+      LOG(WARNING) << "Failed to write list index " << index;
+      return;
+    }
+  }
+  std::remove(index.c_str());
+  if (std::rename(temp.c_str(), index.c_str())) {
+    LOG(WARNING) << "Failed to write list index " << index;
+    return;
+  }
+  LOG(INFO) << "Wrote list index " << index;
+}
+
+}  // namespace caffe
@@ -11,6 +11,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cstdio>
 #include <fstream>  // NOLINT(readability/streams)
 #include <string>
 #include <vector>
@@ -20,6 +21,9 @@
 #include "caffe/util/io.hpp"
 //#include "glog/port.h"
 #include <io.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 const int kProtoReadBytesLimit = INT_MAX;  // Max size of 2 GB minus 1 byte.
 
@@ -71,48 +75,176 @@ void WriteProtoToBinaryFile(const Message& proto, const char* filename) {
   CHECK(proto.SerializeToOstream(&output));
 }
 
+void WriteFileAtomically(const string& contents, const string& filename) {
+  const string temp_filename = filename + ".tmp";
+  FILE* file = fopen(temp_filename.c_str(), "wb");
+  CHECK(file) << "Couldn't open " << temp_filename;
+  CHECK_EQ(fwrite(contents.data(), 1, contents.size(), file),
+      contents.size()) << "Couldn't write " << temp_filename;
+  CHECK_EQ(fflush(file), 0) << "Couldn't write " << temp_filename;
+#ifdef _WIN32
+  CHECK_EQ(_commit(_fileno(file)), 0) << "Couldn't sync " << temp_filename;
+#else
+  CHECK_EQ(fsync(fileno(file)), 0) << "Couldn't sync " << temp_filename;
+#endif
+  CHECK_EQ(fclose(file), 0) << "Couldn't write " << temp_filename;
+  // Replaces an existing filename on Windows too.
+  boost::filesystem::rename(temp_filename, filename);
+}
+
 #ifdef USE_OPENCV
-cv::Mat ReadImageToCVMat(const string& filename,
-    const int height, const int width, const bool is_color) {
+// cv::IMREAD_REDUCED_* (libjpeg DCT scaling) came with OpenCV 3.2; 2.4
+// defines CV_VERSION_EPOCH and counts its minor version as CV_VERSION_MAJOR.
+#if !defined(CV_VERSION_EPOCH) && (CV_VERSION_MAJOR > 3 || \
+    (CV_VERSION_MAJOR == 3 && CV_VERSION_MINOR >= 2))
+#define CAFFE_REDUCED_DECODE
+#endif
+
+// Size ReadImageToCVMat resizes a rows x cols image to.
+static cv::Size TargetSize(int rows, int cols, int height, int width) {
+  if (height > 0 && width > 0) {
+    return cv::Size(width, height);
+  } else if (height > 0 && width == -1) {  // keep the aspect ratio
+    return cv::Size(height * cols / rows, height);
+  } else if (height > 0 || width > 0) {  // scale the shorter side
+    const int stdsize = std::max(width, height);
+    if (cols >= rows) {
+      return cv::Size(stdsize * cols / rows, stdsize);
+    }
+    return cv::Size(stdsize, stdsize * rows / cols);
+  }
+  return cv::Size(cols, rows);
+}
+
+// Reads the size and component count of a JPEG from its SOF segment.
+static bool ReadJPEGHeader(std::istream* in, int* rows, int* cols,
+    int* components) {
+  if (in->get() != 0xFF || in->get() != 0xD8) {
+    return false;
+  }
+  while (in->good()) {
+    if (in->get() != 0xFF) {
+      return false;
+    }
+    int marker = in->get();
+    while (marker == 0xFF) {  // fill bytes
+      marker = in->get();
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+      continue;  // no payload
+    }
+    if (marker < 0 || marker == 0xD9 || marker == 0xDA) {
+      return false;  // end of stream, end of image or scan before any frame
+    }
+    // The operands of | are evaluated in unspecified order.
+    const int high = in->get();
+    const int low = in->get();
+    const int length = (high << 8) | low;
+    if (length < 2) {
+      return false;
+    }
+    if (marker >= 0xC0 && marker <= 0xCF &&
+        marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+      unsigned char frame[6];
+      in->read(reinterpret_cast<char*>(frame), sizeof(frame));
+      *rows = (frame[1] << 8) | frame[2];
+      *cols = (frame[3] << 8) | frame[4];
+      *components = frame[5];
+      return in->good() && *rows > 0 && *cols > 0;
+    }
+    in->ignore(length - 2);
+  }
+  return false;
+}
+
+// Lets an istream read a buffer in place.
+class BufferStreamBuf : public std::streambuf {
+ public:
+  BufferStreamBuf(const char* buffer, size_t size) {
+    char* begin = const_cast<char*>(buffer);
+    setg(begin, begin, begin + size);
+  }
+};
+
+// Picks the cv::imread/imdecode flag for an image that will be resized to
+// height x width, and sets *scale to the factor the decoder reduces it by.
+// That is the largest of 2, 4 or 8 that keeps the image at least as large
+// as the target, and 1 for anything but JPEG. *rows and *cols get the size
+// of the JPEG.
+static int ReducedDecodeFlag(std::istream* header, const int height,
+    const int width, const int cv_read_flag, int* scale, int* rows,
+    int* cols) {
+  *scale = 1;
+#ifdef CAFFE_REDUCED_DECODE
+  int components;
+  if ((height <= 0 && width <= 0) ||
+      !ReadJPEGHeader(header, rows, cols, &components)) {
+    return cv_read_flag;
+  }
+  const cv::Size target = TargetSize(*rows, *cols, height, width);
+  while (*scale < 8 && *rows / (2 * *scale) >= target.height &&
+      *cols / (2 * *scale) >= target.width) {
+    *scale *= 2;
+  }
+  const bool is_color = cv_read_flag > 0 ||
+      (cv_read_flag < 0 && components >= 3);
+  switch (*scale) {
+  case 2:
+    return is_color ? cv::IMREAD_REDUCED_COLOR_2 :
+        cv::IMREAD_REDUCED_GRAYSCALE_2;
+  case 4:
+    return is_color ? cv::IMREAD_REDUCED_COLOR_4 :
+        cv::IMREAD_REDUCED_GRAYSCALE_4;
+  case 8:
+    return is_color ? cv::IMREAD_REDUCED_COLOR_8 :
+        cv::IMREAD_REDUCED_GRAYSCALE_8;
+  }
+#endif  // CAFFE_REDUCED_DECODE
+  return cv_read_flag;
+}
+
+// Resizes a decoded image the way ReadImageToCVMat does. After a reduced
+// decode the target comes from the original rows x cols so that it does not
+// depend on the reduction.
+static cv::Mat ResizeDecoded(const cv::Mat& cv_img_origin, const int height,
+    const int width, const int scale, int rows, int cols) {
+  if (scale == 1) {
+    rows = cv_img_origin.rows;
+    cols = cv_img_origin.cols;
+  } else if (cv_img_origin.rows != (rows + scale - 1) / scale) {
+    std::swap(rows, cols);  // EXIF orientation turned the image
+  }
+  const cv::Size size = TargetSize(rows, cols, height, width);
+  if (size == cv_img_origin.size()) {
+    return cv_img_origin;
+  }
   cv::Mat cv_img;
+  cv::resize(cv_img_origin, cv_img, size);
+  return cv_img;
+}
+
+cv::Mat ReadImageToCVMat(const string& filename,
+    const int height, const int width, const bool is_color,
+    const bool reduced_decode) {
   int cv_read_flag = (is_color ? CV_LOAD_IMAGE_COLOR :
     CV_LOAD_IMAGE_GRAYSCALE);
+  int scale = 1, rows = 0, cols = 0;
+  if (reduced_decode) {
+    std::ifstream header(filename.c_str(), ios::in | ios::binary);
+    cv_read_flag = ReducedDecodeFlag(&header, height, width, cv_read_flag,
+        &scale, &rows, &cols);
+  }
   cv::Mat cv_img_origin = cv::imread(filename, cv_read_flag);
   if (!cv_img_origin.data) {
     LOG(ERROR) << "Could not open or find file " << filename;
     return cv_img_origin;
   }
-  if (height > 0 && width > 0) {
-    cv::resize(cv_img_origin, cv_img, cv::Size(width, height));
-  }
-  else if (height > 0 && width==-1)//߶ͳһȰ߱ȼ
-  {
-	  int w0 = cv_img_origin.cols, h0 = cv_img_origin.rows;
-	  int h1 = height;
-	  int  w1 = h1*w0 / h0;
-	  cv::resize(cv_img_origin, cv_img, cv::Size(w1, h1));
-  }
-  else if (height > 0 || width > 0)
-  {
-	  int stdsize = std::max(width, height);
-	  int w0 = cv_img_origin.cols, h0 = cv_img_origin.rows;
-	  int w1 = w0, h1 = h0;
-	  if (w0 >= h0)
-	  {
-		  h1 = stdsize;
-		  w1 = h1*w0 / h0;
-	  }
-	  else
-	  {
-		  w1 = stdsize;
-		  h1 = w1*h0 / w0;
-	  }
-	  cv::resize(cv_img_origin, cv_img, cv::Size(w1, h1));
-  }
-  else {
-    cv_img = cv_img_origin;
-  }
-  return cv_img;
+  return ResizeDecoded(cv_img_origin, height, width, scale, rows, cols);
+}
+
+cv::Mat ReadImageToCVMat(const string& filename,
+    const int height, const int width, const bool is_color) {
+  return ReadImageToCVMat(filename, height, width, is_color, false);
 }
 
 cv::Mat ReadImageToCVMat(const string& filename,
@@ -202,29 +334,54 @@ bool ReadFileToDatum(const string& filename, const std::vector<int>& labels,
 }
 
 #ifdef USE_OPENCV
-cv::Mat DecodeDatumToCVMatNative(const Datum& datum) {
-  cv::Mat cv_img;
-  CHECK(datum.encoded()) << "Datum not encoded";
-  const string& data = datum.data();
-  std::vector<char> vec_data(data.c_str(), data.c_str() + data.size());
-  cv_img = cv::imdecode(vec_data, -1);
+static cv::Mat DecodeBufferWithFlag(const char* buffer, size_t size,
+    const int height, const int width, const int cv_read_flag,
+    const bool reduced_decode) {
+  int read_flag = cv_read_flag;
+  int scale = 1, rows = 0, cols = 0;
+  if (reduced_decode) {
+    BufferStreamBuf header_buf(buffer, size);
+    std::istream header(&header_buf);
+    read_flag = ReducedDecodeFlag(&header, height, width, cv_read_flag,
+        &scale, &rows, &cols);
+  }
+  // imdecode reads straight from the wrapped bytes.
+  const cv::Mat encoded(1, static_cast<int>(size), CV_8UC1,
+      const_cast<char*>(buffer));
+  cv::Mat cv_img = cv::imdecode(encoded, read_flag);
   if (!cv_img.data) {
     LOG(ERROR) << "Could not decode datum ";
+    return cv_img;
   }
-  return cv_img;
+  return ResizeDecoded(cv_img, height, width, scale, rows, cols);
 }
-cv::Mat DecodeDatumToCVMat(const Datum& datum, bool is_color) {
-  cv::Mat cv_img;
-  CHECK(datum.encoded()) << "Datum not encoded";
-  const string& data = datum.data();
-  std::vector<char> vec_data(data.c_str(), data.c_str() + data.size());
+cv::Mat DecodeBufferToCVMatNative(const char* buffer, size_t size,
+    const int height, const int width, const bool reduced_decode) {
+  return DecodeBufferWithFlag(buffer, size, height, width, -1,
+      reduced_decode);
+}
+cv::Mat DecodeBufferToCVMat(const char* buffer, size_t size,
+    const int height, const int width, const bool is_color,
+    const bool reduced_decode) {
   int cv_read_flag = (is_color ? CV_LOAD_IMAGE_COLOR :
     CV_LOAD_IMAGE_GRAYSCALE);
-  cv_img = cv::imdecode(vec_data, cv_read_flag);
-  if (!cv_img.data) {
-    LOG(ERROR) << "Could not decode datum ";
-  }
-  return cv_img;
+  return DecodeBufferWithFlag(buffer, size, height, width, cv_read_flag,
+      reduced_decode);
+}
+cv::Mat DecodeBufferToCVMatNative(const char* buffer, size_t size) {
+  return DecodeBufferToCVMatNative(buffer, size, 0, 0, false);
+}
+cv::Mat DecodeBufferToCVMat(const char* buffer, size_t size, bool is_color) {
+  return DecodeBufferToCVMat(buffer, size, 0, 0, is_color, false);
+}
+cv::Mat DecodeDatumToCVMatNative(const Datum& datum) {
+  CHECK(datum.encoded()) << "Datum not encoded";
+  return DecodeBufferToCVMatNative(datum.data().data(), datum.data().size());
+}
+cv::Mat DecodeDatumToCVMat(const Datum& datum, bool is_color) {
+  CHECK(datum.encoded()) << "Datum not encoded";
+  return DecodeBufferToCVMat(datum.data().data(), datum.data().size(),
+      is_color);
 }
 
 // If Datum is encoded will decoded using DecodeDatumToCVMat and CVMatToDatum
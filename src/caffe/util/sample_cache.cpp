@@ -0,0 +1,153 @@
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif  // USE_LZ4
+
+#include "caffe/util/sample_cache.hpp"
+
+namespace caffe {
+
+namespace {
+
+const int kCacheShards = 16;
+const uint64_t kCacheBlockSize = 4 << 20;
+
+struct CacheEntry {
+  const char* data;
+  size_t stored_size;
+  SampleShape shape;
+};
+
+}  // namespace
+
+struct SampleCache::Shard {
+  Shard() : block_used(0), block_size(0), full(false) {}
+  boost::mutex mutex;
+  std::unordered_map<string, CacheEntry> index;
+  // Samples are appended to the last block; blocks never move.
+  vector<shared_ptr<vector<char> > > blocks;
+  size_t block_used;
+  size_t block_size;
+  bool full;
+  SampleCacheStats stats;
+};
+
+SampleCache::SampleCache(uint64_t budget, bool compress)
+    : shard_budget_(budget / kCacheShards), compress_(compress) {
+#ifndef USE_LZ4
+  CHECK(!compress) << "Compressing cached samples requires LZ4; compile "
+      "with USE_LZ4.";
+#endif  // USE_LZ4
+  for (int i = 0; i < kCacheShards; ++i) {
+    shards_.push_back(shared_ptr<Shard>(new Shard()));
+  }
+}
+
+SampleCache::~SampleCache() {}
+
+SampleCache::Shard& SampleCache::ShardOf(const string& key) {
+  return *shards_[std::hash<string>()(key) % shards_.size()];
+}
+
+char* SampleCache::Allocate(Shard* shard, size_t size) {
+  if (shard->block_used + size > shard->block_size) {
+    const uint64_t block_size = std::max<uint64_t>(size,
+        std::min(kCacheBlockSize, shard_budget_));
+    if (shard->stats.bytes + block_size > shard_budget_) {
+      return NULL;
+    }
+    shard->blocks.push_back(
+        shared_ptr<vector<char> >(new vector<char>(block_size)));
+    shard->block_used = 0;
+    shard->block_size = block_size;
+    shard->stats.bytes += block_size;
+  }
+  char* data = shard->blocks.back()->data() + shard->block_used;
+  shard->block_used += size;
+  return data;
+}
+
+bool SampleCache::Get(const string& key, SampleShape* shape,
+    vector<uint8_t>* pixels) {
+  Shard& shard = ShardOf(key);
+  CacheEntry entry;
+  {
+    boost::mutex::scoped_lock lock(shard.mutex);
+    std::unordered_map<string, CacheEntry>::const_iterator it =
+        shard.index.find(key);
+    if (it == shard.index.end()) {
+      ++shard.stats.misses;
+      return false;
+    }
+    ++shard.stats.hits;
+    entry = it->second;
+  }
+  // The stored bytes are immutable once indexed.
+  *shape = entry.shape;
+  pixels->resize(entry.shape.size());
+  if (compress_) {
+#ifdef USE_LZ4
+    CHECK_EQ(LZ4_decompress_safe(entry.data,
+        reinterpret_cast<char*>(pixels->data()), entry.stored_size,
+        pixels->size()), static_cast<int>(pixels->size()))
+        << "Corrupt cached sample " << key;
+#endif  // USE_LZ4
+  } else {
+    memcpy(pixels->data(), entry.data, entry.stored_size);
+  }
+  return true;
+}
+
+void SampleCache::Put(const string& key, const SampleShape& shape,
+    const uint8_t* pixels) {
+  const char* data = reinterpret_cast<const char*>(pixels);
+  size_t size = shape.size();
+  vector<char> compressed;
+  if (compress_) {
+#ifdef USE_LZ4
+    compressed.resize(LZ4_compressBound(size));
+    size = LZ4_compress_default(data, compressed.data(), size,
+        compressed.size());
+    CHECK_GT(size, 0) << "Failed to compress sample " << key;
+    data = compressed.data();
+#endif  // USE_LZ4
+  }
+  Shard& shard = ShardOf(key);
+  boost::mutex::scoped_lock lock(shard.mutex);
+  if (shard.full || shard.index.count(key)) {
+    return;
+  }
+  char* stored = Allocate(&shard, size);
+  if (!stored) {
+    shard.full = true;
+    LOG(INFO) << "Sample cache shard is full after " << shard.stats.samples
+        << " samples";
+    return;
+  }
+  memcpy(stored, data, size);
+  CacheEntry entry = { stored, size, shape };
+  shard.index[key] = entry;
+  ++shard.stats.samples;
+}
+
+SampleCacheStats SampleCache::stats() const {
+  SampleCacheStats total;
+  for (int i = 0; i < shards_.size(); ++i) {
+    boost::mutex::scoped_lock lock(shards_[i]->mutex);
+    const SampleCacheStats& stats = shards_[i]->stats;
+    total.hits += stats.hits;
+    total.misses += stats.misses;
+    total.samples += stats.samples;
+    total.bytes += stats.bytes;
+  }
+  return total;
+}
+
+}  // namespace caffe
@@ -0,0 +1,141 @@
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "caffe/util/shard.hpp"
+
+namespace caffe {
+
+namespace {
+
+const char kShardMagic[8] = {'C', 'A', 'F', 'F', 'E', 'S', 'H', 'D'};
+const uint32_t kShardVersion = 1;
+
+// Records start at even offsets so that their labels are aligned.
+inline uint64_t RecordSize(const ShardHeader& header, int width) {
+  const uint64_t size = 2 * static_cast<uint64_t>(header.label_count) +
+      static_cast<uint64_t>(header.channels) * header.height * width;
+  return (size + 1) & ~static_cast<uint64_t>(1);
+}
+
+}  // namespace
+
+void ShardWriter::Open(const string& filename, int channels, int height,
+    int width, int label_count) {
+  CHECK(!file_.is_open()) << "Shard already open";
+  CHECK_GT(channels, 0);
+  CHECK_GT(height, 0);
+  CHECK_GE(width, 0);
+  CHECK_GE(label_count, 0);
+  file_.open(filename.c_str(), std::ios::out | std::ios::binary);
+  CHECK(file_.is_open()) << "Failed to open shard " << filename;
+  memset(&header_, 0, sizeof(header_));
+  memcpy(header_.magic, kShardMagic, sizeof(kShardMagic));
+  header_.version = kShardVersion;
+  header_.channels = channels;
+  header_.height = height;
+  header_.width = width;
+  header_.label_count = label_count;
+  num_records_ = 0;
+  index_.clear();
+  // Rewritten with the record count by Close.
+  file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+}
+
+void ShardWriter::Write(const uint8_t* pixels, int width,
+    const vector<int>& labels) {
+  CHECK(file_.is_open()) << "Shard not open";
+  if (header_.width) {
+    CHECK_EQ(width, header_.width) << "Shard holds samples of fixed width";
+  }
+  CHECK_GT(width, 0);
+  CHECK_LE(labels.size(), header_.label_count)
+      << "Sample has more labels than the shard";
+  labels_.assign(header_.label_count, kShardNoLabel);
+  for (int i = 0; i < labels.size(); ++i) {
+    CHECK(labels[i] == -1 || (labels[i] >= 0 && labels[i] < kShardNoLabel))
+        << "Label " << labels[i] << " does not fit a shard";
+    if (labels[i] >= 0) {
+      labels_[i] = labels[i];
+    }
+  }
+  if (!header_.width) {
+    ShardIndexEntry entry = { static_cast<uint64_t>(file_.tellp()),
+        static_cast<uint32_t>(width), 0 };
+    index_.push_back(entry);
+  }
+  const uint64_t pixel_count =
+      static_cast<uint64_t>(header_.channels) * header_.height * width;
+  file_.write(reinterpret_cast<const char*>(labels_.data()),
+      2 * labels_.size());
+  file_.write(reinterpret_cast<const char*>(pixels), pixel_count);
+  if (RecordSize(header_, width) != 2 * labels_.size() + pixel_count) {
+    file_.put(0);
+  }
+  CHECK(file_.good()) << "Failed to write shard record";
+  ++num_records_;
+}
+
+void ShardWriter::Close() {
+  if (!file_.is_open()) { return; }
+  if (!header_.width) {
+    // Align the index to its entries.
+    while (file_.tellp() % 8) {
+      file_.put(0);
+    }
+    header_.index_offset = file_.tellp();
+    file_.write(reinterpret_cast<const char*>(index_.data()),
+        index_.size() * sizeof(ShardIndexEntry));
+  }
+  header_.num_records = num_records_;
+  file_.seekp(0);
+  file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+  CHECK(file_.good()) << "Failed to write shard";
+  file_.close();
+}
+
+ShardReader::ShardReader()
+    : base_(NULL), stride_(0), index_(NULL) {
+  memset(&header_, 0, sizeof(header_));
+}
+
+ShardReader::~ShardReader() {}
+
+void ShardReader::Open(const string& filename) {
+  using boost::interprocess::file_mapping;
+  using boost::interprocess::mapped_region;
+  try {
+    mapping_.reset(new file_mapping(filename.c_str(),
+        boost::interprocess::read_only));
+    region_.reset(new mapped_region(*mapping_,
+        boost::interprocess::read_only));
+  } catch (const boost::interprocess::interprocess_exception& e) {
+    LOG(FATAL) << "Failed to map shard " << filename << ": " << e.what();
+  }
+  base_ = static_cast<const uint8_t*>(region_->get_address());
+  const uint64_t size = region_->get_size();
+  CHECK_GE(size, sizeof(header_)) << "Truncated shard " << filename;
+  memcpy(&header_, base_, sizeof(header_));
+  CHECK_EQ(memcmp(header_.magic, kShardMagic, sizeof(kShardMagic)), 0)
+      << filename << " is not a shard";
+  CHECK_EQ(header_.version, kShardVersion)
+      << "Unsupported shard version in " << filename;
+  if (header_.width) {
+    stride_ = RecordSize(header_, header_.width);
+    CHECK_LE(sizeof(header_) + header_.num_records * stride_, size)
+        << "Truncated shard " << filename;
+  } else {
+    CHECK_EQ(header_.index_offset % 8, 0);
+    CHECK_LE(header_.index_offset +
+        header_.num_records * sizeof(ShardIndexEntry), size)
+        << "Truncated shard " << filename;
+    index_ = reinterpret_cast<const ShardIndexEntry*>(
+        base_ + header_.index_offset);
+  }
+  LOG(INFO) << "Mapped shard " << filename << " with "
+      << header_.num_records << " records";
+}
+
+}  // namespace caffe
@@ -0,0 +1,88 @@
+#include <boost/thread.hpp>
+#include <string>
+
+#include "caffe/util/benchmark.hpp"
+#include "caffe/util/io.hpp"
+#include "caffe/util/snapshot_writer.hpp"
+
+namespace caffe {
+
+class SnapshotWriter::Sync {
+ public:
+  boost::mutex mutex_;
+  boost::condition_variable queued_;
+  boost::condition_variable written_;
+};
+
+SnapshotWriter::SnapshotWriter() : sync_(new Sync()) {
+  StartInternalThread();
+}
+
+SnapshotWriter::~SnapshotWriter() {
+  Wait();
+  StopInternalThread();
+}
+
+void SnapshotWriter::Write(const string& filename,
+    const shared_ptr<const google::protobuf::Message>& proto) {
+  Job job;
+  job.filename = filename;
+  job.proto = proto;
+  Push(job);
+}
+
+void SnapshotWriter::Write(const string& filename,
+    const shared_ptr<const string>& contents) {
+  Job job;
+  job.filename = filename;
+  job.contents = contents;
+  Push(job);
+}
+
+void SnapshotWriter::Push(const Job& job) {
+  boost::mutex::scoped_lock lock(sync_->mutex_);
+  jobs_.push_back(job);
+  sync_->queued_.notify_one();
+}
+
+void SnapshotWriter::Wait() {
+  boost::mutex::scoped_lock lock(sync_->mutex_);
+  while (!jobs_.empty()) {
+    sync_->written_.wait(lock);
+  }
+}
+
+void SnapshotWriter::InternalThreadEntry() {
+  try {
+    while (!must_stop()) {
+      Job job;
+      {
+        boost::mutex::scoped_lock lock(sync_->mutex_);
+        while (jobs_.empty()) {
+          sync_->queued_.wait(lock);
+        }
+        job = jobs_.front();
+      }
+      CPUTimer timer;
+      timer.Start();
+      string serialized;
+      const string* contents = job.contents.get();
+      if (job.proto) {
+        CHECK(job.proto->SerializeToString(&serialized))
+            << "Couldn't serialize " << job.filename;
+        contents = &serialized;
+      }
+      WriteFileAtomically(*contents, job.filename);
+      LOG(INFO) << "Wrote snapshot " << job.filename << " ("
+          << contents->size() / 1024 << " KB) in "
+          << timer.MilliSeconds() << " ms";
+      boost::mutex::scoped_lock lock(sync_->mutex_);
+      jobs_.pop_front();
+      sync_->written_.notify_all();
+    }
+  } catch (boost::thread_interrupted&) {
+    // Interrupted exception is expected on shutdown
+  }
+}
+
+}  // namespace caffe
@@ -0,0 +1,121 @@
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "caffe/util/thread_pool.hpp"
+
+namespace caffe {
+
+namespace {
+
+// One Run call; lives on the stack of the calling thread.
+struct Job {
+  int n;
+  int num_chunks;
+  void (*fn)(void*, int, int);
+  void* arg;
+  int next_chunk;
+  int done_chunks;
+};
+
+// The pool is never destroyed: joining workers from a static destructor can
+// deadlock when caffe is unloaded as a DLL.
+struct Pool {
+  boost::mutex mutex;
+  boost::condition_variable work;
+  boost::condition_variable done;
+  // One entry per chunk that a worker may pick up.
+  std::deque<Job*> queue;
+  std::vector<shared_ptr<boost::thread> > workers;
+};
+
+Pool& GetPool() {
+  static Pool* pool = new Pool();
+  return *pool;
+}
+
+static boost::thread_specific_ptr<bool> in_parallel_region_;
+
+// Runs the next unclaimed chunk of job; the pool mutex is held by lock.
+bool RunChunk(Job* job, boost::unique_lock<boost::mutex>* lock) {
+  if (job->next_chunk == job->num_chunks) { return false; }
+  const int chunk = job->next_chunk++;
+  const int begin = static_cast<int>(
+      static_cast<int64_t>(job->n) * chunk / job->num_chunks);
+  const int end = static_cast<int>(
+      static_cast<int64_t>(job->n) * (chunk + 1) / job->num_chunks);
+  lock->unlock();
+  job->fn(job->arg, begin, end);
+  lock->lock();
+  if (++job->done_chunks == job->num_chunks) {
+    GetPool().done.notify_all();
+  }
+  return true;
+}
+
+void WorkerEntry() {
+  in_parallel_region_.reset(new bool(true));
+  Pool& pool = GetPool();
+  boost::unique_lock<boost::mutex> lock(pool.mutex);
+  while (true) {
+    while (pool.queue.empty()) {
+      pool.work.wait(lock);
+    }
+    Job* job = pool.queue.front();
+    pool.queue.pop_front();
+    RunChunk(job, &lock);
+  }
+}
+
+}  // namespace
+
+void ThreadPool::Reserve(int num_threads) {
+  Pool& pool = GetPool();
+  boost::unique_lock<boost::mutex> lock(pool.mutex);
+  while (static_cast<int>(pool.workers.size()) < num_threads - 1) {
+    pool.workers.push_back(shared_ptr<boost::thread>(
+        new boost::thread(&WorkerEntry)));
+  }
+}
+
+int ThreadPool::num_workers() {
+  Pool& pool = GetPool();
+  boost::unique_lock<boost::mutex> lock(pool.mutex);
+  return pool.workers.size();
+}
+
+bool ThreadPool::InParallelRegion() {
+  return in_parallel_region_.get() && *in_parallel_region_;
+}
+
+void ThreadPool::Run(int n, int num_chunks, void (*fn)(void*, int, int),
+    void* arg) {
+  Job job = { n, num_chunks, fn, arg, 0, 0 };
+  Pool& pool = GetPool();
+  if (!in_parallel_region_.get()) {
+    in_parallel_region_.reset(new bool(false));
+  }
+  *in_parallel_region_ = true;
+  boost::unique_lock<boost::mutex> lock(pool.mutex);
+  const int num_queued = std::min<int>(num_chunks - 1, pool.workers.size());
+  for (int i = 0; i < num_queued; ++i) {
+    pool.queue.push_back(&job);
+  }
+  if (num_queued == 1) {
+    pool.work.notify_one();
+  } else if (num_queued > 1) {
+    pool.work.notify_all();
+  }
+  while (RunChunk(&job, &lock)) {}
+  // Workers that did not get to this job must not see it once we return.
+  pool.queue.erase(std::remove(pool.queue.begin(), pool.queue.end(), &job),
+      pool.queue.end());
+  while (job.done_chunks < job.num_chunks) {
+    pool.done.wait(lock);
+  }
+  lock.unlock();
+  *in_parallel_region_ = false;
+}
+
+}  // namespace caffe
@@ -0,0 +1,136 @@
+#include <boost/thread.hpp>
+
+#include <chrono>  // NOLINT(build/c++11)
+#include <fstream>  // NOLINT(readability/streams)
+#include <iomanip>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "caffe/util/benchmark.hpp"
+#include "caffe/util/trace.hpp"
+
+namespace caffe {
+
+std::atomic<bool> Trace::enabled_(false);
+
+namespace {
+
+struct Event {
+  const char* category;
+  const char* name;
+  int64_t begin;
+  int64_t end;
+};
+
+// The events of one thread. Only that thread writes them.
+struct Buffer {
+  Buffer(int size, int t) : events(size), count(0), tid(t) {}
+  vector<Event> events;
+  uint64_t count;
+  int tid;
+  // Copies of the string names of the events.
+  std::set<string> names;
+};
+
+// Buffers are kept for the life of the process, as the events of threads
+// that ended are still to be written.
+struct State {
+  State() : events_per_thread(0) {}
+  boost::mutex mutex;
+  vector<shared_ptr<Buffer> > buffers;
+  int events_per_thread;
+  std::chrono::steady_clock::time_point start;
+};
+
+State& GetState() {
+  static State state;
+  return state;
+}
+
+void KeepBuffer(Buffer*) {}
+
+boost::thread_specific_ptr<Buffer> thread_buffer_(&KeepBuffer);
+
+Buffer* ThreadBuffer() {
+  Buffer* buffer = thread_buffer_.get();
+  if (!buffer) {
+    State& state = GetState();
+    boost::mutex::scoped_lock lock(state.mutex);
+    buffer = new Buffer(state.events_per_thread, state.buffers.size());
+    state.buffers.push_back(shared_ptr<Buffer>(buffer));
+    thread_buffer_.reset(buffer);
+  }
+  return buffer;
+}
+
+}  // namespace
+
+void Trace::Start(int events_per_thread) {
+  CHECK_GT(events_per_thread, 0);
+  State& state = GetState();
+  boost::mutex::scoped_lock lock(state.mutex);
+  state.events_per_thread = events_per_thread;
+  for (int i = 0; i < state.buffers.size(); ++i) {
+    state.buffers[i]->events.resize(events_per_thread);
+    state.buffers[i]->count = 0;
+  }
+  state.start = std::chrono::steady_clock::now();
+  enabled_.store(true);
+}
+
+void Trace::Stop() {
+  enabled_.store(false);
+}
+
+int64_t Trace::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - GetState().start).count();
+}
+
+void Trace::Record(const char* category, const char* name, int64_t begin,
+    int64_t end) {
+  Buffer* buffer = ThreadBuffer();
+  Event& event = buffer->events[buffer->count % buffer->events.size()];
+  event.category = category;
+  event.name = name;
+  event.begin = begin;
+  event.end = end;
+  ++buffer->count;
+}
+
+void Trace::Record(const char* category, const string& name, int64_t begin,
+    int64_t end) {
+  Record(category, ThreadBuffer()->names.insert(name).first->c_str(), begin,
+      end);
+}
+
+void Trace::Write(const string& filename) {
+  CHECK(!enabled()) << "Stop tracing before writing it";
+  State& state = GetState();
+  boost::mutex::scoped_lock lock(state.mutex);
+  std::ofstream out(filename.c_str());
+  CHECK(out) << "Cannot write " << filename;
+  out << std::fixed << std::setprecision(3);
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  bool first = true;
+  for (int i = 0; i < state.buffers.size(); ++i) {
+    const Buffer& buffer = *state.buffers[i];
+    const uint64_t size = buffer.events.size();
+    const uint64_t begin = buffer.count > size ? buffer.count - size : 0;
+    for (uint64_t j = begin; j < buffer.count; ++j) {
+      const Event& event = buffer.events[j % size];
+      out << (first ? "\n" : ",\n") << "{\"name\": " << JsonString(event.name)
+          << ", \"cat\": " << JsonString(event.category);
+      // Complete events, in microseconds.
+      out << ", \"ph\": \"X\", \"pid\": 0, \"tid\": " << buffer.tid
+          << ", \"ts\": " << event.begin / 1000.
+          << ", \"dur\": " << (event.end - event.begin) / 1000. << "}";
+      first = false;
+    }
+  }
+  out << "\n]}\n";
+  CHECK(out.good()) << "Cannot write " << filename;
+}
+
+}  // namespace caffe
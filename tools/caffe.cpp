@@ -5,8 +5,19 @@ namespace bp = boost::python;
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
+#ifdef _MSC_VER
+#include <process.h>
+#else
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <stdint.h>
 
+#include <algorithm>
 #include <cstring>
+#include <iomanip>
 #include <map>
 #include <string>
 #include <vector>
@@ -49,6 +60,36 @@ DEFINE_string(weights, "",
     "separated by ','. Cannot be set simultaneously with snapshot.");
 DEFINE_int32(iterations, 50,
     "The number of iterations to run.");
+DEFINE_int32(warmup, 0,
+    "Optional; the number of untimed iterations before timing in 'time'.");
+DEFINE_bool(forward_only, false,
+    "Optional; only time the forward pass in 'time', e.g. of deploy nets.");
+DEFINE_string(widths, "",
+    "Optional; time the model for each of these input widths, separated "
+    "by ','. The last axis of the tops of its Input layers is set to each "
+    "width in turn.");
+DEFINE_string(report, "",
+    "Optional; write the per-layer results of 'time' to this file, as CSV "
+    "if it ends with '.csv' and as JSON otherwise.");
+DEFINE_int32(cpu_threads, 1,
+    "Optional; the number of threads CPU layers may use.");
+DEFINE_int32(cpu_workers, 1,
+    "Optional; train in CPU mode on this many processes that share the "
+    "parameters in shared memory. The effective training batch size is "
+    "multiplied by the number of processes.");
+DEFINE_int32(cpu_rank, 0,
+    "Internal; the rank of a process started by -cpu_workers.");
+DEFINE_string(cpu_shm, "",
+    "Internal; the shared memory of the processes started by -cpu_workers.");
+DEFINE_int32(hogwild_threads, 1,
+    "Optional; train in CPU mode on this many threads that each run a "
+    "solver and update the shared parameters without locks (Hogwild).");
+DEFINE_string(trace, "",
+    "Optional; record a timeline of the layers, data loading, memory "
+    "transfers and solver phases and write it to this file in the Chrome "
+    "trace-event format. Worker processes append their rank.");
+DEFINE_int32(trace_events, 1 << 16,
+    "Optional; the number of last events -trace keeps per thread.");
 DEFINE_string(sigint_effect, "stop",
              "Optional; action to take when a SIGINT signal is received: "
               "snapshot, stop or none.");
@@ -56,6 +97,74 @@ DEFINE_string(sighup_effect, "snapshot",
              "Optional; action to take when a SIGHUP signal is received: "
              "snapshot, stop or none.");
 
+// The command line before gflags parsed it, to start -cpu_workers processes.
+static vector<string> g_args;
+
+#ifdef _MSC_VER
+typedef intptr_t WorkerProcess;
+#else
+typedef pid_t WorkerProcess;
+extern char** environ;
+#endif
+
+#ifdef _MSC_VER
+// _spawnvp joins the arguments with spaces into one command line, which the
+// C runtime of the worker splits again, so each one is quoted.
+static string QuoteArgument(const string& arg) {
+  string quoted = "\"";
+  int backslashes = 0;
+  for (int i = 0; i < arg.size(); ++i) {
+    if (arg[i] == '\\') {
+      ++backslashes;
+      continue;
+    }
+    // Backslashes are only special in front of a quote.
+    quoted.append(arg[i] == '"' ? 2 * backslashes + 1 : backslashes, '\\');
+    quoted += arg[i];
+    backslashes = 0;
+  }
+  quoted.append(2 * backslashes, '\\');
+  return quoted + "\"";
+}
+#endif
+
+// Starts this tool again with the same arguments as worker rank.
+static WorkerProcess StartWorker(int rank, const string& shm) {
+  vector<string> args(g_args);
+  args.push_back("--cpu_rank=" + boost::lexical_cast<string>(rank));
+  args.push_back("--cpu_shm=" + shm);
+#ifdef _MSC_VER
+  for (int i = 0; i < args.size(); ++i) {
+    args[i] = QuoteArgument(args[i]);
+  }
+#endif
+  vector<char*> argv;
+  for (int i = 0; i < args.size(); ++i) {
+    argv.push_back(const_cast<char*>(args[i].c_str()));
+  }
+  argv.push_back(NULL);
+#ifdef _MSC_VER
+  WorkerProcess process = _spawnvp(_P_NOWAIT, g_args[0].c_str(), &argv[0]);
+  CHECK_NE(process, -1) << "Cannot start worker " << rank;
+#else
+  WorkerProcess process;
+  CHECK_EQ(posix_spawnp(&process, argv[0], NULL, NULL, &argv[0], environ), 0)
+      << "Cannot start worker " << rank;
+#endif
+  return process;
+}
+
+static void WaitWorker(WorkerProcess process) {
+#ifdef _MSC_VER
+  int status;
+  _cwait(&status, process, 0);
+#else
+  int status;
+  waitpid(process, &status, 0);
+#endif
+  LOG_IF(ERROR, status != 0) << "A worker process failed";
+}
+
 // A simple registry for caffe commands.
 typedef int (*BrewFunction)();
 typedef std::map<caffe::string, BrewFunction> BrewMap;
@@ -86,6 +195,24 @@ static BrewFunction GetBrewFunction(const caffe::string& name) {
   }
 }
 
+// Runs a caffe command, traced with -trace.
+static int RunBrewFunction(const caffe::string& name) {
+  BrewFunction brew = GetBrewFunction(name);
+  if (FLAGS_trace.empty()) {
+    return brew();
+  }
+  caffe::Trace::Start(FLAGS_trace_events);
+  const int result = brew();
+  caffe::Trace::Stop();
+  string filename = FLAGS_trace;
+  if (FLAGS_cpu_rank) {
+    filename += "." + boost::lexical_cast<string>(FLAGS_cpu_rank);
+  }
+  caffe::Trace::Write(filename);
+  LOG(INFO) << "Wrote trace " << filename;
+  return result;
+}
+
 // Parse GPU ids or use all available devices
 static void get_gpus(vector<int>* gpus) {
   if (FLAGS_gpu == "all") {
@@ -239,24 +366,76 @@ int train() {
     Caffe::set_mode(Caffe::GPU);
     Caffe::set_solver_count(gpus.size());
   }
+  if (FLAGS_hogwild_threads > 1) {
+    CHECK_EQ(gpus.size(), 0) << "-hogwild_threads trains in CPU mode";
+    CHECK_EQ(FLAGS_cpu_workers, 1)
+        << "-hogwild_threads and -cpu_workers are exclusive";
+    // Data layers of every thread read their share of the records.
+    Caffe::set_solver_count(FLAGS_hogwild_threads);
+  }
+  if (FLAGS_cpu_workers > 1) {
+    CHECK_EQ(gpus.size(), 0) << "-cpu_workers trains in CPU mode";
+    Caffe::set_solver_count(FLAGS_cpu_workers);
+    Caffe::set_solver_rank(FLAGS_cpu_rank);
+    Caffe::set_multiprocess(true);
+    if (solver_param.random_seed() >= 0) {
+      // Give every process its own stream, as P2PSync does for GPUs.
+      solver_param.set_random_seed(solver_param.random_seed() + FLAGS_cpu_rank);
+      // The solver only seeds the root.
+      Caffe::set_random_seed(solver_param.random_seed());
+    }
+  }
 
   caffe::SignalHandler signal_handler(
         GetRequestedAction(FLAGS_sigint_effect),
         GetRequestedAction(FLAGS_sighup_effect));
 
-  shared_ptr<caffe::Solver<float> >
-      solver(caffe::SolverRegistry<float>::CreateSolver(solver_param));
+  shared_ptr<caffe::Solver<float> > solver;
+  if (Caffe::root_solver()) {
+    solver.reset(caffe::SolverRegistry<float>::CreateSolver(solver_param));
+  } else {
+    // Only the root keeps solver state and updates the parameters.
+    solver.reset(new caffe::WorkerSolver<float>(solver_param));
+  }
 
   solver->SetActionFunction(signal_handler.GetActionFunction());
 
-  if (FLAGS_snapshot.size()) {
+  if (!Caffe::root_solver()) {
+    // The parameters and the iteration come from the root.
+  } else if (FLAGS_snapshot.size()) {
     LOG(INFO) << "Resuming from " << FLAGS_snapshot;
     solver->Restore(FLAGS_snapshot.c_str());
   } else if (FLAGS_weights.size()) {
     CopyLayers(solver.get(), FLAGS_weights);
   }
 
-  if (gpus.size() > 1) {
+  if (FLAGS_cpu_workers > 1) {
+    string shm = FLAGS_cpu_shm;
+    if (Caffe::root_solver()) {
+#ifdef _MSC_VER
+      shm = "caffe_shm_" + boost::lexical_cast<string>(_getpid());
+#else
+      shm = "caffe_shm_" + boost::lexical_cast<string>(getpid());
+#endif
+    }
+    caffe::ShmSync<float> sync(solver, shm);
+    vector<WorkerProcess> workers;
+    if (Caffe::root_solver()) {
+      for (int rank = 1; rank < FLAGS_cpu_workers; ++rank) {
+        workers.push_back(StartWorker(rank, shm));
+      }
+    }
+    sync.Run();
+    for (int i = 0; i < workers.size(); ++i) {
+      WaitWorker(workers[i]);
+    }
+  } else if (FLAGS_hogwild_threads > 1) {
+    caffe::HogwildSync<float> sync(solver);
+    if (FLAGS_snapshot.size()) {
+      sync.Restore(FLAGS_snapshot.c_str());
+    }
+    sync.Run();
+  } else if (gpus.size() > 1) {
     caffe::P2PSync<float> sync(solver, NULL, solver->param());
     sync.Run(gpus);
   } else {
@@ -342,25 +521,141 @@ int test() {
 RegisterBrewFunction(test);
 
 
-// Time: benchmark the execution time of a model.
-int time() {
-  CHECK_GT(FLAGS_model.size(), 0) << "Need a model definition to time.";
-  caffe::Phase phase = get_phase_from_flags(caffe::TRAIN);
-  vector<string> stages = get_stages_from_flags();
+// Multiply-adds (counted as two FLOPs) of the forward pass of the compute
+// heavy layers, or 0 for the other layers.
+static int64_t LayerFlops(Layer<float>* layer,
+    const vector<Blob<float>*>& bottom, const vector<Blob<float>*>& top) {
+  const vector<shared_ptr<Blob<float> > >& blobs = layer->blobs();
+  const string& type = layer->layer_param().type();
+  int64_t flops = 0;
+  if (blobs.empty()) {
+    return 0;
+  } else if (type == "Convolution") {
+    // Each output takes one multiply-add per weight of its filter.
+    for (int i = 0; i < top.size(); ++i) {
+      flops += 2 * static_cast<int64_t>(top[i]->count()) * blobs[0]->count(1);
+    }
+  } else if (type == "Deconvolution") {
+    // Each input takes one multiply-add per weight of its filter.
+    for (int i = 0; i < bottom.size(); ++i) {
+      flops +=
+          2 * static_cast<int64_t>(bottom[i]->count()) * blobs[0]->count(1);
+    }
+  } else if (type == "InnerProduct") {
+    const int num_output = layer->layer_param().inner_product_param()
+        .num_output();
+    flops = 2 * static_cast<int64_t>(top[0]->count()) *
+        (blobs[0]->count() / num_output);
+  } else if (type == "Lstm" || type == "LSTM") {
+    // Every step multiplies the input and the hidden state by the weight
+    // matrices of the four gates.
+    const int steps = top[0]->count() / top[0]->shape(-1);
+    for (int i = 0; i < blobs.size(); ++i) {
+      if (blobs[i]->num_axes() == 2) {
+        flops += 2 * static_cast<int64_t>(steps) * blobs[i]->count();
+      }
+    }
+  } else if (type == "DenseBlock") {
+    // The transitions keep the spatial size; transition t convolves the
+    // input and the growth of the t transitions before it.
+    const caffe::DenseBlockParameter& param =
+        layer->layer_param().denseblock_param();
+    const int64_t pixels = top[0]->count() / top[0]->shape(1);
+    const int growth = param.growthrate();
+    for (int t = 0; t < param.numtransition(); ++t) {
+      int channels = param.initchannel() + t * growth;
+      if (param.use_bc()) {
+        flops += 2 * pixels * 4 * growth * channels;
+        channels = 4 * growth;
+      }
+      flops += 2 * pixels * growth * channels * param.filter_h() *
+          param.filter_w();
+    }
+  }
+  return flops;
+}
 
-  // Set device id and mode
-  vector<int> gpus;
-  get_gpus(&gpus);
-  if (gpus.size() != 0) {
-    LOG(INFO) << "Use GPU with device ID " << gpus[0];
-    Caffe::SetDevice(gpus[0]);
-    Caffe::set_mode(Caffe::GPU);
-  } else {
-    LOG(INFO) << "Use CPU.";
-    Caffe::set_mode(Caffe::CPU);
+// Sets the last axis of the tops of the Input layers to width.
+static void SetInputWidth(Net<float>* net, int width) {
+  bool found = false;
+  for (int i = 0; i < net->layers().size(); ++i) {
+    if (net->layers()[i]->layer_param().type() != "Input") {
+      continue;
+    }
+    const vector<Blob<float>*>& tops = net->top_vecs()[i];
+    for (int j = 0; j < tops.size(); ++j) {
+      vector<int> shape = tops[j]->shape();
+      shape.back() = width;
+      tops[j]->Reshape(shape);
+      found = true;
+    }
+  }
+  CHECK(found) << "-widths needs a net with an Input layer.";
+  net->Reshape();
+}
+
+// The timings and costs of a layer, or of the whole net.
+struct TimeResult {
+  string name;
+  string type;
+  int64_t flops;
+  int64_t param_bytes;
+  int64_t activation_bytes;
+  vector<double> forward_ms;
+  vector<double> backward_ms;
+};
+
+static string TimeSummary(const vector<double>& ms) {
+  double sum = 0;
+  for (int i = 0; i < ms.size(); ++i) {
+    sum += ms[i];
+  }
+  ostringstream out;
+  out << sum / ms.size() << " ms (min " << caffe::Percentile(ms, 0)
+      << ", median " << caffe::Percentile(ms, 50) << ", p99 "
+      << caffe::Percentile(ms, 99) << ")";
+  return out.str();
+}
+
+// Times FLAGS_iterations passes of net at its current input shape. The
+// first result is the whole net, followed by its layers.
+static vector<TimeResult> TimeNet(Net<float>* net) {
+  const vector<shared_ptr<Layer<float> > >& layers = net->layers();
+  const vector<vector<Blob<float>*> >& bottom_vecs = net->bottom_vecs();
+  const vector<vector<Blob<float>*> >& top_vecs = net->top_vecs();
+  const vector<vector<bool> >& bottom_need_backward =
+      net->bottom_need_backward();
+  vector<TimeResult> results(layers.size() + 1);
+  TimeResult& total = results[0];
+  total.name = net->name();
+  total.flops = 0;
+  total.param_bytes = 0;
+  for (int i = 0; i < net->learnable_params().size(); ++i) {
+    total.param_bytes += net->learnable_params()[i]->count() * sizeof(float);
+  }
+  total.activation_bytes = 0;
+  for (int i = 0; i < net->blobs().size(); ++i) {
+    total.activation_bytes += net->blobs()[i]->count() * sizeof(float);
+  }
+  for (int i = 0; i < layers.size(); ++i) {
+    TimeResult& result = results[i + 1];
+    result.name = layers[i]->layer_param().name();
+    result.type = layers[i]->layer_param().type();
+    result.flops = LayerFlops(layers[i].get(), bottom_vecs[i], top_vecs[i]);
+    total.flops += result.flops;
+    result.param_bytes = 0;
+    for (int j = 0; j < layers[i]->blobs().size(); ++j) {
+      result.param_bytes += layers[i]->blobs()[j]->count() * sizeof(float);
+    }
+    // In-place tops belong to the bottom they overwrite.
+    result.activation_bytes = 0;
+    for (int j = 0; j < top_vecs[i].size(); ++j) {
+      if (std::find(bottom_vecs[i].begin(), bottom_vecs[i].end(),
+          top_vecs[i][j]) == bottom_vecs[i].end()) {
+        result.activation_bytes += top_vecs[i][j]->count() * sizeof(float);
+      }
+    }
   }
-  // Instantiate the caffe net.
-  Net<float> caffe_net(FLAGS_model, phase, FLAGS_level, &stages);
 
   // Do a clean forward and backward pass, so that memory allocation are done
   // and future iterations will be more stable.
@@ -368,27 +663,24 @@ int time() {
   // Note that for the speed benchmark, we will assume that the network does
   // not take any input blobs.
   float initial_loss;
-  caffe_net.Forward(&initial_loss);
+  net->Forward(&initial_loss);
   LOG(INFO) << "Initial loss: " << initial_loss;
-  LOG(INFO) << "Performing Backward";
-  caffe_net.Backward();
+  if (!FLAGS_forward_only) {
+    LOG(INFO) << "Performing Backward";
+    net->Backward();
+  }
+  for (int j = 0; j < FLAGS_warmup; ++j) {
+    net->Forward();
+    if (!FLAGS_forward_only) {
+      net->Backward();
+    }
+  }
 
-  const vector<shared_ptr<Layer<float> > >& layers = caffe_net.layers();
-  const vector<vector<Blob<float>*> >& bottom_vecs = caffe_net.bottom_vecs();
-  const vector<vector<Blob<float>*> >& top_vecs = caffe_net.top_vecs();
-  const vector<vector<bool> >& bottom_need_backward =
-      caffe_net.bottom_need_backward();
-  LOG(INFO) << "*** Benchmark begins ***";
   LOG(INFO) << "Testing for " << FLAGS_iterations << " iterations.";
-  Timer total_timer;
-  total_timer.Start();
   Timer forward_timer;
   Timer backward_timer;
   Timer timer;
-  std::vector<double> forward_time_per_layer(layers.size(), 0.0);
-  std::vector<double> backward_time_per_layer(layers.size(), 0.0);
-  double forward_time = 0.0;
-  double backward_time = 0.0;
+  double iter_time = 0.0;
   for (int j = 0; j < FLAGS_iterations; ++j) {
     Timer iter_timer;
     iter_timer.Start();
@@ -396,39 +688,172 @@ int time() {
     for (int i = 0; i < layers.size(); ++i) {
       timer.Start();
       layers[i]->Forward(bottom_vecs[i], top_vecs[i]);
-      forward_time_per_layer[i] += timer.MicroSeconds();
+      results[i + 1].forward_ms.push_back(timer.MicroSeconds() / 1000);
+    }
+    total.forward_ms.push_back(forward_timer.MicroSeconds() / 1000);
+    if (FLAGS_forward_only) {
+      iter_time += iter_timer.MilliSeconds();
+      LOG(INFO) << "Iteration: " << j + 1 << " forward time: "
+        << iter_timer.MilliSeconds() << " ms.";
+      continue;
     }
-    forward_time += forward_timer.MicroSeconds();
     backward_timer.Start();
     for (int i = layers.size() - 1; i >= 0; --i) {
       timer.Start();
       layers[i]->Backward(top_vecs[i], bottom_need_backward[i],
                           bottom_vecs[i]);
-      backward_time_per_layer[i] += timer.MicroSeconds();
+      results[i + 1].backward_ms.push_back(timer.MicroSeconds() / 1000);
     }
-    backward_time += backward_timer.MicroSeconds();
+    total.backward_ms.push_back(backward_timer.MicroSeconds() / 1000);
+    iter_time += iter_timer.MilliSeconds();
     LOG(INFO) << "Iteration: " << j + 1 << " forward-backward time: "
       << iter_timer.MilliSeconds() << " ms.";
   }
   LOG(INFO) << "Average time per layer: ";
-  for (int i = 0; i < layers.size(); ++i) {
-    const caffe::string& layername = layers[i]->layer_param().name();
-    LOG(INFO) << std::setfill(' ') << std::setw(10) << layername <<
-      "\tforward: " << forward_time_per_layer[i] / 1000 /
-      FLAGS_iterations << " ms.";
-    LOG(INFO) << std::setfill(' ') << std::setw(10) << layername  <<
-      "\tbackward: " << backward_time_per_layer[i] / 1000 /
+  for (int i = 1; i < results.size(); ++i) {
+    const TimeResult& result = results[i];
+    LOG(INFO) << std::setfill(' ') << std::setw(10) << result.name <<
+      "\tforward: " << TimeSummary(result.forward_ms);
+    if (!FLAGS_forward_only) {
+      LOG(INFO) << std::setfill(' ') << std::setw(10) << result.name <<
+        "\tbackward: " << TimeSummary(result.backward_ms);
+    }
+    LOG(INFO) << std::setfill(' ') << std::setw(10) << result.name <<
+      "\tparams: " << result.param_bytes / 1024. << " KB, activations: " <<
+      result.activation_bytes / 1024. << " KB, MFLOPs: " <<
+      result.flops / 1e6;
+  }
+  LOG(INFO) << "Average Forward pass: " << TimeSummary(total.forward_ms);
+  if (!FLAGS_forward_only) {
+    LOG(INFO) << "Average Backward pass: " << TimeSummary(total.backward_ms);
+    LOG(INFO) << "Average Forward-Backward: " << iter_time /
       FLAGS_iterations << " ms.";
   }
-  total_timer.Stop();
-  LOG(INFO) << "Average Forward pass: " << forward_time / 1000 /
-    FLAGS_iterations << " ms.";
-  LOG(INFO) << "Average Backward pass: " << backward_time / 1000 /
-    FLAGS_iterations << " ms.";
-  LOG(INFO) << "Average Forward-Backward: " << total_timer.MilliSeconds() /
-    FLAGS_iterations << " ms.";
-  LOG(INFO) << "Total Time: " << total_timer.MilliSeconds() << " ms.";
+  LOG(INFO) << "Params: " << total.param_bytes / 1048576. <<
+    " MB, activations: " << total.activation_bytes / 1048576. <<
+    " MB, GFLOPs: " << total.flops / 1e9;
+  return results;
+}
+
+static string JsonResult(const TimeResult& result) {
+  ostringstream out;
+  out << "{\"name\": " << caffe::JsonString(result.name);
+  if (result.type.size()) {
+    out << ", \"type\": " << caffe::JsonString(result.type);
+  }
+  out << ", \"flops\": " << result.flops
+      << ", \"param_bytes\": " << result.param_bytes
+      << ", \"activation_bytes\": " << result.activation_bytes
+      << ", \"forward_ms\": " << caffe::JsonPercentiles(result.forward_ms);
+  if (!FLAGS_forward_only) {
+    out << ", \"backward_ms\": " << caffe::JsonPercentiles(result.backward_ms);
+  }
+  out << "}";
+  return out.str();
+}
+
+static string CsvTimes(const vector<double>& ms) {
+  if (ms.empty()) {
+    return ",,,,";
+  }
+  const caffe::PercentileSummary summary = caffe::Summarize(ms);
+  ostringstream out;
+  out << summary.mean << "," << summary.min << "," << summary.p50 << ","
+      << summary.p90 << "," << summary.p99;
+  return out.str();
+}
+
+// Writes the results of each width as CSV when filename ends with .csv, and
+// as JSON otherwise. A width of 0 means the width of the model.
+static void WriteTimeReport(const string& filename, const vector<int>& widths,
+    const vector<vector<TimeResult> >& runs) {
+  ostringstream out;
+  if (boost::algorithm::iends_with(filename, ".csv")) {
+    out << "width,layer,type,flops,param_bytes,activation_bytes,"
+        << "forward_mean_ms,forward_min_ms,forward_p50_ms,forward_p90_ms,"
+        << "forward_p99_ms,backward_mean_ms,backward_min_ms,backward_p50_ms,"
+        << "backward_p90_ms,backward_p99_ms\n";
+    for (int w = 0; w < runs.size(); ++w) {
+      for (int i = 0; i < runs[w].size(); ++i) {
+        const TimeResult& result = runs[w][i];
+        // Layer names are plain identifiers, so they are not quoted.
+        out << widths[w] << "," << result.name << "," << result.type << ","
+            << result.flops << "," << result.param_bytes << ","
+            << result.activation_bytes << "," << CsvTimes(result.forward_ms)
+            << "," << CsvTimes(result.backward_ms) << "\n";
+      }
+    }
+  } else {
+    out << "{\n"
+        << "  \"model\": " << caffe::JsonString(FLAGS_model) << ",\n"
+        << "  \"mode\": \""
+        << (Caffe::mode() == Caffe::GPU ? "GPU" : "CPU") << "\",\n"
+        << "  \"cpu_threads\": " << Caffe::cpu_threads() << ",\n"
+        << "  \"iterations\": " << FLAGS_iterations << ",\n"
+        << "  \"warmup\": " << FLAGS_warmup << ",\n"
+        << "  \"forward_only\": "
+        << (FLAGS_forward_only ? "true" : "false") << ",\n"
+        << "  \"peak_rss_bytes\": " << caffe::PeakMemoryBytes() << ",\n"
+        << "  \"runs\": [";
+    for (int w = 0; w < runs.size(); ++w) {
+      out << (w ? ",\n" : "\n") << "    {\"width\": " << widths[w]
+          << ",\n     \"net\": " << JsonResult(runs[w][0])
+          << ",\n     \"layers\": [";
+      for (int i = 1; i < runs[w].size(); ++i) {
+        out << (i > 1 ? ",\n" : "\n") << "       " << JsonResult(runs[w][i]);
+      }
+      out << "]}";
+    }
+    out << "\n  ]\n}\n";
+  }
+  caffe::WriteFileAtomically(out.str(), filename);
+}
+
+// Time: benchmark the execution time of a model.
+int time() {
+  CHECK_GT(FLAGS_model.size(), 0) << "Need a model definition to time.";
+  CHECK_GE(FLAGS_warmup, 0);
+  caffe::Phase phase = get_phase_from_flags(caffe::TRAIN);
+  vector<string> stages = get_stages_from_flags();
+
+  // Set device id and mode
+  vector<int> gpus;
+  get_gpus(&gpus);
+  if (gpus.size() != 0) {
+    LOG(INFO) << "Use GPU with device ID " << gpus[0];
+    Caffe::SetDevice(gpus[0]);
+    Caffe::set_mode(Caffe::GPU);
+  } else {
+    LOG(INFO) << "Use CPU.";
+    Caffe::set_mode(Caffe::CPU);
+  }
+  // Instantiate the caffe net.
+  Net<float> caffe_net(FLAGS_model, phase, FLAGS_level, &stages);
+
+  vector<int> widths(1, 0);
+  if (FLAGS_widths.size()) {
+    widths = caffe::ParseIntList(FLAGS_widths);
+  }
+
+  LOG(INFO) << "*** Benchmark begins ***";
+  vector<vector<TimeResult> > runs;
+  for (int w = 0; w < widths.size(); ++w) {
+    if (widths[w]) {
+      LOG(INFO) << "Input width " << widths[w];
+      SetInputWidth(&caffe_net, widths[w]);
+    }
+    Timer total_timer;
+    total_timer.Start();
+    runs.push_back(TimeNet(&caffe_net));
+    LOG(INFO) << "Total Time: " << total_timer.MilliSeconds() << " ms.";
+  }
+  LOG(INFO) << "Peak resident memory: "
+      << caffe::PeakMemoryBytes() / 1048576. << " MB";
   LOG(INFO) << "*** Benchmark ends ***";
+  if (FLAGS_report.size()) {
+    WriteTimeReport(FLAGS_report, widths, runs);
+    LOG(INFO) << "Wrote " << FLAGS_report;
+  }
   return 0;
 }
 RegisterBrewFunction(time);
@@ -446,13 +871,15 @@ int main(int argc, char** argv) {
       "  test            score a model\n"
       "  device_query    show GPU diagnostic information\n"
       "  time            benchmark model execution time");
+  g_args.assign(argv, argv + argc);
   // Run tool or show usage.
   caffe::GlobalInit(&argc, &argv);
+  caffe::Caffe::set_cpu_threads(FLAGS_cpu_threads);
   if (argc == 2) {
 #ifdef WITH_PYTHON_LAYER
     try {
 #endif
-      return GetBrewFunction(caffe::string(argv[1]))();
+      return RunBrewFunction(caffe::string(argv[1]));
 #ifdef WITH_PYTHON_LAYER
     } catch (bp::error_already_set) {
       PyErr_Print();
@@ -9,12 +9,14 @@
 //   ....
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>  // NOLINT(readability/streams)
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "boost/scoped_ptr.hpp"
+#include "boost/thread.hpp"
 #include "gflags/gflags.h"
 #include "glog/logging.h"
 
@@ -23,6 +25,7 @@
 #include "caffe/util/format.hpp"
 #include "caffe/util/io.hpp"
 #include "caffe/util/rng.hpp"
+#include "caffe/util/shard.hpp"
 
 #include <windows.h>
 
@@ -43,7 +46,8 @@ DEFINE_bool(gray, false,
 DEFINE_bool(shuffle, false,
     "Randomly shuffle the order of images and their labels");
 DEFINE_string(backend, "leveldb",
-        "The backend {lmdb, leveldb} for storing the result");
+        "The backend {lmdb, leveldb, shard} for storing the result; shard "
+        "writes raw pixels and labels into one file for the ShardData layer");
 DEFINE_int32(resize_width, 0, "Width images are resized to");
 DEFINE_int32(resize_height, 0, "Height images are resized to");
 DEFINE_bool(check_size, false,
@@ -52,8 +56,108 @@ DEFINE_bool(encoded, true,
     "When this option is on, the encoded image will be save in datum");
 DEFINE_string(encode_type, "",
     "Optional: What type should we encode the image as ('png','jpg',...).");
+DEFINE_int32(threads, 1,
+    "Number of threads reading and encoding images; a separate thread "
+    "writes them to the db in list order");
+DEFINE_int32(commit_size, 1000, "Number of images per db transaction");
 
 
+// Write decoded images into a shard. Samples keep their own width unless
+// resize_width > 0; they all need the same height.
+int convert_shard(const std::vector<std::pair<std::string, vector<int> > >& lines,
+	const string& root_folder, const string& filename, bool is_color,
+	int resize_height, int resize_width)
+{
+	size_t label_count = 0;
+	for (int line_id = 0; line_id < lines.size(); ++line_id)
+		label_count = std::max(label_count, lines[line_id].second.size());
+
+	ShardWriter writer;
+	bool opened = false;
+	int height = 0;
+	const int channels = is_color ? 3 : 1;
+	std::vector<uint8_t> pixels;
+	int count = 0;
+	for (int line_id = 0; line_id < lines.size(); ++line_id) {
+		cv::Mat cv_img = ReadImageToCVMat(root_folder + lines[line_id].first,
+			resize_height, resize_width, is_color);
+		if (!cv_img.data) continue;
+		if (!opened) {
+			height = cv_img.rows;
+			writer.Open(filename, channels, height, std::max(resize_width, 0),
+				label_count);
+			opened = true;
+		}
+		CHECK_EQ(cv_img.rows, height) << "All images of a shard need the same "
+			"height; set resize_height: " << lines[line_id].first;
+		// (h, w, c) to (c, h, w)
+		const int width = cv_img.cols;
+		pixels.resize(channels * height * width);
+		for (int h = 0; h < height; ++h) {
+			const uchar* ptr = cv_img.ptr<uchar>(h);
+			for (int w = 0; w < width; ++w)
+				for (int c = 0; c < channels; ++c)
+					pixels[(c * height + h) * width + w] = *ptr++;
+		}
+		writer.Write(pixels.data(), width, lines[line_id].second);
+		if (++count % 1000 == 0)
+			LOG(INFO) << "Processed " << count << " files.";
+	}
+	writer.Close();
+	LOG(INFO) << "Processed " << count << " files.";
+	return 0;
+}
+
+// One image of the list once read and encoded by a worker.
+struct EncodedImage {
+	bool ok;
+	int shape_size;
+	int data_size;
+	string value;
+};
+
+string guess_encoding(const string& fn)
+{
+	size_t p = fn.rfind('.');
+	if (p == fn.npos)
+		LOG(WARNING) << "Failed to guess the encoding of '" << fn << "'";
+	string enc = fn.substr(p);
+	std::transform(enc.begin(), enc.end(), enc.begin(), ::tolower);
+	return enc;
+}
+
+// Read lines [begin, end) into images; worker w takes every num_threads-th
+// line starting at begin + w.
+void encode_images(const std::vector<std::pair<std::string, vector<int> > >& lines,
+	int begin, int end, const string& root_folder, bool is_color,
+	int resize_height, int resize_width, bool encoded, const string& encode_type,
+	int num_threads, std::vector<EncodedImage>* images)
+{
+	images->resize(end - begin);
+	boost::thread_group workers;
+	for (int w = 0; w < num_threads; ++w) {
+		workers.create_thread([&, w]() {
+			Datum datum;
+			for (int line_id = begin + w; line_id < end; line_id += num_threads) {
+				EncodedImage& image = (*images)[line_id - begin];
+				string enc = encode_type;
+				if (encoded && !enc.size()) {
+					// Guess the encoding type from the file name
+					enc = guess_encoding(lines[line_id].first);
+				}
+				image.ok = ReadImageToDatum(root_folder + lines[line_id].first,
+					lines[line_id].second, resize_height, resize_width, is_color,
+					enc, &datum);
+				if (!image.ok) continue;
+				image.shape_size = datum.channels() * datum.height() * datum.width();
+				image.data_size = datum.data().size();
+				CHECK(datum.SerializeToString(&image.value));
+			}
+		});
+	}
+	workers.join_all();
+}
+
 int convert_db(int argc, char** argv)
 {
 
@@ -127,65 +231,68 @@ int convert_db(int argc, char** argv)
 	int resize_height = FLAGS_resize_height;
 	int resize_width = FLAGS_resize_width;
 
+	if (FLAGS_backend == "shard")
+		return convert_shard(lines, argv[1], argv[3], is_color,
+			resize_height, resize_width);
+
 	// Create new DB
 	scoped_ptr<db::DB> db(db::GetDB(FLAGS_backend));
 	db->Open(argv[3], db::NEW);
-	scoped_ptr<db::Transaction> txn(db->NewTransaction());
 
-	// Storing to db
+	// Storing to db. The workers encode one chunk of the list while the
+	// writer commits the previous one in list order, so keys and values do
+	// not depend on the number of threads. LMDB grows its map on demand.
 	std::string root_folder(argv[1]);
-	Datum datum;
+	const int num_threads = std::max(FLAGS_threads, 1);
+	const int commit_size = std::max(FLAGS_commit_size, 1);
+	std::vector<EncodedImage> encoding, writing;
+	int written_begin = 0;
 	int count = 0;
 	int data_size = 0;
 	bool data_size_initialized = false;
-
-	for (int line_id = 0; line_id < lines.size(); ++line_id) {
-		bool status;
-		std::string enc = encode_type;
-		if (encoded && !enc.size()) {
-			// Guess the encoding type from the file name
-			string fn = lines[line_id].first;
-			size_t p = fn.rfind('.');
-			if (p == fn.npos)
-				LOG(WARNING) << "Failed to guess the encoding of '" << fn << "'";
-			enc = fn.substr(p);
-			std::transform(enc.begin(), enc.end(), enc.begin(), ::tolower);
-		}
-		status = ReadImageToDatum(root_folder + lines[line_id].first,
-			lines[line_id].second, resize_height, resize_width, is_color,
-			enc, &datum);
-		if (status == false) continue;
-		if (check_size) {
-			if (!data_size_initialized) {
-				data_size = datum.channels() * datum.height() * datum.width();
-				data_size_initialized = true;
-			}
-			else {
-				const std::string& data = datum.data();
-				CHECK_EQ(data.size(), data_size) << "Incorrect data field size "
-					<< data.size();
+	const std::chrono::steady_clock::time_point start =
+		std::chrono::steady_clock::now();
+
+	auto write_images = [&]() {
+		if (writing.empty()) return;
+		scoped_ptr<db::Transaction> txn(db->NewTransaction());
+		for (int i = 0; i < writing.size(); ++i) {
+			const EncodedImage& image = writing[i];
+			if (!image.ok) continue;
+			if (check_size) {
+				if (!data_size_initialized) {
+					data_size = image.shape_size;
+					data_size_initialized = true;
+				}
+				else {
+					CHECK_EQ(image.data_size, data_size) << "Incorrect data field size "
+						<< image.data_size;
+				}
 			}
+			// sequential
+			const int line_id = written_begin + i;
+			string key_str = caffe::format_int(line_id, 8) + "_" + lines[line_id].first;
+			txn->Put(key_str, image.value);
+			++count;
 		}
-		// sequential
-		string key_str = caffe::format_int(line_id, 8) + "_" + lines[line_id].first;
-
-		// Put in db
-		string out;
-		CHECK(datum.SerializeToString(&out));
-		txn->Put(key_str, out);
-
-		if (++count % 1000 == 0) {
-			// Commit db
-			txn->Commit();
-			txn.reset(db->NewTransaction());
-			LOG(INFO) << "Processed " << count << " files.";
-		}
-	}
-	// write the last batch
-	if (count % 1000 != 0) {
 		txn->Commit();
-		LOG(INFO) << "Processed " << count << " files.";
+		const double seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+		LOG(INFO) << "Processed " << count << " files ("
+			<< count / std::max(seconds, 1e-3) << " images/s).";
+	};
+
+	for (int begin = 0; begin < lines.size(); begin += commit_size) {
+		const int end = std::min<int>(begin + commit_size, lines.size());
+		boost::thread writer(write_images);
+		encode_images(lines, begin, end, root_folder, is_color, resize_height,
+			resize_width, encoded, encode_type, num_threads, &encoding);
+		writer.join();
+		writing.swap(encoding);
+		written_begin = begin;
 	}
+	// write the last chunk
+	write_images();
 	return 0;
 }
 
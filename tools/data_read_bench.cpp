@@ -0,0 +1,124 @@
+// This program measures how fast a Data layer reads a DB in key order and
+// with data_param.shuffle, so that shuffled random-access reads can be
+// compared with sequential reads on a given dataset and disk.
+// Usage:
+//    data_read_bench -db=DB [-backend=lmdb] [-records=10000] [-batch_size=64]
+//        [-num_workers=1] [-shuffle_buffer=0] [-key_index=FILE]
+//
+// Each mode reads the given number of records through a Data layer and logs
+// the records per second of the DB reads alone (PrefetchTimings.read_us) and
+// of the whole Forward, which includes decoding and transforming.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gflags/gflags.h"
+#include "glog/logging.h"
+
+#include "caffe/caffe.hpp"
+#include "caffe/layers/base_data_layer.hpp"
+#include "caffe/util/benchmark.hpp"
+
+using namespace caffe;  // NOLINT(build/namespaces)
+
+DEFINE_string(db, "",
+    "The DB to read.");
+DEFINE_string(backend, "lmdb",
+    "The backend of the DB: lmdb or leveldb.");
+DEFINE_int32(records, 10000,
+    "The number of records to read in each mode.");
+DEFINE_int32(batch_size, 64,
+    "The batch size of the Data layer.");
+DEFINE_int32(num_workers, 1,
+    "The num_workers of the Data layer.");
+DEFINE_int32(shuffle_buffer, 0,
+    "Optional; the shuffle_buffer of the shuffled mode.");
+DEFINE_string(key_index, "",
+    "Optional; the key_index of the shuffled mode.");
+
+struct ReadResult {
+  double setup_ms;
+  double read_ms;
+  double forward_ms;
+  int records;
+};
+
+static ReadResult ReadRecords(bool shuffle) {
+  LayerParameter param;
+  param.set_name(shuffle ? "shuffled" : "sequential");
+  param.set_type("Data");
+  param.set_phase(TRAIN);
+  DataParameter* data_param = param.mutable_data_param();
+  data_param->set_source(FLAGS_db);
+  data_param->set_backend(FLAGS_backend == "leveldb" ?
+      DataParameter_DB_LEVELDB : DataParameter_DB_LMDB);
+  data_param->set_batch_size(FLAGS_batch_size);
+  data_param->set_num_workers(FLAGS_num_workers);
+  data_param->set_shuffle(shuffle);
+  if (shuffle) {
+    data_param->set_shuffle_buffer(FLAGS_shuffle_buffer);
+    if (FLAGS_key_index.size()) {
+      data_param->set_key_index(FLAGS_key_index);
+    }
+  }
+
+  Blob<float> data, label;
+  vector<Blob<float>*> bottom, top;
+  top.push_back(&data);
+  top.push_back(&label);
+  ReadResult result;
+  Timer timer;
+  timer.Start();
+  shared_ptr<Layer<float> > layer = LayerRegistry<float>::CreateLayer(param);
+  layer->SetUp(bottom, top);
+  result.setup_ms = timer.MilliSeconds();
+
+  BasePrefetchingDataLayer<float>* data_layer =
+      dynamic_cast<BasePrefetchingDataLayer<float>*>(layer.get());
+  CHECK(data_layer);
+  // The first batch was read while the layer was set up.
+  layer->Forward(bottom, top);
+  data_layer->ResetTimings();
+  const int batches =
+      (FLAGS_records + FLAGS_batch_size - 1) / FLAGS_batch_size;
+  timer.Start();
+  for (int i = 0; i < batches; ++i) {
+    layer->Forward(bottom, top);
+  }
+  result.forward_ms = timer.MilliSeconds();
+  result.read_ms = data_layer->timings().read_us / 1000;
+  result.records = batches * FLAGS_batch_size;
+  return result;
+}
+
+static void Report(const char* mode, const ReadResult& result) {
+  LOG(INFO) << mode << ": " << result.records << " records, "
+      << result.records * 1000. / std::max(result.read_ms, 1e-3)
+      << " records/s read, "
+      << result.records * 1000. / std::max(result.forward_ms, 1e-3)
+      << " records/s through Forward (setup " << result.setup_ms << " ms)";
+}
+
+int main(int argc, char** argv) {
+  // Print output to stderr (while still logging).
+  FLAGS_alsologtostderr = 1;
+  gflags::SetUsageMessage("Compares sequential and shuffled reads of a DB.\n"
+      "Usage:\n"
+      "    data_read_bench -db=DB [-backend=lmdb] [-records=10000] "
+      "[-batch_size=64]\n");
+  caffe::GlobalInit(&argc, &argv);
+  CHECK(FLAGS_db.size()) << "-db is required";
+  CHECK_GT(FLAGS_records, 0);
+  CHECK_GT(FLAGS_batch_size, 0);
+  Caffe::set_mode(Caffe::CPU);
+
+  const ReadResult sequential = ReadRecords(false);
+  const ReadResult shuffled = ReadRecords(true);
+  Report("sequential", sequential);
+  Report("shuffled  ", shuffled);
+  LOG(INFO) << "Shuffled reads take "
+      << shuffled.read_ms / std::max(sequential.read_ms, 1e-3)
+      << "x the time of sequential reads.";
+  return 0;
+}
@@ -0,0 +1,39 @@
+// This is a script to fold BatchNorm/Scale layers into the preceding
+// Convolution/InnerProduct layers (and ReLUs into convolutions) of a deploy
+// net, for faster inference.
+// Usage:
+//    fold_batchnorm deploy.prototxt model.caffemodel
+//        folded_deploy.prototxt folded_model.caffemodel
+
+#include <string>
+
+#include "caffe/caffe.hpp"
+#include "caffe/util/fold_batchnorm.hpp"
+#include "caffe/util/io.hpp"
+#include "caffe/util/upgrade_proto.hpp"
+
+using namespace caffe;  // NOLINT(build/namespaces)
+
+int main(int argc, char** argv) {
+  FLAGS_alsologtostderr = 1;  // Print output to stderr (while still logging)
+  ::google::InitGoogleLogging(argv[0]);
+  if (argc != 5) {
+    LOG(ERROR) << "Usage: fold_batchnorm deploy.prototxt model.caffemodel "
+               << "folded_deploy.prototxt folded_model.caffemodel";
+    return 1;
+  }
+
+  NetParameter net_param, weights;
+  ReadNetParamsFromTextFileOrDie(string(argv[1]), &net_param);
+  ReadNetParamsFromBinaryFileOrDie(string(argv[2]), &weights);
+
+  NetParameter folded_param, folded_weights;
+  const int num_folded =
+      FoldBatchNorm(net_param, weights, &folded_param, &folded_weights);
+
+  WriteProtoToTextFile(folded_param, argv[3]);
+  WriteProtoToBinaryFile(folded_weights, argv[4]);
+  LOG(INFO) << "Folded " << num_folded << " layers, wrote " << argv[3]
+            << " and " << argv[4];
+  return 0;
+}
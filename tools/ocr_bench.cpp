@@ -0,0 +1,769 @@
+// This program benchmarks a CTC text line recognizer end to end. Reading and
+// decoding the images, preprocessing, the forward pass, CTC decoding and the
+// lexicon search are timed separately, for every combination of the given
+// batch sizes and numbers of threads.
+// Usage:
+//    ocr_bench -model_folder=MODEL/ -images=LISTFILE [-lexicon=LEXICON]
+//        [-batch_sizes=1,8] [-threads=1,4] [-json=RESULTS.json]
+//
+// where MODEL holds deploy.prototxt, model.caffemodel, label.txt and
+// mean_values.txt (or mean.binaryproto), and LISTFILE has one line per image
+// with the ground truth text after the filename, in the encoding of label.txt:
+//    subfolder1/file1.jpg text of the line
+//    ....
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>  // NOLINT(readability/streams)
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "boost/algorithm/string.hpp"
+#include "boost/bind.hpp"
+#include "boost/thread.hpp"
+#include "gflags/gflags.h"
+#include "glog/logging.h"
+
+#include "caffe/caffe.hpp"
+#include "caffe/util/benchmark.hpp"
+#include "caffe/util/io.hpp"
+#include "ctcpp.h"
+
+#ifdef USE_OPENCV
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#endif  // USE_OPENCV
+
+using namespace caffe;  // NOLINT(build/namespaces)
+using std::map;
+using std::pair;
+
+DEFINE_string(model_folder, "",
+    "The folder of deploy.prototxt, model.caffemodel, label.txt and "
+    "mean_values.txt or mean.binaryproto.");
+DEFINE_string(images, "",
+    "The list of images, one 'filename text' line per image.");
+DEFINE_string(root_folder, "",
+    "Optional; the folder the filenames of the list are relative to.");
+DEFINE_string(lexicon, "",
+    "Optional; a file of one word per line. Each recognized line is "
+    "replaced by the word within a small edit distance of it with the "
+    "lowest CTC loss.");
+DEFINE_string(batch_sizes, "1",
+    "The batch sizes to benchmark, separated by ','.");
+DEFINE_string(threads, "1",
+    "The numbers of threads to benchmark, separated by ','. Each thread "
+    "runs its own net on the shared weights.");
+DEFINE_int32(cpu_threads, 1,
+    "Optional; the number of threads CPU layers of each net may use.");
+DEFINE_int32(gpu, -1,
+    "Optional; run in GPU mode on this device.");
+DEFINE_int32(iterations, 1,
+    "The number of passes over the images for each configuration.");
+DEFINE_int32(max_images, 0,
+    "Optional; only use this many images of the list.");
+DEFINE_string(json, "",
+    "Optional; also write the results to this file as JSON.");
+
+#ifdef USE_OPENCV
+
+enum Stage {
+  kDecode,
+  kPreprocess,
+  kForward,
+  kCTCDecode,
+  kLexicon,
+  kNumStages
+};
+
+static const char* kStageNames[kNumStages] = {
+  "decode", "preprocess", "forward", "ctc_decode", "lexicon"
+};
+
+static int EditDistance(const vector<int>& a, const vector<int>& b) {
+  vector<int> row(b.size() + 1);
+  for (int j = 0; j <= b.size(); ++j) {
+    row[j] = j;
+  }
+  for (int i = 1; i <= a.size(); ++i) {
+    int diagonal = row[0];
+    row[0] = i;
+    for (int j = 1; j <= b.size(); ++j) {
+      const int above = row[j];
+      row[j] = std::min(std::min(row[j], row[j - 1]) + 1,
+          diagonal + (a[i - 1] == b[j - 1] ? 0 : 1));
+      diagonal = above;
+    }
+  }
+  return row[b.size()];
+}
+
+// Maps text to label indices. Text is split into the longest labels
+// first; characters without a label map to -1.
+class Alphabet {
+ public:
+  explicit Alphabet(const vector<string>& labels)
+      : labels_(labels), max_length_(0) {
+    for (int i = 0; i < labels.size(); ++i) {
+      if (labels[i].size() && labels[i] != "blank") {
+        index_[labels[i]] = i;
+        max_length_ = std::max(max_length_, labels[i].size());
+      }
+    }
+  }
+
+  vector<int> Encode(const string& text) const {
+    vector<int> sequence;
+    size_t pos = 0;
+    while (pos < text.size()) {
+      size_t length = std::min(max_length_, text.size() - pos);
+      for (; length > 0; --length) {
+        map<string, int>::const_iterator it =
+            index_.find(text.substr(pos, length));
+        if (it != index_.end()) {
+          sequence.push_back(it->second);
+          break;
+        }
+      }
+      if (length == 0) {
+        sequence.push_back(-1);
+        length = 1;
+      }
+      pos += length;
+    }
+    return sequence;
+  }
+
+  inline int size() const { return labels_.size(); }
+
+ private:
+  vector<string> labels_;
+  map<string, int> index_;
+  size_t max_length_;
+};
+
+// A BK-tree of the words of a lexicon, to find the words within an edit
+// distance of a recognized line.
+class Lexicon {
+ public:
+  void Add(const vector<int>& word) {
+    if (nodes_.empty()) {
+      nodes_.push_back(Node(word));
+      return;
+    }
+    int node = 0;
+    while (true) {
+      const int distance = EditDistance(word, nodes_[node].word);
+      if (distance == 0) {
+        return;
+      }
+      map<int, int>::const_iterator it = nodes_[node].children.find(distance);
+      if (it == nodes_[node].children.end()) {
+        nodes_[node].children[distance] = nodes_.size();
+        nodes_.push_back(Node(word));
+        return;
+      }
+      node = it->second;
+    }
+  }
+
+  void Query(const vector<int>& word, int max_distance,
+      vector<const vector<int>*>* matches) const {
+    matches->clear();
+    if (nodes_.empty()) {
+      return;
+    }
+    vector<int> pending(1, 0);
+    while (pending.size()) {
+      const Node& node = nodes_[pending.back()];
+      pending.pop_back();
+      const int distance = EditDistance(word, node.word);
+      if (distance <= max_distance) {
+        matches->push_back(&node.word);
+      }
+      map<int, int>::const_iterator it =
+          node.children.lower_bound(distance - max_distance);
+      for (; it != node.children.end() &&
+          it->first <= distance + max_distance; ++it) {
+        pending.push_back(it->second);
+      }
+    }
+  }
+
+  inline int size() const { return nodes_.size(); }
+
+ private:
+  struct Node {
+    explicit Node(const vector<int>& w) : word(w) {}
+    vector<int> word;
+    // Child node by its distance to this one.
+    map<int, int> children;
+  };
+  vector<Node> nodes_;
+};
+
+struct Sample {
+  string filename;
+  // Label indices of the ground truth, empty when the list has none.
+  vector<int> truth;
+};
+
+// What one batch measured, in milliseconds.
+struct BatchResult {
+  BatchResult() : latency(0) {
+    std::fill(stages, stages + kNumStages, 0.);
+  }
+  double stages[kNumStages];
+  double latency;
+};
+
+// The batches of one configuration, handed out to the threads in order.
+struct Job {
+  Job(const vector<Sample>& s, int size, int num)
+      : samples(s), batch_size(size),
+        num_batches((s.size() + size - 1) / size), next(0),
+        results(num_batches * num), greedy(s.size()), recognized(s.size()) {}
+
+  // Returns the index of the next batch to run, or -1 when all ran.
+  int Next() {
+    boost::mutex::scoped_lock lock(mutex);
+    return next < static_cast<int>(results.size()) ? next++ : -1;
+  }
+
+  const vector<Sample>& samples;
+  const int batch_size;
+  const int num_batches;
+  boost::mutex mutex;
+  int next;
+  vector<BatchResult> results;
+  // Label indices by image, of the greedy CTC decoding and after the
+  // lexicon search.
+  vector<vector<int> > greedy;
+  vector<vector<int> > recognized;
+};
+
+// The trained net and what it needs to recognize a line.
+struct Model {
+  explicit Model(const string& folder) {
+    ReadNetParamsFromTextFileOrDie(folder + "/deploy.prototxt", &param);
+    param.mutable_state()->set_phase(TEST);
+    weights = folder + "/model.caffemodel";
+
+    std::ifstream labels_file((folder + "/label.txt").c_str());
+    CHECK(labels_file) << "Unable to open " << folder << "/label.txt";
+    string line;
+    while (std::getline(labels_file, line)) {
+      boost::trim_right_if(line, boost::is_any_of("\r"));
+      labels.push_back(line);
+    }
+
+    std::ifstream mean_file((folder + "/mean_values.txt").c_str());
+    if (mean_file) {
+      while (std::getline(mean_file, line)) {
+        if (line.size()) {
+          mean.push_back(atof(line.c_str()));
+        }
+      }
+    } else {
+      // A mean image is reduced to the mean value of each channel.
+      BlobProto proto;
+      ReadProtoFromBinaryFileOrDie(folder + "/mean.binaryproto", &proto);
+      Blob<float> blob;
+      blob.FromProto(proto);
+      const int dim = blob.height() * blob.width();
+      for (int c = 0; c < blob.channels(); ++c) {
+        const float* data = blob.cpu_data() + c * dim;
+        mean.push_back(std::accumulate(data, data + dim, 0.) / dim);
+      }
+    }
+  }
+
+  NetParameter param;
+  string weights;
+  vector<string> labels;
+  vector<float> mean;
+};
+
+// Recognizes batches of images with its own net.
+class Worker {
+ public:
+  Worker(const Model& model, const Lexicon& lexicon, const Net<float>* shared)
+      : model_(model), lexicon_(lexicon),
+        net_(new Net<float>(model.param)) {
+    if (shared) {
+      net_->ShareTrainedLayersWith(shared);
+    } else {
+      net_->CopyTrainedLayersFrom(model.weights);
+    }
+    CHECK_EQ(net_->num_inputs(), 1) << "Network should have exactly one input.";
+    Blob<float>* input = net_->input_blobs()[0];
+    channels_ = input->channels();
+    CHECK(channels_ == 3 || channels_ == 1)
+        << "Input layer should have 1 or 3 channels.";
+    CHECK(model.mean.size() == 1 || model.mean.size() == channels_)
+        << "Wrong number of mean values.";
+    geometry_ = cv::Size(input->width(), input->height());
+
+    // The OCR deploy nets end with a CTCGreedyDecoder layer; its bottom
+    // holds the TxNxC activations, decoded here instead.
+    const vector<shared_ptr<Layer<float> > >& layers = net_->layers();
+    end_ = layers.size() - 1;
+    acts_ = net_->output_blobs()[0];
+    blank_ = 0;
+    if (strcmp(layers[end_]->type(), "CTCGreedyDecoder") == 0) {
+      acts_ = net_->bottom_vecs()[end_][0];
+      blank_ = layers[end_]->layer_param().ctc_decoder_param().blank_index();
+      --end_;
+    }
+    CHECK_EQ(acts_->num_axes(), 3) << "CTC activations should be TxNxC";
+    if (blank_ < 0) {
+      blank_ = acts_->shape(2) - 1;
+    }
+    // Has the net applied the softmax already?
+    is_prob_ = false;
+    for (int i = end_; i >= 0; --i) {
+      const vector<Blob<float>*>& tops = net_->top_vecs()[i];
+      if (std::find(tops.begin(), tops.end(), acts_) != tops.end()) {
+        is_prob_ = (strcmp(layers[i]->type(), "Softmax") == 0);
+        break;
+      }
+    }
+  }
+
+  inline const Net<float>* net() const { return net_.get(); }
+
+  // Runs the batches of job until there are none left.
+  void Run(Job* job) {
+    if (FLAGS_gpu >= 0) {
+      Caffe::SetDevice(FLAGS_gpu);
+      Caffe::set_mode(Caffe::GPU);
+    } else {
+      Caffe::set_mode(Caffe::CPU);
+    }
+    Caffe::set_cpu_threads(FLAGS_cpu_threads);
+    for (int i = job->Next(); i >= 0; i = job->Next()) {
+      Recognize(job, i % job->num_batches, i < job->num_batches,
+          &job->results[i]);
+    }
+  }
+
+  // Recognizes a batch of job. The predictions are kept with record.
+  void Recognize(Job* job, int batch, bool record, BatchResult* result) {
+    CPUTimer batch_timer;
+    CPUTimer timer;
+    batch_timer.Start();
+    const int begin = batch * job->batch_size;
+    const int end = std::min<int>(begin + job->batch_size,
+        job->samples.size());
+    Blob<float>* input = net_->input_blobs()[0];
+    if (input->num() != end - begin) {
+      input->Reshape(end - begin, channels_, geometry_.height,
+          geometry_.width);
+      net_->Reshape();
+    }
+    for (int i = begin; i < end; ++i) {
+      timer.Start();
+      cv::Mat image = ReadImage(job->samples[i].filename);
+      result->stages[kDecode] += timer.MicroSeconds() / 1000;
+      timer.Start();
+      Preprocess(image, i - begin);
+      result->stages[kPreprocess] += timer.MicroSeconds() / 1000;
+    }
+    timer.Start();
+    net_->ForwardFromTo(0, end_);
+    // Includes the copy to the host in GPU mode.
+    const float* acts = acts_->cpu_data();
+    result->stages[kForward] += timer.MicroSeconds() / 1000;
+    for (int i = begin; i < end; ++i) {
+      timer.Start();
+      vector<int> greedy;
+      Decode(acts, i - begin, &greedy);
+      result->stages[kCTCDecode] += timer.MicroSeconds() / 1000;
+      timer.Start();
+      vector<int> recognized = greedy;
+      if (lexicon_.size()) {
+        SearchLexicon(acts, i - begin, greedy, &recognized);
+      }
+      result->stages[kLexicon] += timer.MicroSeconds() / 1000;
+      if (record) {
+        job->greedy[i].swap(greedy);
+        job->recognized[i].swap(recognized);
+      }
+    }
+    result->latency = batch_timer.MicroSeconds() / 1000;
+  }
+
+ private:
+  cv::Mat ReadImage(const string& filename) {
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    CHECK(file) << "Unable to open " << filename;
+    buffer_.assign(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+    cv::Mat image = cv::imdecode(cv::Mat(buffer_), channels_ == 3 ?
+        CV_LOAD_IMAGE_COLOR : CV_LOAD_IMAGE_GRAYSCALE);
+    CHECK(image.data) << "Could not decode " << filename;
+    return image;
+  }
+
+  // Writes image as item n of the input blob.
+  void Preprocess(const cv::Mat& image, int n) {
+    cv::Mat resized;
+    if (image.size() != geometry_) {
+      cv::resize(image, resized, geometry_);
+    } else {
+      resized = image;
+    }
+    cv::Mat sample;
+    resized.convertTo(sample, channels_ == 3 ? CV_32FC3 : CV_32FC1);
+    Blob<float>* input = net_->input_blobs()[0];
+    float* data = input->mutable_cpu_data() + input->offset(n);
+    vector<cv::Mat> planes;
+    for (int c = 0; c < channels_; ++c) {
+      planes.push_back(cv::Mat(geometry_, CV_32FC1,
+          data + c * geometry_.area()));
+    }
+    cv::split(sample, planes);
+    for (int c = 0; c < channels_; ++c) {
+      planes[c] -= cv::Scalar(model_.mean[model_.mean.size() == 1 ? 0 : c]);
+    }
+  }
+
+  // Greedy CTC decoding of line n of the activations.
+  void Decode(const float* acts, int n, vector<int>* sequence) const {
+    const int T = acts_->shape(0), N = acts_->shape(1), C = acts_->shape(2);
+    int previous = -1;
+    for (int t = 0; t < T; ++t) {
+      const float* frame = acts + (t * N + n) * C;
+      const int label = std::max_element(frame, frame + C) - frame;
+      if (label != blank_ && label != previous) {
+        sequence->push_back(label);
+      }
+      previous = label;
+    }
+  }
+
+  // Replaces the greedy decoding of line n by the word of the lexicon
+  // within a small edit distance of it with the lowest CTC loss.
+  void SearchLexicon(const float* acts, int n, const vector<int>& greedy,
+      vector<int>* recognized) {
+    const int max_distance = std::min<int>(2, greedy.size() / 3);
+    lexicon_.Query(greedy, max_distance, &matches_);
+    if (matches_.size() == 1) {
+      *recognized = *matches_[0];
+    }
+    if (matches_.size() <= 1) {
+      return;
+    }
+    const int T = acts_->shape(0), N = acts_->shape(1), C = acts_->shape(2);
+    frames_.resize(T * C);
+    for (int t = 0; t < T; ++t) {
+      const float* frame = acts + (t * N + n) * C;
+      for (int c = 0; c < C; ++c) {
+        // The CTC loss applies the softmax itself.
+        frames_[t * C + c] = is_prob_ ?
+            std::log(std::max(frame[c], 1e-20f)) : frame[c];
+      }
+    }
+    float best = std::numeric_limits<float>::max();
+    for (int i = 0; i < matches_.size(); ++i) {
+      const float cost = CTCLoss(T, C, *matches_[i]);
+      if (cost < best) {
+        best = cost;
+        *recognized = *matches_[i];
+      }
+    }
+  }
+
+  float CTCLoss(int timesteps, int alphabet_size, const vector<int>& word) {
+    ctcOptions options;
+    options.loc = CTC_CPU;
+    options.num_threads = 1;
+    options.blank_label = blank_;
+    const int length = word.size();
+    size_t bytes = 0;
+    if (CTC::get_workspace_size<float>(&length, &timesteps, alphabet_size, 1,
+        options, &bytes) != CTC_STATUS_SUCCESS) {
+      return std::numeric_limits<float>::max();
+    }
+    workspace_.resize(bytes);
+    float cost = 0;
+    if (CTC::compute_ctc_loss_cpu<float>(&frames_[0], NULL, &word[0], &length,
+        &timesteps, alphabet_size, 1, &cost, &workspace_[0], options)
+        != CTC_STATUS_SUCCESS) {
+      return std::numeric_limits<float>::max();
+    }
+    return cost;
+  }
+
+  const Model& model_;
+  const Lexicon& lexicon_;
+  shared_ptr<Net<float> > net_;
+  int channels_;
+  cv::Size geometry_;
+  int end_;
+  const Blob<float>* acts_;
+  int blank_;
+  bool is_prob_;
+  // Buffers reused by every line.
+  vector<char> buffer_;
+  vector<const vector<int>*> matches_;
+  vector<float> frames_;
+  vector<char> workspace_;
+
+  DISABLE_COPY_AND_ASSIGN(Worker);
+};
+
+// The measurements of one configuration.
+struct Summary {
+  int batch_size;
+  int threads;
+  int images;
+  double seconds;
+  vector<double> latency;
+  vector<double> stages[kNumStages];
+  // Accuracy over the images with a ground truth.
+  int lines;
+  double line_accuracy;
+  double char_error_rate;
+  double lexicon_line_accuracy;
+  double lexicon_char_error_rate;
+};
+
+static void Accuracy(const vector<Sample>& samples,
+    const vector<vector<int> >& predictions, int* lines,
+    double* line_accuracy, double* char_error_rate) {
+  int correct = 0;
+  int64_t errors = 0;
+  int64_t chars = 0;
+  *lines = 0;
+  for (int i = 0; i < samples.size(); ++i) {
+    if (samples[i].truth.empty()) {
+      continue;
+    }
+    ++*lines;
+    const int distance = EditDistance(predictions[i], samples[i].truth);
+    correct += (distance == 0);
+    errors += distance;
+    chars += samples[i].truth.size();
+  }
+  *line_accuracy = *lines ? static_cast<double>(correct) / *lines : 0;
+  *char_error_rate = chars ? static_cast<double>(errors) / chars : 0;
+}
+
+static Summary Run(const vector<Sample>& samples,
+    const vector<shared_ptr<Worker> >& workers, int batch_size, int threads) {
+  // Reshape every net to the batch size before timing.
+  for (int i = 0; i < threads; ++i) {
+    Job warmup(samples, batch_size, 1);
+    BatchResult result;
+    workers[i]->Recognize(&warmup, 0, false, &result);
+  }
+  Job job(samples, batch_size, FLAGS_iterations);
+  CPUTimer timer;
+  timer.Start();
+  boost::thread_group group;
+  for (int i = 0; i < threads; ++i) {
+    group.create_thread(boost::bind(&Worker::Run, workers[i].get(), &job));
+  }
+  group.join_all();
+
+  Summary summary;
+  summary.batch_size = batch_size;
+  summary.threads = threads;
+  summary.images = samples.size() * FLAGS_iterations;
+  summary.seconds = timer.Seconds();
+  for (int i = 0; i < job.results.size(); ++i) {
+    summary.latency.push_back(job.results[i].latency);
+    for (int s = 0; s < kNumStages; ++s) {
+      summary.stages[s].push_back(job.results[i].stages[s]);
+    }
+  }
+  Accuracy(samples, job.greedy, &summary.lines, &summary.line_accuracy,
+      &summary.char_error_rate);
+  Accuracy(samples, job.recognized, &summary.lines,
+      &summary.lexicon_line_accuracy, &summary.lexicon_char_error_rate);
+  return summary;
+}
+
+static string Percentiles(const vector<double>& samples) {
+  std::ostringstream out;
+  out << "p50 " << Percentile(samples, 50) << " ms, p90 "
+      << Percentile(samples, 90) << " ms, p99 " << Percentile(samples, 99)
+      << " ms";
+  return out.str();
+}
+
+static void LogSummary(const Summary& summary, bool lexicon) {
+  LOG(INFO) << "Batch size " << summary.batch_size << ", "
+      << summary.threads << " threads: "
+      << summary.images / summary.seconds << " images/s";
+  LOG(INFO) << "    batch latency: " << Percentiles(summary.latency);
+  for (int s = 0; s < kNumStages; ++s) {
+    if (s != kLexicon || lexicon) {
+      LOG(INFO) << "    " << kStageNames[s] << ": "
+          << Percentiles(summary.stages[s]);
+    }
+  }
+  if (summary.lines) {
+    LOG(INFO) << "    line accuracy " << summary.line_accuracy
+        << ", char error rate " << summary.char_error_rate;
+    LOG_IF(INFO, lexicon) << "    with lexicon: line accuracy "
+        << summary.lexicon_line_accuracy << ", char error rate "
+        << summary.lexicon_char_error_rate;
+  }
+}
+
+static void WriteJson(const string& filename, const vector<Summary>& summaries,
+    int lexicon_words) {
+  std::ostringstream out;
+  out << "{\n"
+      << "  \"model_folder\": " << JsonString(FLAGS_model_folder) << ",\n"
+      << "  \"images\": " << JsonString(FLAGS_images) << ",\n"
+      << "  \"lexicon_words\": " << lexicon_words << ",\n"
+      << "  \"mode\": \"" << (FLAGS_gpu >= 0 ? "GPU" : "CPU") << "\",\n"
+      << "  \"cpu_threads\": " << FLAGS_cpu_threads << ",\n"
+      << "  \"peak_rss_bytes\": " << PeakMemoryBytes() << ",\n"
+      << "  \"results\": [";
+  for (int i = 0; i < summaries.size(); ++i) {
+    const Summary& summary = summaries[i];
+    out << (i ? ",\n" : "\n")
+        << "    {\"batch_size\": " << summary.batch_size
+        << ", \"threads\": " << summary.threads
+        << ", \"images\": " << summary.images
+        << ", \"seconds\": " << summary.seconds
+        << ", \"images_per_second\": " << summary.images / summary.seconds
+        << ",\n     \"batch_latency_ms\": "
+        << JsonPercentiles(summary.latency)
+        << ",\n     \"stages_ms\": {";
+    for (int s = 0; s < kNumStages; ++s) {
+      out << (s ? ",\n       " : "\n       ") << JsonString(kStageNames[s])
+          << ": " << JsonPercentiles(summary.stages[s]);
+    }
+    out << "},\n     \"lines\": " << summary.lines
+        << ", \"line_accuracy\": " << summary.line_accuracy
+        << ", \"char_error_rate\": " << summary.char_error_rate
+        << ", \"lexicon_line_accuracy\": " << summary.lexicon_line_accuracy
+        << ", \"lexicon_char_error_rate\": "
+        << summary.lexicon_char_error_rate << "}";
+  }
+  out << "\n  ]\n}\n";
+  WriteFileAtomically(out.str(), filename);
+}
+
+int benchmark() {
+  CHECK_GT(FLAGS_model_folder.size(), 0) << "Need a model folder.";
+  CHECK_GT(FLAGS_images.size(), 0) << "Need a list of images.";
+  CHECK_GT(FLAGS_iterations, 0);
+  if (FLAGS_gpu >= 0) {
+    LOG(INFO) << "Use GPU with device ID " << FLAGS_gpu;
+    Caffe::SetDevice(FLAGS_gpu);
+    Caffe::set_mode(Caffe::GPU);
+  } else {
+    LOG(INFO) << "Use CPU.";
+    Caffe::set_mode(Caffe::CPU);
+  }
+  Caffe::set_cpu_threads(FLAGS_cpu_threads);
+  const vector<int> batch_sizes = ParseIntList(FLAGS_batch_sizes);
+  const vector<int> threads = ParseIntList(FLAGS_threads);
+
+  Model model(FLAGS_model_folder);
+  Alphabet alphabet(model.labels);
+
+  vector<Sample> samples;
+  std::ifstream list(FLAGS_images.c_str());
+  CHECK(list) << "Unable to open " << FLAGS_images;
+  string line;
+  while (std::getline(list, line) &&
+      (FLAGS_max_images <= 0 ||
+      static_cast<int>(samples.size()) < FLAGS_max_images)) {
+    boost::trim_right_if(line, boost::is_any_of("\r\n"));
+    if (line.empty()) {
+      continue;
+    }
+    const size_t blank = line.find_first_of(" \t");
+    Sample sample;
+    sample.filename = FLAGS_root_folder + line.substr(0, blank);
+    if (blank != string::npos) {
+      sample.truth = alphabet.Encode(line.substr(blank + 1));
+    }
+    samples.push_back(sample);
+  }
+  CHECK_GT(samples.size(), 0) << "No images in " << FLAGS_images;
+  LOG(INFO) << "A total of " << samples.size() << " images.";
+
+  Lexicon lexicon;
+  if (FLAGS_lexicon.size()) {
+    std::ifstream words(FLAGS_lexicon.c_str());
+    CHECK(words) << "Unable to open " << FLAGS_lexicon;
+    int skipped = 0;
+    while (std::getline(words, line)) {
+      boost::trim_right_if(line, boost::is_any_of("\r\n"));
+      if (line.empty()) {
+        continue;
+      }
+      const vector<int> word = alphabet.Encode(line);
+      if (std::find(word.begin(), word.end(), -1) != word.end()) {
+        ++skipped;
+        continue;
+      }
+      lexicon.Add(word);
+    }
+    LOG(INFO) << "Lexicon of " << lexicon.size() << " words, skipped "
+        << skipped << " with characters without a label.";
+  }
+
+  // The first net holds the weights; the others share them.
+  vector<shared_ptr<Worker> > workers;
+  const int max_threads = *std::max_element(threads.begin(), threads.end());
+  for (int i = 0; i < max_threads; ++i) {
+    workers.push_back(shared_ptr<Worker>(new Worker(model, lexicon,
+        i ? workers[0]->net() : NULL)));
+  }
+
+  LOG(INFO) << "*** Benchmark begins ***";
+  vector<Summary> summaries;
+  for (int b = 0; b < batch_sizes.size(); ++b) {
+    for (int t = 0; t < threads.size(); ++t) {
+      summaries.push_back(Run(samples, workers, batch_sizes[b], threads[t]));
+      LogSummary(summaries.back(), lexicon.size() > 0);
+    }
+  }
+  LOG(INFO) << "Peak resident memory: " << PeakMemoryBytes() / (1 << 20)
+      << " MB";
+  LOG(INFO) << "*** Benchmark ends ***";
+  if (FLAGS_json.size()) {
+    WriteJson(FLAGS_json, summaries, lexicon.size());
+    LOG(INFO) << "Wrote " << FLAGS_json;
+  }
+  return 0;
+}
+
+#endif  // USE_OPENCV
+
+int main(int argc, char** argv) {
+  // Print output to stderr (while still logging).
+  FLAGS_alsologtostderr = 1;
+  gflags::SetUsageMessage("Benchmarks a CTC text line recognizer end to "
+      "end.\n"
+      "Usage:\n"
+      "    ocr_bench -model_folder=MODEL/ -images=LISTFILE [-lexicon=...]\n"
+      "        [-batch_sizes=1,8] [-threads=1,4] [-json=RESULTS.json]\n");
+  caffe::GlobalInit(&argc, &argv);
+#ifdef USE_OPENCV
+  return benchmark();
+#else
+  LOG(FATAL) << "This tool requires OpenCV; compile with USE_OPENCV.";
+  return 0;
+#endif  // USE_OPENCV
+}
@@ -0,0 +1,392 @@
+// This program times the forward and backward passes of the layers that the
+// OCR models add on top of stock Caffe (Transpose, Reverse, DenseBlock,
+// WarpCTCLoss and CTCGreedyDecoder), each on its own with the shapes of the
+// densenet models in examples/ocr.
+// Usage:
+//    ocr_layer_bench [-batch_sizes=1,8,64] [-lengths=35,70] [-filter=Dense,CTC]
+//        [-json=RESULTS.json] [-baseline=BASELINE.json [-tolerance=0.1]]
+//
+// A sequence length T corresponds to an input line 8 * T pixels wide; the
+// three dense blocks run at 16 x 4T, 8 x 2T and 4 x T. With -baseline, the
+// median times are compared to a file written earlier with -json, and the
+// program exits with 1 if a case got slower by more than the tolerance.
+// Medians below -min_ms in the baseline are not compared.
+//
+// examples/ocr/ocr_layer_baseline.json is the checked-in baseline; its
+// "machine" and "cpu_threads" fields record where it was measured, and it
+// only holds the cases it was run with (see its "filter"). Compare against
+// it on the same kind of machine, e.g.
+//    ocr_layer_bench -filter=Transpose,Reverse,WarpCTCLoss,CTCGreedyDecoder
+//        -baseline=examples/ocr/ocr_layer_baseline.json
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>  // NOLINT(readability/streams)
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "boost/algorithm/string.hpp"
+#include "gflags/gflags.h"
+#include "glog/logging.h"
+#include "google/protobuf/text_format.h"
+
+#include "caffe/caffe.hpp"
+#include "caffe/filler.hpp"
+#include "caffe/util/benchmark.hpp"
+#include "caffe/util/io.hpp"
+
+using namespace caffe;  // NOLINT(build/namespaces)
+using std::map;
+
+DEFINE_string(batch_sizes, "1,8,64",
+    "The batch sizes N to benchmark, separated by ','.");
+DEFINE_string(lengths, "35,70",
+    "The sequence lengths T to benchmark, separated by ','.");
+DEFINE_int32(classes, 5990,
+    "The number of CTC classes C, including the blank.");
+DEFINE_int32(label_length, 10,
+    "The number of labels per line fed to the CTC loss.");
+DEFINE_string(filter, "",
+    "Optional; only run the cases whose name contains one of these strings, "
+    "separated by ','.");
+DEFINE_int32(iterations, 20,
+    "The number of timed iterations of each case.");
+DEFINE_int32(warmup, 2,
+    "The number of untimed iterations run before timing each case.");
+DEFINE_int32(cpu_threads, 1,
+    "Optional; the number of threads CPU layers may use.");
+DEFINE_int32(gpu, -1,
+    "Optional; run in GPU mode on this device.");
+DEFINE_string(json, "",
+    "Optional; also write the results to this file as JSON.");
+DEFINE_string(machine, "",
+    "Optional; a description of the machine, recorded in the JSON file.");
+DEFINE_string(baseline, "",
+    "Optional; a file written earlier with -json to compare against.");
+DEFINE_double(tolerance, 0.1,
+    "The relative slowdown of a median time over the baseline that counts "
+    "as a regression.");
+DEFINE_double(min_ms, 0.01,
+    "Baseline medians below this are too close to the timer resolution to "
+    "be compared.");
+
+// One layer with its bottom shapes. The bottoms marked in label_bottoms get
+// label indices that are never the blank instead of random data.
+struct Case {
+  string name;
+  string layer;
+  vector<vector<int> > bottom_shapes;
+  vector<bool> label_bottoms;
+  bool backward;
+};
+
+struct CaseResult {
+  string name;
+  vector<double> forward;
+  vector<double> backward;
+};
+
+static vector<int> Shape(int a, int b, int c = -1, int d = -1) {
+  vector<int> shape;
+  shape.push_back(a);
+  shape.push_back(b);
+  if (c > 0) shape.push_back(c);
+  if (d > 0) shape.push_back(d);
+  return shape;
+}
+
+static void AddCase(vector<Case>* cases, const string& name,
+    const string& layer, const vector<int>& shape, bool backward) {
+  Case c;
+  c.name = name;
+  c.layer = layer;
+  c.bottom_shapes.push_back(shape);
+  c.label_bottoms.push_back(false);
+  c.backward = backward;
+  cases->push_back(c);
+}
+
+static const char* kDenseBlock =
+    "type: 'DenseBlock' "
+    "denseblock_param { numTransition: 8 initChannel: 64 growthRate: 8 "
+    "  Filter_Filler { type: 'msra' } "
+    "  BN_Scaler_Filler { type: 'constant' value: 1 } "
+    "  BN_Bias_Filler { type: 'constant' value: 0 } }";
+
+static vector<Case> MakeCases() {
+  const vector<int> batch_sizes = ParseIntList(FLAGS_batch_sizes);
+  const vector<int> lengths = ParseIntList(FLAGS_lengths);
+  const int C = FLAGS_classes;
+  vector<Case> cases;
+  for (int t = 0; t < lengths.size(); ++t) {
+    for (int n = 0; n < batch_sizes.size(); ++n) {
+      const int T = lengths[t];
+      const int N = batch_sizes[n];
+      std::ostringstream suffix;
+      suffix << "/N" << N << "/T" << T;
+      // The pooled features, N x 256 x 1 x T, into T x N x 256.
+      AddCase(&cases, "Transpose" + suffix.str(),
+          "type: 'Transpose' transpose_param { dim: 3 dim: 2 dim: 0 dim: 1 }",
+          Shape(N, 256, 1, T), true);
+      // The backward direction of the bidirectional LSTMs.
+      for (int h = 256; h <= 512; h *= 2) {
+        std::ostringstream name;
+        name << "Reverse" << suffix.str() << "/H" << h;
+        AddCase(&cases, name.str(),
+            "type: 'Reverse' reverse_param { axis: 0 }", Shape(T, N, h), true);
+      }
+      for (int block = 0; block < 3; ++block) {
+        std::ostringstream name;
+        name << "DenseBlock" << suffix.str() << "/" << (16 >> block) << "x"
+             << ((4 * T) >> block);
+        AddCase(&cases, name.str(), kDenseBlock,
+            Shape(N, 64, 16 >> block, (4 * T) >> block), true);
+      }
+      Case ctc;
+      ctc.name = "WarpCTCLoss" + suffix.str();
+      ctc.layer = "type: 'WarpCTCLoss' ctc_loss_param { blank_index: 0 }";
+      ctc.bottom_shapes.push_back(Shape(T, N, C, 1));
+      ctc.bottom_shapes.push_back(Shape(N, FLAGS_label_length));
+      ctc.label_bottoms.push_back(false);
+      ctc.label_bottoms.push_back(true);
+      ctc.backward = true;
+      cases.push_back(ctc);
+      AddCase(&cases, "CTCGreedyDecoder" + suffix.str(),
+          "type: 'CTCGreedyDecoder' ctc_decoder_param { blank_index: 0 }",
+          Shape(T, N, C), false);
+    }
+  }
+  return cases;
+}
+
+static bool Selected(const string& name) {
+  if (FLAGS_filter.empty()) {
+    return true;
+  }
+  vector<string> filters;
+  boost::split(filters, FLAGS_filter, boost::is_any_of(","));
+  for (int i = 0; i < filters.size(); ++i) {
+    if (name.find(filters[i]) != string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static CaseResult RunCase(const Case& c) {
+  LayerParameter param;
+  CHECK(google::protobuf::TextFormat::ParseFromString(
+      "name: '" + c.name + "' " + c.layer, &param)) << c.layer;
+  param.set_phase(TRAIN);
+
+  vector<shared_ptr<Blob<float> > > blobs;
+  vector<Blob<float>*> bottom, top;
+  FillerParameter filler_param;
+  filler_param.set_std(1);
+  GaussianFiller<float> filler(filler_param);
+  for (int i = 0; i < c.bottom_shapes.size(); ++i) {
+    blobs.push_back(shared_ptr<Blob<float> >(
+        new Blob<float>(c.bottom_shapes[i])));
+    bottom.push_back(blobs.back().get());
+    if (c.label_bottoms[i]) {
+      float* labels = bottom[i]->mutable_cpu_data();
+      for (int j = 0; j < bottom[i]->count(); ++j) {
+        labels[j] = 1 + j % (FLAGS_classes - 1);
+      }
+    } else {
+      filler.Fill(bottom[i]);
+    }
+  }
+  blobs.push_back(shared_ptr<Blob<float> >(new Blob<float>()));
+  top.push_back(blobs.back().get());
+
+  shared_ptr<Layer<float> > layer = LayerRegistry<float>::CreateLayer(param);
+  layer->SetUp(bottom, top);
+  if (c.backward && layer->loss(0) == 0) {
+    // Loss layers set their own top diff to the loss weight in SetUp.
+    filler.Fill(top[0]);
+    caffe_copy(top[0]->count(), top[0]->cpu_data(),
+        top[0]->mutable_cpu_diff());
+  }
+  vector<bool> propagate_down(c.label_bottoms.size());
+  for (int i = 0; i < propagate_down.size(); ++i) {
+    propagate_down[i] = !c.label_bottoms[i];
+  }
+
+  CaseResult result;
+  result.name = c.name;
+  Timer timer;
+  for (int i = 0; i < FLAGS_warmup + FLAGS_iterations; ++i) {
+    timer.Start();
+    layer->Forward(bottom, top);
+    timer.Stop();
+    if (i >= FLAGS_warmup) {
+      result.forward.push_back(timer.MicroSeconds() / 1000);
+    }
+    if (!c.backward) {
+      continue;
+    }
+    timer.Start();
+    layer->Backward(top, propagate_down, bottom);
+    timer.Stop();
+    if (i >= FLAGS_warmup) {
+      result.backward.push_back(timer.MicroSeconds() / 1000);
+    }
+  }
+  return result;
+}
+
+// Every case is written on a line of its own so that ReadBaseline can read
+// the file back without a JSON parser.
+static void WriteJson(const string& filename,
+    const vector<CaseResult>& results) {
+  std::ostringstream out;
+  out << "{\n"
+      << "  \"mode\": \"" << (FLAGS_gpu >= 0 ? "GPU" : "CPU") << "\",\n"
+      << "  \"machine\": " << JsonString(FLAGS_machine) << ",\n"
+      << "  \"cpu_threads\": " << FLAGS_cpu_threads << ",\n"
+      << "  \"filter\": " << JsonString(FLAGS_filter) << ",\n"
+      << "  \"iterations\": " << FLAGS_iterations << ",\n"
+      << "  \"cases\": [";
+  for (int i = 0; i < results.size(); ++i) {
+    const CaseResult& result = results[i];
+    out << (i ? ",\n" : "\n")
+        << "    {\"name\": " << JsonString(result.name)
+        << ", \"forward_ms\": " << JsonPercentiles(result.forward);
+    if (result.backward.size()) {
+      out << ", \"backward_ms\": " << JsonPercentiles(result.backward);
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+  WriteFileAtomically(out.str(), filename);
+}
+
+// Returns the median recorded under key on a case line, or -1.
+static double ParseMedian(const string& line, const string& key) {
+  size_t pos = line.find("\"" + key + "\"");
+  if (pos == string::npos) {
+    return -1;
+  }
+  const string median = "\"p50\": ";
+  pos = line.find(median, pos);
+  if (pos == string::npos) {
+    return -1;
+  }
+  return atof(line.c_str() + pos + median.size());
+}
+
+// Maps the case names of a baseline file to their forward and backward
+// medians.
+static map<string, std::pair<double, double> > ReadBaseline(
+    const string& filename) {
+  std::ifstream infile(filename.c_str());
+  CHECK(infile.good()) << "Failed to open baseline " << filename;
+  map<string, std::pair<double, double> > baseline;
+  const string name = "\"name\": \"";
+  string line;
+  while (std::getline(infile, line)) {
+    size_t begin = line.find(name);
+    if (begin == string::npos) {
+      continue;
+    }
+    begin += name.size();
+    const size_t end = line.find('"', begin);
+    CHECK_NE(end, string::npos) << "Malformed baseline line: " << line;
+    baseline[line.substr(begin, end - begin)] = std::make_pair(
+        ParseMedian(line, "forward_ms"), ParseMedian(line, "backward_ms"));
+  }
+  return baseline;
+}
+
+// Logs the change of a median over its baseline and returns whether it is a
+// regression.
+static bool Compare(const string& name, const char* pass, double current,
+    double baseline) {
+  if (baseline < FLAGS_min_ms) {
+    return false;
+  }
+  const double change = current / baseline - 1;
+  const bool regression = change > FLAGS_tolerance;
+  LOG(INFO) << std::setw(36) << std::left << name << " " << pass << " "
+      << std::setprecision(4) << current << " ms vs. " << baseline
+      << " ms (" << std::showpos << 100 * change << std::noshowpos << "%)"
+      << (regression ? "  REGRESSION" : "");
+  return regression;
+}
+
+int benchmark() {
+  CHECK_GT(FLAGS_iterations, 0);
+  CHECK_GE(FLAGS_warmup, 0);
+  CHECK_GT(FLAGS_classes, 1);
+  if (FLAGS_gpu >= 0) {
+    LOG(INFO) << "Use GPU with device ID " << FLAGS_gpu;
+    Caffe::SetDevice(FLAGS_gpu);
+    Caffe::set_mode(Caffe::GPU);
+  } else {
+    LOG(INFO) << "Use CPU.";
+    Caffe::set_mode(Caffe::CPU);
+  }
+  Caffe::set_cpu_threads(FLAGS_cpu_threads);
+  Caffe::set_random_seed(1701);
+
+  const vector<Case> cases = MakeCases();
+  vector<CaseResult> results;
+  for (int i = 0; i < cases.size(); ++i) {
+    if (!Selected(cases[i].name)) {
+      continue;
+    }
+    results.push_back(RunCase(cases[i]));
+    const CaseResult& result = results.back();
+    std::ostringstream line;
+    line << std::setw(36) << std::left << result.name << " forward: "
+         << std::setprecision(4) << Percentile(result.forward, 50) << " ms";
+    if (result.backward.size()) {
+      line << ", backward: " << Percentile(result.backward, 50) << " ms";
+    }
+    LOG(INFO) << line.str();
+  }
+  CHECK_GT(results.size(), 0) << "No case matches " << FLAGS_filter;
+  if (FLAGS_json.size()) {
+    WriteJson(FLAGS_json, results);
+    LOG(INFO) << "Results written to " << FLAGS_json;
+  }
+  if (FLAGS_baseline.empty()) {
+    return 0;
+  }
+  const map<string, std::pair<double, double> > baseline =
+      ReadBaseline(FLAGS_baseline);
+  int regressions = 0;
+  for (int i = 0; i < results.size(); ++i) {
+    const CaseResult& result = results[i];
+    map<string, std::pair<double, double> >::const_iterator it =
+        baseline.find(result.name);
+    if (it == baseline.end()) {
+      LOG(INFO) << result.name << " is not in the baseline.";
+      continue;
+    }
+    regressions += Compare(result.name, "forward ",
+        Percentile(result.forward, 50), it->second.first);
+    if (result.backward.size()) {
+      regressions += Compare(result.name, "backward",
+          Percentile(result.backward, 50), it->second.second);
+    }
+  }
+  LOG(INFO) << regressions << " regression(s) over " << FLAGS_baseline;
+  return regressions ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  // Print output to stderr (while still logging).
+  FLAGS_alsologtostderr = 1;
+  gflags::SetUsageMessage("Times the OCR specific layers one by one.\n"
+      "Usage:\n"
+      "    ocr_layer_bench [-batch_sizes=1,8,64] [-lengths=35,70] "
+      "[-filter=Dense,CTC]\n"
+      "        [-json=RESULTS.json] [-baseline=BASELINE.json]\n");
+  caffe::GlobalInit(&argc, &argv);
+  return benchmark();
+}